@@ -14,8 +14,12 @@
 #include "application/app_state_manager.hpp"
 #include "blockchain/block_tree.hpp"
 #include "common/hexutil.hpp"
+#include "crypto/hasher.hpp"
+#include "primitives/block_header.hpp"
 #include "primitives/common.hpp"
 #include "primitives/transaction.hpp"
+#include "scale/scale.hpp"
+#include "storage/trie/trie_diff.hpp"
 #include "storage/trie/trie_storage.hpp"
 #include "subscription/extrinsic_event_key_repository.hpp"
 #include "subscription/subscriber.hpp"
@@ -127,13 +131,17 @@ namespace kagome::api {
       std::shared_ptr<subscription::ExtrinsicEventKeyRepository>
           extrinsic_event_key_repo,
       std::shared_ptr<blockchain::BlockTree> block_tree,
-      std::shared_ptr<storage::trie::TrieStorage> trie_storage)
+      std::shared_ptr<storage::trie::TrieStorage> trie_storage,
+      std::shared_ptr<storage::trie::TrieDiff> trie_diff,
+      std::shared_ptr<crypto::Hasher> hasher)
       : thread_pool_(std::move(thread_pool)),
         listeners_(std::move(listeners.listeners)),
         server_(std::move(server)),
         logger_{log::createLogger("ApiService", "api")},
         block_tree_{std::move(block_tree)},
         trie_storage_{std::move(trie_storage)},
+        trie_diff_{std::move(trie_diff)},
+        hasher_{std::move(hasher)},
         subscription_engines_{.storage = std::move(storage_sub_engine),
                               .chain = std::move(chain_sub_engine),
                               .ext = std::move(ext_sub_engine)},
@@ -141,6 +149,8 @@ namespace kagome::api {
     BOOST_ASSERT(thread_pool_);
     BOOST_ASSERT(block_tree_);
     BOOST_ASSERT(trie_storage_);
+    BOOST_ASSERT(trie_diff_);
+    BOOST_ASSERT(hasher_);
     BOOST_ASSERT(
         std::all_of(listeners_.cbegin(), listeners_.cend(), [](auto &listener) {
           return listener != nullptr;
@@ -221,6 +231,23 @@ namespace kagome::api {
 
       listener->setHandlerForNewSession(std::move(on_new_session));
     }
+
+    chain_sub_ = std::make_shared<ChainEventSubscriber>(
+        subscription_engines_.chain);
+    chain_sub_->subscribe(chain_sub_->generateSubscriptionSetId(),
+                          primitives::events::ChainEventType::kNewHeads);
+    chain_sub_->setCallback(
+        [wp = weak_from_this()](
+            subscription::SubscriptionSetId,
+            auto &,
+            primitives::events::ChainEventType,
+            const primitives::events::ChainEventParams &event_params) {
+          if (auto self = wp.lock()) {
+            self->notifyStorageChanges(
+                boost::get<primitives::events::HeadsEventParams>(event_params)
+                    .get());
+          }
+        });
     return true;
   }  // namespace kagome::api
 
@@ -526,6 +553,40 @@ namespace kagome::api {
               createStateStorageEvent({{key, data}}, block));
   }
 
+  void ApiServiceImpl::notifyStorageChanges(
+      const primitives::BlockHeader &header) {
+    auto keys = subscription_engines_.storage->keys();
+    if (keys.empty()) {
+      return;
+    }
+    auto parent_res = block_tree_->getBlockHeader(header.parent_hash);
+    if (not parent_res) {
+      SL_DEBUG(logger_,
+               "Storage changes of block #{} are not reported: {}",
+               header.number,
+               parent_res.error().message());
+      return;
+    }
+    auto block_hash = hasher_->blake2b_256(scale::encode(header).value());
+    auto res = trie_diff_->diff(
+        parent_res.value().state_root,
+        header.state_root,
+        keys,
+        [&](const Buffer &key, const std::optional<common::BufferView> &value)
+            -> outcome::result<void> {
+          // a removed key is reported with an empty value
+          subscription_engines_.storage->notify(
+              key, value ? Buffer{value.value()} : Buffer{}, block_hash);
+          return outcome::success();
+        });
+    if (not res) {
+      SL_DEBUG(logger_,
+               "Storage changes of block {} are not reported: {}",
+               block_hash.toHex(),
+               res.error().message());
+    }
+  }
+
   void ApiServiceImpl::onChainEvent(
       SubscriptionSetId set_id,
       SessionPtr &session,
@@ -35,10 +35,14 @@ namespace kagome::application {
 namespace kagome::blockchain {
   class BlockTree;
 }
+namespace kagome::crypto {
+  class Hasher;
+}
 namespace kagome::primitives {
   struct Transaction;
 }
 namespace kagome::storage::trie {
+  class TrieDiff;
   class TrieStorage;
 }
 namespace kagome::subscription {
@@ -135,7 +139,9 @@ namespace kagome::api {
         std::shared_ptr<subscription::ExtrinsicEventKeyRepository>
             extrinsic_event_key_repo,
         std::shared_ptr<blockchain::BlockTree> block_tree,
-        std::shared_ptr<storage::trie::TrieStorage> trie_storage);
+        std::shared_ptr<storage::trie::TrieStorage> trie_storage,
+        std::shared_ptr<storage::trie::TrieDiff> trie_diff,
+        std::shared_ptr<crypto::Hasher> hasher);
 
     ~ApiServiceImpl() override = default;
 
@@ -209,6 +215,12 @@ namespace kagome::api {
         primitives::events::SubscribedExtrinsicId id,
         const primitives::events::ExtrinsicLifecycleEvent &params);
 
+    /**
+     * Notifies the storage subscribers about the keys changed by the block
+     * with {@param header}, comparing its state to the one of its parent
+     */
+    void notifyStorageChanges(const primitives::BlockHeader &header);
+
     template <typename Func>
     auto withSession(kagome::api::Session::SessionId id, Func &&f) {
       if (auto session_context = findSessionById(id)) {
@@ -241,6 +253,8 @@ namespace kagome::api {
     log::Logger logger_;
     std::shared_ptr<blockchain::BlockTree> block_tree_;
     std::shared_ptr<storage::trie::TrieStorage> trie_storage_;
+    std::shared_ptr<storage::trie::TrieDiff> trie_diff_;
+    std::shared_ptr<crypto::Hasher> hasher_;
 
     std::mutex subscribed_sessions_cs_;
     std::unordered_map<Session::SessionId,
@@ -254,6 +268,9 @@ namespace kagome::api {
     } subscription_engines_;
     std::shared_ptr<subscription::ExtrinsicEventKeyRepository>
         extrinsic_event_key_repo_;
+
+    // receives the new blocks to report the storage changes of
+    ChainEventSubscriberPtr chain_sub_;
   };
 }  // namespace kagome::api
 
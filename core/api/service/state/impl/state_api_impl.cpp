@@ -27,6 +27,10 @@ OUTCOME_CPP_DEFINE_CATEGORY(kagome::api, StateApiImpl::Error, e) {
     case E::END_BLOCK_LOWER_THAN_BEGIN_BLOCK:
       return "End block is lower (is an ancestor of) the begin block "
              "(should be the other way)";
+    case E::MAX_CHANGED_KEYS_EXCEEDED:
+      return "Maximum number of changed keys ("
+             + std::to_string(kagome::api::StateApiImpl::kMaxChangedKeys)
+             + ") exceeded";
   }
   return "Unknown State API error";
 }
@@ -36,16 +40,19 @@ namespace kagome::api {
   StateApiImpl::StateApiImpl(
       std::shared_ptr<blockchain::BlockHeaderRepository> block_repo,
       std::shared_ptr<const storage::trie::TrieStorage> trie_storage,
+      std::shared_ptr<const storage::trie::TrieDiff> trie_diff,
       std::shared_ptr<blockchain::BlockTree> block_tree,
       std::shared_ptr<runtime::Core> runtime_core,
       std::shared_ptr<runtime::Metadata> metadata)
       : header_repo_{std::move(block_repo)},
         storage_{std::move(trie_storage)},
+        trie_diff_{std::move(trie_diff)},
         block_tree_{std::move(block_tree)},
         runtime_core_{std::move(runtime_core)},
         metadata_{std::move(metadata)} {
     BOOST_ASSERT(nullptr != header_repo_);
     BOOST_ASSERT(nullptr != storage_);
+    BOOST_ASSERT(nullptr != trie_diff_);
     BOOST_ASSERT(nullptr != block_tree_);
     BOOST_ASSERT(nullptr != runtime_core_);
     BOOST_ASSERT(nullptr != metadata_);
@@ -121,8 +128,6 @@ namespace kagome::api {
       gsl::span<const common::Buffer> keys,
       const primitives::BlockHash &from,
       std::optional<primitives::BlockHash> opt_to) const {
-    // TODO(Harrm): Optimize once changes trie is enabled (and a warning/assert
-    // for now that will fire once it is, just not to forget)
     auto to =
         opt_to.has_value() ? opt_to.value() : block_tree_->deepestLeaf().hash;
     if (keys.size() > static_cast<ssize_t>(kMaxKeySetSize)) {
@@ -141,32 +146,52 @@ namespace kagome::api {
     }
 
     std::vector<StorageChangeSet> changes;
-    std::map<gsl::span<const uint8_t>, std::optional<common::Buffer>>
-        last_values;
-
-    // TODO(Harrm): optimize it to use a lazy generator instead of returning the
-    // whole vector with block ids
-    OUTCOME_TRY(range, block_tree_->getChainByBlocks(from, to));
-    for (auto &block : range) {
-      OUTCOME_TRY(header, header_repo_->getBlockHeader(block));
-      OUTCOME_TRY(batch, storage_->getEphemeralBatchAt(header.state_root));
-      StorageChangeSet change{block, {}};
-      for (auto &key : keys) {
-        OUTCOME_TRY(opt_value, batch->tryGet(key));
-        auto it = last_values.find(key);
-        if (it == last_values.end() || it->second != opt_value) {
+    std::optional<storage::trie::RootHash> prev_state_root;
+
+    // the blocks of the range are streamed along with their headers
+    auto on_block = [&](const primitives::BlockInfo &block,
+                        const primitives::BlockHeader &header)
+        -> outcome::result<bool> {
+      StorageChangeSet change{block.hash, {}};
+      if (not prev_state_root.has_value()) {
+        // values at the first block of the range are reported as is
+        OUTCOME_TRY(batch, storage_->getEphemeralBatchAt(header.state_root));
+        for (auto &key : keys) {
+          OUTCOME_TRY(opt_value, batch->tryGet(key));
           std::optional<common::Buffer> opt_buffer =
               opt_value ? std::make_optional(opt_value.value().get())
                         : std::nullopt;
           change.changes.push_back(
               StorageChangeSet::Change{common::Buffer{key}, opt_buffer});
         }
-        last_values[key] = std::move(opt_value);
+      } else {
+        // only the keys changed since the previous block are found, sharing
+        // the unchanged parts of the tries
+        OUTCOME_TRY(trie_diff_->diff(
+            prev_state_root.value(),
+            header.state_root,
+            keys,
+            [&change](const common::Buffer &key,
+                      const std::optional<common::BufferView> &value)
+                -> outcome::result<void> {
+              change.changes.push_back(StorageChangeSet::Change{
+                  key,
+                  value ? std::make_optional(common::Buffer{value.value()})
+                        : std::nullopt});
+              return outcome::success();
+            }));
       }
+      prev_state_root = header.state_root;
       if (!change.changes.empty()) {
         changes.emplace_back(std::move(change));
       }
-    }
+      return true;
+    };
+    OUTCOME_TRY(block_tree_->forEachBlockInChain(
+        from,
+        to,
+        blockchain::BlockTree::GetChainDirection::ASCEND,
+        on_block));
     return changes;
   }
 
@@ -179,6 +204,29 @@ namespace kagome::api {
     return queryStorage(keys, at, at);
   }
 
+  outcome::result<std::vector<common::Buffer>> StateApiImpl::getChangedKeys(
+      const primitives::BlockHash &from,
+      std::optional<primitives::BlockHash> opt_to) const {
+    auto to =
+        opt_to.has_value() ? opt_to.value() : block_tree_->deepestLeaf().hash;
+    OUTCOME_TRY(from_header, header_repo_->getBlockHeader(from));
+    OUTCOME_TRY(to_header, header_repo_->getBlockHeader(to));
+    std::vector<common::Buffer> keys;
+    OUTCOME_TRY(trie_diff_->diff(
+        from_header.state_root,
+        to_header.state_root,
+        [&keys](const common::Buffer &key,
+                const std::optional<common::BufferView> &)
+            -> outcome::result<void> {
+          if (keys.size() == kMaxChangedKeys) {
+            return Error::MAX_CHANGED_KEYS_EXCEEDED;
+          }
+          keys.push_back(key);
+          return outcome::success();
+        }));
+    return keys;
+  }
+
   outcome::result<primitives::Version> StateApiImpl::getRuntimeVersion(
       const std::optional<primitives::BlockHash> &at) const {
     if (at) {
@@ -11,6 +11,7 @@
 #include "blockchain/block_tree.hpp"
 #include "runtime/runtime_api/core.hpp"
 #include "runtime/runtime_api/metadata.hpp"
+#include "storage/trie/trie_diff.hpp"
 #include "storage/trie/trie_storage.hpp"
 
 namespace kagome::api {
@@ -20,14 +21,17 @@ namespace kagome::api {
     enum class Error {
       MAX_BLOCK_RANGE_EXCEEDED = 1,
       MAX_KEY_SET_SIZE_EXCEEDED,
-      END_BLOCK_LOWER_THAN_BEGIN_BLOCK
+      END_BLOCK_LOWER_THAN_BEGIN_BLOCK,
+      MAX_CHANGED_KEYS_EXCEEDED
     };
 
     static constexpr size_t kMaxBlockRange = 256;
     static constexpr size_t kMaxKeySetSize = 64;
+    static constexpr size_t kMaxChangedKeys = 1000;
 
     StateApiImpl(std::shared_ptr<blockchain::BlockHeaderRepository> block_repo,
                  std::shared_ptr<const storage::trie::TrieStorage> trie_storage,
+                 std::shared_ptr<const storage::trie::TrieDiff> trie_diff,
                  std::shared_ptr<blockchain::BlockTree> block_tree,
                  std::shared_ptr<runtime::Core> runtime_core,
                  std::shared_ptr<runtime::Metadata> metadata);
@@ -58,6 +62,10 @@ namespace kagome::api {
         gsl::span<const common::Buffer> keys,
         std::optional<primitives::BlockHash> at) const override;
 
+    outcome::result<std::vector<common::Buffer>> getChangedKeys(
+        const primitives::BlockHash &from,
+        std::optional<primitives::BlockHash> to) const override;
+
     outcome::result<uint32_t> subscribeStorage(
         const std::vector<common::Buffer> &keys) override;
 
@@ -78,6 +86,7 @@ namespace kagome::api {
    private:
     std::shared_ptr<blockchain::BlockHeaderRepository> header_repo_;
     std::shared_ptr<const storage::trie::TrieStorage> storage_;
+    std::shared_ptr<const storage::trie::TrieDiff> trie_diff_;
     std::shared_ptr<blockchain::BlockTree> block_tree_;
     std::shared_ptr<runtime::Core> runtime_core_;
 
@@ -0,0 +1,47 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_API_REQUESTS_GET_CHANGED_KEYS_HPP
+#define KAGOME_API_REQUESTS_GET_CHANGED_KEYS_HPP
+
+#include "api/service/base_request.hpp"
+
+#include "api/service/state/state_api.hpp"
+
+namespace kagome::api::state::request {
+
+  /**
+   * Request processor for state_getChangedKeys RPC, which returns the keys
+   * changed between the states of two blocks
+   */
+  class GetChangedKeys final
+      : public details::RequestType<std::vector<common::Buffer>,
+                                    std::string,
+                                    std::optional<std::string>> {
+   public:
+    explicit GetChangedKeys(std::shared_ptr<StateApi> api)
+        : api_(std::move(api)) {
+      BOOST_ASSERT(api_);
+    }
+
+    outcome::result<std::vector<common::Buffer>> execute() override {
+      OUTCOME_TRY(from,
+                  primitives::BlockHash::fromHexWithPrefix(getParam<0>()));
+      std::optional<primitives::BlockHash> to{};
+      if (auto opt_to = getParam<1>(); opt_to.has_value()) {
+        OUTCOME_TRY(to_,
+                    primitives::BlockHash::fromHexWithPrefix(opt_to.value()));
+        to = std::move(to_);
+      }
+      return api_->getChangedKeys(from, std::move(to));
+    }
+
+   private:
+    std::shared_ptr<StateApi> api_;
+  };
+
+}  // namespace kagome::api::state::request
+
+#endif  // KAGOME_API_REQUESTS_GET_CHANGED_KEYS_HPP
@@ -55,6 +55,15 @@ namespace kagome::api {
         gsl::span<const common::Buffer> keys,
         std::optional<primitives::BlockHash> at) const = 0;
 
+    /**
+     * @return keys which values differ in the states of {@param from} and
+     * {@param to} blocks (the best block if not specified), in the
+     * lexicographical order
+     */
+    virtual outcome::result<std::vector<common::Buffer>> getChangedKeys(
+        const primitives::BlockHash &from,
+        std::optional<primitives::BlockHash> to) const = 0;
+
     virtual outcome::result<uint32_t> subscribeStorage(
         const std::vector<common::Buffer> &keys) = 0;
     virtual outcome::result<bool> unsubscribeStorage(
@@ -6,6 +6,7 @@
 #include "api/service/state/state_jrpc_processor.hpp"
 
 #include "api/jrpc/jrpc_method.hpp"
+#include "api/service/state/requests/get_changed_keys.hpp"
 #include "api/service/state/requests/get_keys_paged.hpp"
 #include "api/service/state/requests/get_metadata.hpp"
 #include "api/service/state/requests/get_runtime_version.hpp"
@@ -45,6 +46,9 @@ namespace kagome::api::state {
     server_->registerHandler("state_queryStorageAt",
                              Handler<request::QueryStorageAt>(api_));
 
+    server_->registerHandler("state_getChangedKeys",
+                             Handler<request::GetChangedKeys>(api_));
+
     server_->registerHandler("state_getRuntimeVersion",
                              Handler<request::GetRuntimeVersion>(api_));
 
@@ -65,6 +65,13 @@ namespace kagome::application {
     virtual boost::filesystem::path keystorePath(
         std::string chain_id) const = 0;
 
+    /**
+     * @return path to the node's cache of compiled runtimes for the chain
+     * \arg chain_id
+     */
+    virtual boost::filesystem::path runtimeCachePath(
+        std::string chain_id) const = 0;
+
     /**
      * @return the secret key to use for libp2p networking
      */
@@ -192,6 +199,51 @@ namespace kagome::application {
 
     virtual bool isOffchainIndexingEnabled() const = 0;
 
+    /**
+     * @return memory budget of the cache of decoded trie nodes in MiB, zero
+     * disables the cache
+     */
+    virtual uint32_t trieCacheSize() const = 0;
+
+    /**
+     * @return disk space limit of the cache of compiled runtimes in MiB, zero
+     * disables the cache
+     */
+    virtual uint32_t runtimeCacheSize() const = 0;
+
+    /**
+     * @return number of the latest finalized blocks, which states are kept in
+     * the storage, or std::nullopt if all the states are kept (archive mode)
+     */
+    virtual std::optional<uint32_t> statePruningDepth() const = 0;
+
+    /**
+     * @return capacity of the database cache of uncompressed blocks in MiB
+     */
+    virtual uint32_t dbCacheSize() const = 0;
+
+    /**
+     * @return bits per key of the database bloom filter, zero disables the
+     * filter
+     */
+    virtual uint32_t dbBloomFilterBits() const = 0;
+
+    /**
+     * @return size of the database in-memory write buffer in MiB
+     */
+    virtual uint32_t dbWriteBufferSize() const = 0;
+
+    /**
+     * @return whether the database blocks are compressed
+     */
+    virtual bool isDbCompressionEnabled() const = 0;
+
+    /**
+     * @return share of the slot duration in percent, which authoring of a
+     * block may take
+     */
+    virtual uint32_t blockProposalShare() const = 0;
+
     virtual std::optional<primitives::BlockId> recoverState() const = 0;
   };
 
@@ -56,6 +56,14 @@ namespace {
   const auto def_offchain_worker_mode =
       kagome::application::AppConfiguration::OffchainWorkerMode::WhenValidating;
   const bool def_enable_offchain_indexing = false;
+  const uint32_t def_trie_cache_size = 256;  // MiB
+  const uint32_t def_runtime_cache_size = 512;  // MiB
+  const std::optional<uint32_t> def_state_pruning_depth = std::nullopt;
+  const uint32_t def_db_cache_size = 128;  // MiB
+  const uint32_t def_db_bloom_filter_bits = 10;
+  const uint32_t def_db_write_buffer_size = 32;  // MiB
+  const bool def_db_compression = true;
+  const uint32_t def_block_proposal_share = 66;  // percent of a slot
   const std::optional<kagome::primitives::BlockId> def_block_to_recover =
       std::nullopt;
 
@@ -118,6 +126,26 @@ namespace {
 
     return std::nullopt;
   }
+
+  /**
+   * @return whether {@param str} is a valid state pruning mode, which is either
+   * "archive" or a positive number of the kept finalized states
+   */
+  bool str_to_state_pruning_depth(std::string_view str,
+                                  std::optional<uint32_t> &depth) {
+    if (str == "archive") {
+      depth = std::nullopt;
+      return true;
+    }
+    uint32_t value = 0;
+    auto result = std::from_chars(str.data(), str.data() + str.size(), value);
+    if (result.ec != std::errc{} or result.ptr != str.data() + str.size()
+        or value == 0) {
+      return false;
+    }
+    depth = value;
+    return true;
+  }
 }  // namespace
 
 namespace kagome::application {
@@ -141,6 +169,14 @@ namespace kagome::application {
         runtime_exec_method_{def_runtime_exec_method},
         offchain_worker_mode_{def_offchain_worker_mode},
         enable_offchain_indexing_{def_enable_offchain_indexing},
+        trie_cache_size_{def_trie_cache_size},
+        runtime_cache_size_{def_runtime_cache_size},
+        state_pruning_depth_{def_state_pruning_depth},
+        db_cache_size_{def_db_cache_size},
+        db_bloom_filter_bits_{def_db_bloom_filter_bits},
+        db_write_buffer_size_{def_db_write_buffer_size},
+        db_compression_{def_db_compression},
+        block_proposal_share_{def_block_proposal_share},
         recovery_state_{def_block_to_recover} {}
 
   fs::path AppConfigurationImpl::chainSpecPath() const {
@@ -160,6 +196,10 @@ namespace kagome::application {
     return chainPath(chain_id) / "keystore";
   }
 
+  fs::path AppConfigurationImpl::runtimeCachePath(std::string chain_id) const {
+    return chainPath(chain_id) / "runtimes-cache";
+  }
+
   AppConfigurationImpl::FilePtr AppConfigurationImpl::open_file(
       const std::string &filepath) {
     assert(!filepath.empty());
@@ -276,12 +316,27 @@ namespace kagome::application {
     std::string chain_spec_path_str;
     load_str(val, "chain", chain_spec_path_str);
     chain_spec_path_ = fs::path(chain_spec_path_str);
+    load_u32(val, "block-proposal-share", block_proposal_share_);
   }
 
   void AppConfigurationImpl::parse_storage_segment(rapidjson::Value &val) {
     std::string base_path_str;
     load_str(val, "base-path", base_path_str);
     base_path_ = fs::path(base_path_str);
+    load_u32(val, "trie-cache-size", trie_cache_size_);
+    load_u32(val, "runtime-cache-size", runtime_cache_size_);
+    load_u32(val, "db-cache-size", db_cache_size_);
+    load_u32(val, "db-bloom-filter-bits", db_bloom_filter_bits_);
+    load_u32(val, "db-write-buffer-size", db_write_buffer_size_);
+    load_bool(val, "db-compression", db_compression_);
+    std::string state_pruning_str;
+    if (load_str(val, "state-pruning", state_pruning_str)
+        and not str_to_state_pruning_depth(state_pruning_str,
+                                           state_pruning_depth_)) {
+      SL_ERROR(logger_,
+               "Invalid state pruning mode specified: '{}'",
+               state_pruning_str);
+    }
   }
 
   void AppConfigurationImpl::parse_network_segment(rapidjson::Value &val) {
@@ -362,6 +417,8 @@ namespace kagome::application {
     max_blocks_in_response_ = std::clamp(max_blocks_in_response_,
                                          kAbsolutMinBlocksInResponse,
                                          kAbsolutMaxBlocksInResponse);
+
+    block_proposal_share_ = std::clamp(block_proposal_share_, 1u, 100u);
     return true;
   }
 
@@ -576,6 +633,7 @@ namespace kagome::application {
         ("offchain-worker", po::value<std::string>()->default_value("WhenValidating"),
           "Should execute offchain workers on every block.\n"
           "Possible values: Always, Never, WhenValidating. WhenValidating is used by default.")
+        ("block-proposal-share", po::value<uint32_t>(), "share of the slot duration in percent, after which block authoring stops including transactions (66 by default)")
         ;
 
     po::options_description storage_desc("Storage options");
@@ -583,6 +641,13 @@ namespace kagome::application {
         ("base-path,d", po::value<std::string>(), "required, node base path (keeps storage and keys for known chains)")
         ("enable-offchain-indexing", po::value<bool>(), "enable Offchain Indexing API, which allow block import to write to offchain DB)")
         ("recovery", po::value<std::string>(), "recovers block storage to state after provided block presented by number or hash, and stop after that")
+        ("trie-cache-size", po::value<uint32_t>(), "memory budget of the cache of decoded trie nodes in MiB, 0 disables the cache (256 by default)")
+        ("runtime-cache-size", po::value<uint32_t>(), "disk space limit of the cache of compiled runtimes in MiB, 0 disables the cache (512 by default)")
+        ("db-cache-size", po::value<uint32_t>(), "capacity of the database cache of uncompressed blocks in MiB (128 by default)")
+        ("db-bloom-filter-bits", po::value<uint32_t>(), "bits per key of the database bloom filter, 0 disables the filter (10 by default)")
+        ("db-write-buffer-size", po::value<uint32_t>(), "size of the database in-memory write buffer in MiB (32 by default)")
+        ("db-compression", po::value<bool>(), "compress the database blocks with snappy (true by default)")
+        ("state-pruning", po::value<std::string>(), "state pruning mode: 'archive' keeps all the states, a number N keeps the states of N latest finalized blocks only ('archive' by default)")
         ;
 
     po::options_description network_desc("Network options");
@@ -999,6 +1064,46 @@ namespace kagome::application {
       enable_offchain_indexing_ = true;
     }
 
+    find_argument<uint32_t>(vm, "trie-cache-size", [&](uint32_t val) {
+      trie_cache_size_ = val;
+    });
+
+    find_argument<uint32_t>(vm, "runtime-cache-size", [&](uint32_t val) {
+      runtime_cache_size_ = val;
+    });
+
+    find_argument<uint32_t>(
+        vm, "db-cache-size", [&](uint32_t val) { db_cache_size_ = val; });
+
+    find_argument<uint32_t>(vm, "db-bloom-filter-bits", [&](uint32_t val) {
+      db_bloom_filter_bits_ = val;
+    });
+
+    find_argument<uint32_t>(vm, "db-write-buffer-size", [&](uint32_t val) {
+      db_write_buffer_size_ = val;
+    });
+
+    find_argument<bool>(
+        vm, "db-compression", [&](bool val) { db_compression_ = val; });
+
+    find_argument<uint32_t>(vm, "block-proposal-share", [&](uint32_t val) {
+      block_proposal_share_ = val;
+    });
+
+    bool is_state_pruning_valid = true;
+    find_argument<std::string>(
+        vm, "state-pruning", [&](const std::string &val) {
+          is_state_pruning_valid =
+              str_to_state_pruning_depth(val, state_pruning_depth_);
+          if (not is_state_pruning_valid) {
+            SL_ERROR(
+                logger_, "Invalid state pruning mode specified: '{}'", val);
+          }
+        });
+    if (not is_state_pruning_valid) {
+      return false;
+    }
+
     bool has_recovery = false;
     find_argument<std::string>(vm, "recovery", [&](const std::string &val) {
       has_recovery = true;
@@ -72,6 +72,8 @@ namespace kagome::application {
     boost::filesystem::path chainPath(std::string chain_id) const override;
     boost::filesystem::path databasePath(std::string chain_id) const override;
     boost::filesystem::path keystorePath(std::string chain_id) const override;
+    boost::filesystem::path runtimeCachePath(
+        std::string chain_id) const override;
 
     const std::optional<crypto::Ed25519PrivateKey> &nodeKey() const override {
       return node_key_;
@@ -154,6 +156,30 @@ namespace kagome::application {
     bool isOffchainIndexingEnabled() const override {
       return enable_offchain_indexing_;
     }
+    uint32_t trieCacheSize() const override {
+      return trie_cache_size_;
+    }
+    uint32_t runtimeCacheSize() const override {
+      return runtime_cache_size_;
+    }
+    std::optional<uint32_t> statePruningDepth() const override {
+      return state_pruning_depth_;
+    }
+    uint32_t dbCacheSize() const override {
+      return db_cache_size_;
+    }
+    uint32_t dbBloomFilterBits() const override {
+      return db_bloom_filter_bits_;
+    }
+    uint32_t dbWriteBufferSize() const override {
+      return db_write_buffer_size_;
+    }
+    bool isDbCompressionEnabled() const override {
+      return db_compression_;
+    }
+    uint32_t blockProposalShare() const override {
+      return block_proposal_share_;
+    }
     virtual std::optional<primitives::BlockId> recoverState() const override {
       return recovery_state_;
     }
@@ -281,6 +307,14 @@ namespace kagome::application {
     RuntimeExecutionMethod runtime_exec_method_;
     OffchainWorkerMode offchain_worker_mode_;
     bool enable_offchain_indexing_;
+    uint32_t trie_cache_size_;
+    uint32_t runtime_cache_size_;
+    std::optional<uint32_t> state_pruning_depth_;
+    uint32_t db_cache_size_;
+    uint32_t db_bloom_filter_bits_;
+    uint32_t db_write_buffer_size_;
+    bool db_compression_;
+    uint32_t block_proposal_share_;
     std::optional<primitives::BlockId> recovery_state_;
   };
 
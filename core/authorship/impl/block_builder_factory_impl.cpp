@@ -12,23 +12,24 @@ namespace kagome::authorship {
   BlockBuilderFactoryImpl::BlockBuilderFactoryImpl(
       std::shared_ptr<runtime::Core> r_core,
       std::shared_ptr<runtime::BlockBuilder> r_block_builder,
-      std::shared_ptr<blockchain::BlockHeaderRepository> header_backend)
+      std::shared_ptr<blockchain::BlockHeaderRepository> header_backend,
+      std::shared_ptr<storage::trie::TrieStorage> trie_storage)
       : r_core_(std::move(r_core)),
         r_block_builder_(std::move(r_block_builder)),
         header_backend_(std::move(header_backend)),
+        trie_storage_(std::move(trie_storage)),
         logger_{log::createLogger("BlockBuilderFactory", "authorship")} {
     BOOST_ASSERT(r_core_ != nullptr);
     BOOST_ASSERT(r_block_builder_ != nullptr);
     BOOST_ASSERT(header_backend_ != nullptr);
+    BOOST_ASSERT(trie_storage_ != nullptr);
   }
 
   outcome::result<std::unique_ptr<BlockBuilder>> BlockBuilderFactoryImpl::make(
       const kagome::primitives::BlockInfo &parent,
       primitives::Digest inherent_digest) const {
-#ifndef BOOST_ASSERT_IS_VOID
-    OUTCOME_TRY(parent_number, header_backend_->getNumberById(parent.hash));
-#endif
-    BOOST_ASSERT(parent_number == parent.number);
+    OUTCOME_TRY(parent_header, header_backend_->getBlockHeader(parent.hash));
+    BOOST_ASSERT(parent_header.number == parent.number);
 
     auto number = parent.number + 1;
     primitives::BlockHeader header;
@@ -36,13 +37,19 @@ namespace kagome::authorship {
     header.parent_hash = parent.hash;
     header.digest = std::move(inherent_digest);
 
-    if (auto res = r_core_->initialize_block(header); not res) {
+    // all the runtime calls of the block building are made on this batch, so
+    // that the intermediate states are never written to the storage
+    OUTCOME_TRY(batch,
+                trie_storage_->getPersistentBatchAt(parent_header.state_root));
+    std::shared_ptr<storage::trie::PersistentTrieBatch> shared_batch =
+        std::move(batch);
+
+    if (auto res = r_core_->initialize_block(header, shared_batch); not res) {
       logger_->error("Core_initialize_block failed: {}", res.error().message());
       return res.error();
-    } else {
-      return std::make_unique<BlockBuilderImpl>(
-          header, res.value(), r_block_builder_);
     }
+    return std::make_unique<BlockBuilderImpl>(
+        header, std::move(shared_batch), r_block_builder_);
   }
 
 }  // namespace kagome::authorship
@@ -17,13 +17,14 @@ namespace kagome::authorship {
 
   BlockBuilderImpl::BlockBuilderImpl(
       primitives::BlockHeader block_header,
-      const storage::trie::RootHash &storage_state,
+      std::shared_ptr<storage::trie::PersistentTrieBatch> batch,
       std::shared_ptr<runtime::BlockBuilder> block_builder_api)
       : block_header_{std::move(block_header)},
         block_builder_api_{std::move(block_builder_api)},
-        storage_state_{std::move(storage_state)},
+        batch_{std::move(batch)},
         logger_{log::createLogger("BlockBuilder", "authorship")} {
     BOOST_ASSERT(block_builder_api_ != nullptr);
+    BOOST_ASSERT(batch_ != nullptr);
   }
 
   outcome::result<std::vector<primitives::Extrinsic>>
@@ -31,7 +32,7 @@ namespace kagome::authorship {
       const primitives::InherentData &data) const {
     return block_builder_api_->inherent_extrinsics(
         {block_header_.number - 1, block_header_.parent_hash},
-        storage_state_,
+        batch_,
         data);
   }
 
@@ -39,7 +40,7 @@ namespace kagome::authorship {
       const primitives::Extrinsic &extrinsic) {
     auto apply_res = block_builder_api_->apply_extrinsic(
         {block_header_.number - 1, block_header_.parent_hash},
-        storage_state_,
+        batch_,
         extrinsic);
     if (not apply_res) {
       // Takes place when API method execution fails for some technical kind of
@@ -52,11 +53,10 @@ namespace kagome::authorship {
           apply_res.error().message());
       return apply_res.error();
     }
-    storage_state_ = apply_res.value().new_storage_root;
 
     using return_type = outcome::result<primitives::ExtrinsicIndex>;
     return visit_in_place(
-        apply_res.value().result,
+        apply_res.value(),
         [this, &extrinsic](
             const primitives::DispatchOutcome &outcome) -> return_type {
           if (1 == outcome.which()) {  // DispatchError
@@ -105,7 +105,13 @@ namespace kagome::authorship {
     OUTCOME_TRY(finalized_header,
                 block_builder_api_->finalize_block(
                     {block_header_.number - 1, block_header_.parent_hash},
-                    storage_state_));
+                    batch_));
+    // the only write of the block state to the storage
+    OUTCOME_TRY(state_root, batch_->commit());
+    SL_DEBUG(logger_,
+             "Block #{} state with root {} is committed",
+             block_header_.number,
+             state_root.toHex());
     return primitives::Block{finalized_header, extrinsics_};
   }
 
@@ -20,8 +20,12 @@ namespace kagome::authorship {
    public:
     ~BlockBuilderImpl() override = default;
 
+    /**
+     * @param batch persistent batch, which accumulates the state of the block
+     * after its initialization; it is committed only when the block is baked
+     */
     BlockBuilderImpl(primitives::BlockHeader block_header,
-                     const storage::trie::RootHash &storage_state,
+                     std::shared_ptr<storage::trie::PersistentTrieBatch> batch,
                      std::shared_ptr<runtime::BlockBuilder> block_builder_api);
 
     outcome::result<std::vector<primitives::Extrinsic>>
@@ -39,7 +43,7 @@ namespace kagome::authorship {
 
     primitives::BlockHeader block_header_;
     std::shared_ptr<runtime::BlockBuilder> block_builder_api_;
-    storage::trie::RootHash storage_state_;
+    std::shared_ptr<storage::trie::PersistentTrieBatch> batch_;
     log::Logger logger_;
 
     std::vector<primitives::Extrinsic> extrinsics_{};
@@ -10,6 +10,8 @@
 namespace {
   constexpr const char *kTransactionsIncludedInBlock =
       "kagome_proposer_number_of_transactions";
+  constexpr const char *kExtrinsicApplyTime =
+      "kagome_proposer_extrinsic_apply_time";
 }
 
 namespace kagome::authorship {
@@ -17,16 +19,19 @@ namespace kagome::authorship {
   ProposerImpl::ProposerImpl(
       std::shared_ptr<BlockBuilderFactory> block_builder_factory,
       std::shared_ptr<transaction_pool::TransactionPool> transaction_pool,
+      std::shared_ptr<clock::SystemClock> clock,
       std::shared_ptr<primitives::events::ExtrinsicSubscriptionEngine>
           ext_sub_engine,
       std::shared_ptr<subscription::ExtrinsicEventKeyRepository>
           extrinsic_event_key_repo)
       : block_builder_factory_{std::move(block_builder_factory)},
         transaction_pool_{std::move(transaction_pool)},
+        clock_{std::move(clock)},
         ext_sub_engine_{std::move(ext_sub_engine)},
         extrinsic_event_key_repo_{std::move(extrinsic_event_key_repo)} {
     BOOST_ASSERT(block_builder_factory_);
     BOOST_ASSERT(transaction_pool_);
+    BOOST_ASSERT(clock_);
     BOOST_ASSERT(ext_sub_engine_);
     BOOST_ASSERT(extrinsic_event_key_repo_);
 
@@ -35,15 +40,33 @@ namespace kagome::authorship {
         "Number of transactions included in block");
     metric_tx_included_in_block_ =
         metrics_registry_->registerGaugeMetric(kTransactionsIncludedInBlock);
+
+    metrics_registry_->registerHistogramFamily(
+        kExtrinsicApplyTime,
+        "Time taken to apply an extrinsic when constructing new block");
+    metric_extrinsic_apply_time_ = metrics_registry_->registerHistogramMetric(
+        kExtrinsicApplyTime,
+        {0.0001, 0.00025, 0.0005, 0.001, 0.0025, 0.005, 0.01, 0.025, 0.05,
+         0.1});
   }
 
   outcome::result<primitives::Block> ProposerImpl::propose(
       const primitives::BlockInfo &parent_block,
       const primitives::InherentData &inherent_data,
-      const primitives::Digest &inherent_digest) {
+      const primitives::Digest &inherent_digest,
+      clock::SystemClock::TimePoint deadline) {
     OUTCOME_TRY(block_builder,
                 block_builder_factory_->make(parent_block, inherent_digest));
 
+    auto push_extrinsic = [&](const primitives::Extrinsic &xt) {
+      auto start = std::chrono::steady_clock::now();
+      auto res = block_builder->pushExtrinsic(xt);
+      std::chrono::duration<double> apply_time =
+          std::chrono::steady_clock::now() - start;
+      metric_extrinsic_apply_time_->observe(apply_time.count());
+      return res;
+    };
+
     auto inherent_xts_res = block_builder->getInherentExtrinsics(inherent_data);
     if (not inherent_xts_res) {
       logger_->error("BlockBuilder->inherent_extrinsics failed with error: {}",
@@ -54,7 +77,7 @@ namespace kagome::authorship {
 
     for (const auto &xt : inherent_xts) {
       SL_DEBUG(logger_, "Adding inherent extrinsic: {}", xt.data);
-      auto inserted_res = block_builder->pushExtrinsic(xt);
+      auto inserted_res = push_extrinsic(xt);
       if (not inserted_res) {
         if (BlockBuilderError::EXHAUSTS_RESOURCES == inserted_res.error()) {
           SL_WARN(logger_,
@@ -82,7 +105,7 @@ namespace kagome::authorship {
                remove_res.error().message(),
                parent_block);
     }
-    const auto &ready_txs = transaction_pool_->getReadyTransactions();
+    auto ready_txs = transaction_pool_->getReadyQueue();
 
     bool transaction_pushed = false;
     bool hit_block_size_limit = false;
@@ -98,10 +121,19 @@ namespace kagome::authorship {
     // number of transactions to be pushed to the block
 
     size_t included_tx_count = 0;
-    for (const auto &[hash, tx] : ready_txs) {
-      const auto &tx_ref = tx;
+    // included transactions and the ones rejected by the runtime
+    std::vector<primitives::Transaction::Hash> processed_txs;
+    while (auto tx = ready_txs.next()) {
+      if (clock_->now() + kDeadlineSoftLimit >= deadline) {
+        SL_DEBUG(logger_,
+                 "Block proposal deadline is close, {} ready transactions "
+                 "are left. Proceeding with proposing.",
+                 ready_txs.size() + 1);
+        break;
+      }
+
       scale::ScaleEncoderStream s(true);
-      s << tx_ref->ext;
+      s << tx->ext;
       auto estimate_tx_size = s.size();
 
       if (block_size + estimate_tx_size > block_size_limit) {
@@ -119,8 +151,8 @@ namespace kagome::authorship {
         break;
       }
 
-      SL_DEBUG(logger_, "Adding extrinsic: {}", tx_ref->ext.data);
-      auto inserted_res = block_builder->pushExtrinsic(tx->ext);
+      SL_DEBUG(logger_, "Adding extrinsic: {}", tx->ext.data);
+      auto inserted_res = push_extrinsic(tx->ext);
       if (not inserted_res) {
         if (BlockBuilderError::EXHAUSTS_RESOURCES == inserted_res.error()) {
           if (skipped < kMaxSkippedTransactions) {
@@ -137,11 +169,14 @@ namespace kagome::authorship {
           logger_->warn("Extrinsic {} was not added to the block. Reason: {}",
                         tx->ext.data,
                         inserted_res.error().message());
+          processed_txs.push_back(tx->hash);
         }
       } else {  // tx was pushed successfully
         block_size += estimate_tx_size;
         transaction_pushed = true;
         ++included_tx_count;
+        processed_txs.push_back(tx->hash);
+        ready_txs.markIncluded(*tx);
       }
     }
     metric_tx_included_in_block_->set(included_tx_count);
@@ -154,7 +189,7 @@ namespace kagome::authorship {
 
     OUTCOME_TRY(block, block_builder->bake());
 
-    for (const auto &[hash, tx] : ready_txs) {
+    for (const auto &hash : processed_txs) {
       auto removed_res = transaction_pool_->removeOne(hash);
       if (not removed_res) {
         logger_->error(
@@ -26,11 +26,16 @@ namespace kagome::authorship {
     /// Default block size limit in bytes
     static constexpr size_t kBlockSizeLimit = 4 * 1024 * 1024 + 512;
 
+    /// Time left to the deadline, below which no more transactions are pushed
+    /// into the block, so that it can be finalized in time
+    static constexpr std::chrono::milliseconds kDeadlineSoftLimit{100};
+
     ~ProposerImpl() override = default;
 
     ProposerImpl(
         std::shared_ptr<BlockBuilderFactory> block_builder_factory,
         std::shared_ptr<transaction_pool::TransactionPool> transaction_pool,
+        std::shared_ptr<clock::SystemClock> clock,
         std::shared_ptr<primitives::events::ExtrinsicSubscriptionEngine>
             ext_sub_engine,
         std::shared_ptr<subscription::ExtrinsicEventKeyRepository>
@@ -39,11 +44,13 @@ namespace kagome::authorship {
     outcome::result<primitives::Block> propose(
         const primitives::BlockInfo &parent_block,
         const primitives::InherentData &inherent_data,
-        const primitives::Digest &inherent_digest) override;
+        const primitives::Digest &inherent_digest,
+        clock::SystemClock::TimePoint deadline) override;
 
    private:
     std::shared_ptr<BlockBuilderFactory> block_builder_factory_;
     std::shared_ptr<transaction_pool::TransactionPool> transaction_pool_;
+    std::shared_ptr<clock::SystemClock> clock_;
     std::shared_ptr<primitives::events::ExtrinsicSubscriptionEngine>
         ext_sub_engine_;
     std::shared_ptr<subscription::ExtrinsicEventKeyRepository>
@@ -52,6 +59,7 @@ namespace kagome::authorship {
     // Metrics
     metrics::RegistryPtr metrics_registry_ = metrics::createRegistry();
     metrics::Gauge *metric_tx_included_in_block_;
+    metrics::Histogram *metric_extrinsic_apply_time_;
 
     log::Logger logger_ = log::createLogger("Proposer", "authorship");
   };
@@ -26,12 +26,15 @@ namespace kagome::authorship {
      * @param parent_block number and hash of parent block
      * @param inherent_data additional data on block from unsigned extrinsics
      * @param inherent_digests - chain-specific block auxiliary data
+     * @param deadline - time point, after which the block should be already
+     * built, so no more transactions are included close to it
      * @return proposed block or error
      */
     virtual outcome::result<primitives::Block> propose(
         const primitives::BlockInfo &parent_block,
         const primitives::InherentData &inherent_data,
-        const primitives::Digest &inherent_digest) = 0;
+        const primitives::Digest &inherent_digest,
+        clock::SystemClock::TimePoint deadline) = 0;
   };
 
 }  // namespace kagome::authorship
@@ -7,6 +7,7 @@
 #define KAGOME_BLOCK_TREE_HPP
 
 #include <cstdint>
+#include <functional>
 #include <optional>
 #include <vector>
 
@@ -31,6 +32,14 @@ namespace kagome::blockchain {
    public:
     using BlockHashVecRes = outcome::result<std::vector<primitives::BlockHash>>;
 
+    /**
+     * Called for each block of a chain being walked through
+     * @return true to go on with the next block, false to stop the walk
+     */
+    using ChainVisitor = std::function<outcome::result<bool>(
+        const primitives::BlockInfo &block,
+        const primitives::BlockHeader &header)>;
+
     virtual ~BlockTree() = default;
 
     /**
@@ -195,6 +204,23 @@ namespace kagome::blockchain {
         const primitives::BlockHash &bottom_block,
         uint32_t max_count) const = 0;
 
+    /**
+     * Walks a chain of blocks without collecting it, loading the headers from
+     * the storage ahead of the visitor in small batches
+     * @param top_block - block, which is at the top of the chain
+     * @param bottom_block - block, which is the bottom of the chain
+     * @param direction - ASCEND walks from the top block to the bottom one,
+     * DESCEND walks backwards
+     * @param visitor - called with each block of the chain and its header
+     * @return nothing or error; if the blocks turn out not to be in a direct
+     * chain, the error may be returned after some of them were visited
+     */
+    virtual outcome::result<void> forEachBlockInChain(
+        const primitives::BlockHash &top_block,
+        const primitives::BlockHash &bottom_block,
+        GetChainDirection direction,
+        const ChainVisitor &visitor) const = 0;
+
     /**
      * Check if one block is ancestor of second one (direct chain exists)
      * @param ancestor - block, which is closest to the genesis
@@ -34,7 +34,9 @@ namespace kagome::blockchain {
     // some block in the requested chain is missing
     SOME_BLOCK_IN_CHAIN_NOT_FOUND,
     // block is not a leaf
-    BLOCK_IS_NOT_LEAF
+    BLOCK_IS_NOT_LEAF,
+    // blocks are not in a direct chain
+    NO_DIRECT_CHAIN
   };
 }  // namespace kagome::blockchain
 
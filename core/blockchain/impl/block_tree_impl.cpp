@@ -128,7 +128,8 @@ namespace kagome::blockchain {
       std::shared_ptr<primitives::BabeConfiguration> babe_configuration,
       std::shared_ptr<consensus::BabeUtil> babe_util,
       std::shared_ptr<const class JustificationStoragePolicy>
-          justification_storage_policy) {
+          justification_storage_policy,
+      std::shared_ptr<storage::trie::TrieStatePruner> state_pruner) {
     BOOST_ASSERT(storage != nullptr);
     BOOST_ASSERT(header_repo != nullptr);
 
@@ -336,6 +337,15 @@ namespace kagome::blockchain {
     SL_DEBUG(log, "Last finalized block #{}", tree->depth);
     auto meta = std::make_shared<TreeMeta>(tree, last_finalized_justification);
 
+    // the runtime code of the chain is loaded from the genesis state until
+    // the first runtime upgrade
+    if (state_pruner != nullptr) {
+      OUTCOME_TRY(genesis_header, storage->getBlockHeader(0));
+      BOOST_ASSERT_MSG(genesis_header.has_value(),
+                       "Genesis block is put on the block storage creation");
+      OUTCOME_TRY(state_pruner->pinState(genesis_header->state_root));
+    }
+
     auto *block_tree =
         new BlockTreeImpl(std::move(header_repo),
                           std::move(storage),
@@ -348,7 +358,8 @@ namespace kagome::blockchain {
                           std::move(runtime_core),
                           std::move(changes_tracker),
                           std::move(babe_util),
-                          std::move(justification_storage_policy));
+                          std::move(justification_storage_policy),
+                          std::move(state_pruner));
 
     // Add non-finalized block to the block tree
     for (auto &e : collected) {
@@ -469,7 +480,8 @@ namespace kagome::blockchain {
       std::shared_ptr<storage::changes_trie::ChangesTracker> changes_tracker,
       std::shared_ptr<consensus::BabeUtil> babe_util,
       std::shared_ptr<const JustificationStoragePolicy>
-          justification_storage_policy)
+          justification_storage_policy,
+      std::shared_ptr<storage::trie::TrieStatePruner> state_pruner)
       : header_repo_{std::move(header_repo)},
         storage_{std::move(storage)},
         tree_{std::move(cached_tree)},
@@ -481,7 +493,8 @@ namespace kagome::blockchain {
         runtime_core_(std::move(runtime_core)),
         trie_changes_tracker_(std::move(changes_tracker)),
         babe_util_(std::move(babe_util)),
-        justification_storage_policy_{std::move(justification_storage_policy)} {
+        justification_storage_policy_{std::move(justification_storage_policy)},
+        state_pruner_{std::move(state_pruner)} {
     BOOST_ASSERT(header_repo_ != nullptr);
     BOOST_ASSERT(storage_ != nullptr);
     BOOST_ASSERT(tree_ != nullptr);
@@ -537,7 +550,7 @@ namespace kagome::blockchain {
 
   outcome::result<void> BlockTreeImpl::addBlockHeader(
       const primitives::BlockHeader &header) {
-    auto parent = tree_->getRoot().findByHash(header.parent_hash);
+    auto parent = tree_->find(header.parent_hash);
     if (!parent) {
       return BlockTreeError::NO_PARENT;
     }
@@ -581,7 +594,7 @@ namespace kagome::blockchain {
   outcome::result<void> BlockTreeImpl::addBlock(
       const primitives::Block &block) {
     // Check if we know parent of this block; if not, we cannot insert it
-    auto parent = tree_->getRoot().findByHash(block.header.parent_hash);
+    auto parent = tree_->find(block.header.parent_hash);
     if (!parent) {
       return BlockTreeError::NO_PARENT;
     }
@@ -589,6 +602,11 @@ namespace kagome::blockchain {
     // Save block
     OUTCOME_TRY(block_hash, storage_->putBlock(block));
 
+    // the state of the block is kept until the block is pruned
+    if (state_pruner_ != nullptr) {
+      OUTCOME_TRY(state_pruner_->addState(block.header.state_root));
+    }
+
     consensus::EpochNumber epoch_number = 0;
     auto babe_digests_res = consensus::getBabeDigests(block.header);
     if (babe_digests_res.has_value()) {
@@ -644,7 +662,7 @@ namespace kagome::blockchain {
       return BlockTreeError::BLOCK_IS_NOT_LEAF;
     }
 
-    auto node = tree_->getRoot().findByHash(block_hash);
+    auto node = tree_->find(block_hash);
     BOOST_ASSERT_MSG(node != nullptr,
                      "As checked before, block exists as one of leaves");
 
@@ -670,7 +688,7 @@ namespace kagome::blockchain {
              "Trying to add block {} into block tree",
              primitives::BlockInfo(block_header.number, block_hash));
 
-    auto node = tree_->getRoot().findByHash(block_hash);
+    auto node = tree_->find(block_hash);
     // Check if tree doesn't have this block; if not, we skip that
     if (node != nullptr) {
       SL_TRACE(log_,
@@ -679,7 +697,7 @@ namespace kagome::blockchain {
       return BlockTreeError::BLOCK_EXISTS;
     }
 
-    auto parent = tree_->getRoot().findByHash(block_header.parent_hash);
+    auto parent = tree_->find(block_header.parent_hash);
 
     // Check if we know parent of this block; if not, we cannot insert it
     if (parent == nullptr) {
@@ -707,7 +725,7 @@ namespace kagome::blockchain {
 
         to_add.emplace(hash, std::move(header));
 
-        if (tree_->getRoot().findByHash(header.parent_hash) != nullptr) {
+        if (tree_->find(header.parent_hash) != nullptr) {
           SL_TRACE(log_,
                    "Block {} parent of {} has found in block tree",
                    primitives::BlockInfo(header.number - 1, header.parent_hash),
@@ -730,7 +748,7 @@ namespace kagome::blockchain {
         to_add.pop();
       }
 
-      parent = tree_->getRoot().findByHash(block_header.parent_hash);
+      parent = tree_->find(block_header.parent_hash);
       BOOST_ASSERT_MSG(parent != nullptr,
                        "Parent must be restored at this moment");
 
@@ -785,7 +803,7 @@ namespace kagome::blockchain {
   outcome::result<void> BlockTreeImpl::finalize(
       const primitives::BlockHash &block_hash,
       const primitives::Justification &justification) {
-    auto node = tree_->getRoot().findByHash(block_hash);
+    auto node = tree_->find(block_hash);
     if (!node) {
       return BlockTreeError::NON_FINALIZED_BLOCK_NOT_FOUND;
     }
@@ -817,6 +835,11 @@ namespace kagome::blockchain {
 
     OUTCOME_TRY(reorganize());
 
+    // the blocks are looked up by number, so the finalized chain has to be the
+    // best one already
+    OUTCOME_TRY(
+        pruneFinalizedStates(last_finalized_block_info.number, node->depth));
+
     OUTCOME_TRY(
         storage_->setBlockTreeLeaves({tree_->getMetadata().leaves.begin(),
                                       tree_->getMetadata().leaves.end()}));
@@ -959,7 +982,7 @@ namespace kagome::blockchain {
     auto hash = to_block;
 
     // Try to retrieve from cached tree
-    if (auto node = tree_->getRoot().findByHash(hash)) {
+    if (auto node = tree_->find(hash)) {
       chain.emplace_back(hash);
       while (maximum > chain.size()) {
         auto parent = node->parent.lock();
@@ -1071,10 +1094,14 @@ namespace kagome::blockchain {
       const primitives::BlockInfo &top_block,
       const primitives::BlockInfo &bottom_block,
       std::optional<uint32_t> max_count) const {
-    if (auto from = tree_->getRoot().findByHash(top_block.hash)) {
+    if (auto from = tree_->find(top_block.hash)) {
       if (bottom_block.number < from->depth) {
         return std::nullopt;
       }
+      auto to = tree_->find(bottom_block.hash);
+      if (to == nullptr) {
+        return std::nullopt;
+      }
       const auto in_tree_branch_len = bottom_block.number - from->depth + 1;
       const auto response_length =
           max_count ? std::min(in_tree_branch_len, max_count.value())
@@ -1084,7 +1111,7 @@ namespace kagome::blockchain {
       result.reserve(response_length);
 
       auto res = from->applyToChain(
-          bottom_block,
+          *to,
           [&result, response_length](auto &node) -> TreeNode::ExitToken {
             result.emplace_back(node.block_hash);
             if (result.size() == response_length) {
@@ -1117,11 +1144,127 @@ namespace kagome::blockchain {
     return getChainByBlocks(top_block, bottom_block, std::nullopt);
   }
 
+  outcome::result<void> BlockTreeImpl::forEachBlockInChain(
+      const primitives::BlockHash &top_block,
+      const primitives::BlockHash &bottom_block,
+      GetChainDirection direction,
+      const ChainVisitor &visitor) const {
+    switch (direction) {
+      case GetChainDirection::ASCEND:
+        return ascendChain(top_block, bottom_block, visitor);
+      case GetChainDirection::DESCEND:
+        return descendChain(top_block, bottom_block, visitor);
+    }
+    BOOST_UNREACHABLE_RETURN(outcome::success());
+  }
+
+  outcome::result<void> BlockTreeImpl::ascendChain(
+      const primitives::BlockHash &top_block,
+      const primitives::BlockHash &bottom_block,
+      const ChainVisitor &visitor) const {
+    OUTCOME_TRY(top_number, header_repo_->getNumberByHash(top_block));
+    OUTCOME_TRY(header, header_repo_->getBlockHeader(bottom_block));
+    if (header.number < top_number) {
+      return outcome::success();
+    }
+
+    // blocks of a fork cannot be loaded by their numbers, so they are
+    // collected walking back from the bottom block until the best chain is
+    // reached; only non-finalized blocks may be there
+    std::vector<std::pair<primitives::BlockInfo, primitives::BlockHeader>> fork;
+    primitives::BlockInfo junction{header.number, bottom_block};
+    while (junction.number > top_number) {
+      auto best_header_res = header_repo_->getBlockHeader(junction.number);
+      if (best_header_res.has_value() and best_header_res.value() == header) {
+        break;
+      }
+      primitives::BlockInfo parent{junction.number - 1, header.parent_hash};
+      auto parent_header_res = header_repo_->getBlockHeader(parent.hash);
+      if (parent_header_res.has_error()) {
+        return BlockTreeError::SOME_BLOCK_IN_CHAIN_NOT_FOUND;
+      }
+      fork.emplace_back(junction, std::move(header));
+      junction = parent;
+      header = std::move(parent_header_res.value());
+    }
+
+    // keeps at least one header after the current one, which contains the
+    // hash of the current block
+    std::deque<primitives::BlockHeader> read_ahead;
+    for (auto number = top_number; number <= junction.number; ++number) {
+      if (read_ahead.size() < 2) {
+        auto last = std::min(number + kChainReadAhead, junction.number);
+        for (primitives::BlockNumber next = number + read_ahead.size();
+             next <= last;
+             ++next) {
+          if (next == junction.number) {
+            read_ahead.emplace_back(header);
+            continue;
+          }
+          auto next_header_res = header_repo_->getBlockHeader(next);
+          if (next_header_res.has_error()) {
+            return BlockTreeError::SOME_BLOCK_IN_CHAIN_NOT_FOUND;
+          }
+          read_ahead.emplace_back(std::move(next_header_res.value()));
+        }
+      }
+      auto current = std::move(read_ahead.front());
+      read_ahead.pop_front();
+      primitives::BlockInfo block{
+          number,
+          number == junction.number ? junction.hash
+                                    : read_ahead.front().parent_hash};
+      if (number == top_number and block.hash != top_block) {
+        return BlockTreeError::NO_DIRECT_CHAIN;
+      }
+      OUTCOME_TRY(go_on, visitor(block, current));
+      if (not go_on) {
+        return outcome::success();
+      }
+    }
+
+    for (auto it = fork.rbegin(); it != fork.rend(); ++it) {
+      OUTCOME_TRY(go_on, visitor(it->first, it->second));
+      if (not go_on) {
+        break;
+      }
+    }
+    return outcome::success();
+  }
+
+  outcome::result<void> BlockTreeImpl::descendChain(
+      const primitives::BlockHash &top_block,
+      const primitives::BlockHash &bottom_block,
+      const ChainVisitor &visitor) const {
+    OUTCOME_TRY(top_number, header_repo_->getNumberByHash(top_block));
+    OUTCOME_TRY(header, header_repo_->getBlockHeader(bottom_block));
+    if (header.number < top_number) {
+      return outcome::success();
+    }
+
+    primitives::BlockInfo block{header.number, bottom_block};
+    while (true) {
+      if (block.number == top_number and block.hash != top_block) {
+        return BlockTreeError::NO_DIRECT_CHAIN;
+      }
+      OUTCOME_TRY(go_on, visitor(block, header));
+      if (not go_on or block.number == top_number) {
+        return outcome::success();
+      }
+      block = {block.number - 1, header.parent_hash};
+      auto header_res = header_repo_->getBlockHeader(block.hash);
+      if (header_res.has_error()) {
+        return BlockTreeError::SOME_BLOCK_IN_CHAIN_NOT_FOUND;
+      }
+      header = std::move(header_res.value());
+    }
+  }
+
   bool BlockTreeImpl::hasDirectChain(
       const primitives::BlockHash &ancestor,
       const primitives::BlockHash &descendant) const {
-    auto ancestor_node_ptr = tree_->getRoot().findByHash(ancestor);
-    auto descendant_node_ptr = tree_->getRoot().findByHash(descendant);
+    auto ancestor_node_ptr = tree_->find(ancestor);
+    auto descendant_node_ptr = tree_->find(descendant);
 
     /*
      * check that ancestor is above descendant
@@ -1263,7 +1406,7 @@ namespace kagome::blockchain {
 
   BlockTreeImpl::BlockHashVecRes BlockTreeImpl::getChildren(
       const primitives::BlockHash &block) const {
-    if (auto node = tree_->getRoot().findByHash(block); node != nullptr) {
+    if (auto node = tree_->find(block); node != nullptr) {
       std::vector<primitives::BlockHash> result;
       result.reserve(node->children.size());
       for (const auto &child : node->children) {
@@ -1288,7 +1431,7 @@ namespace kagome::blockchain {
   outcome::result<consensus::EpochDigest> BlockTreeImpl::getEpochDigest(
       consensus::EpochNumber epoch_number,
       primitives::BlockHash block_hash) const {
-    auto node = tree_->getRoot().findByHash(block_hash);
+    auto node = tree_->find(block_hash);
     if (node) {
       if (node->epoch_number != epoch_number) {
         return *node->next_epoch_digest;
@@ -1303,7 +1446,7 @@ namespace kagome::blockchain {
     auto leaves = getLeaves();
     leaf_depths.reserve(leaves.size());
     for (auto &leaf : leaves) {
-      auto leaf_node = tree_->getRoot().findByHash(leaf);
+      auto leaf_node = tree_->find(leaf);
       leaf_depths.emplace_back(
           primitives::BlockInfo{leaf_node->depth, leaf_node->block_hash});
     }
@@ -1383,6 +1526,16 @@ namespace kagome::blockchain {
         }
       }
 
+      if (state_pruner_ != nullptr) {
+        OUTCOME_TRY(header, getBlockHeader(node->block_hash));
+        // the state of a discarded runtime upgrade is not needed anymore
+        OUTCOME_TRY(state_pruner_->unpinState(header.state_root));
+        // only the blocks added with their bodies reference their states
+        if (block_body_res.has_value()) {
+          OUTCOME_TRY(state_pruner_->pruneState(header.state_root));
+        }
+      }
+
       tree_->removeFromMeta(node);
       OUTCOME_TRY(storage_->removeBlock({node->depth, node->block_hash}));
     }
@@ -1400,6 +1553,32 @@ namespace kagome::blockchain {
     return outcome::success();
   }
 
+  outcome::result<void> BlockTreeImpl::pruneFinalizedStates(
+      primitives::BlockNumber last_finalized,
+      primitives::BlockNumber new_finalized) {
+    if (state_pruner_ == nullptr) {
+      return outcome::success();
+    }
+    // the states of the blocks up to (finalized - depth) are pruned, so the
+    // ones up to (last_finalized - depth) were pruned by the previous calls;
+    // the genesis state is pinned instead of being referenced by its block
+    auto depth = state_pruner_->pruningDepth();
+    if (new_finalized <= depth) {
+      return outcome::success();
+    }
+    primitives::BlockNumber first =
+        last_finalized > depth ? last_finalized - depth + 1 : 1;
+    for (auto number = first; number <= new_finalized - depth; ++number) {
+      OUTCOME_TRY(header, getBlockHeader(number));
+      OUTCOME_TRY(state_pruner_->pruneState(header.state_root));
+    }
+    SL_DEBUG(log_,
+             "Pruned states of finalized blocks #{}..#{}",
+             first,
+             new_finalized - depth);
+    return outcome::success();
+  }
+
   outcome::result<void> BlockTreeImpl::reorganize() {
     auto block = BlockTreeImpl::deepestLeaf();
     if (block.number == 0) {
@@ -30,6 +30,7 @@
 #include "primitives/babe_configuration.hpp"
 #include "primitives/event_types.hpp"
 #include "runtime/runtime_api/core.hpp"
+#include "storage/trie/trie_state_pruner.hpp"
 #include "storage/trie/trie_storage.hpp"
 #include "subscription/extrinsic_event_key_repository.hpp"
 #include "telemetry/service.hpp"
@@ -49,7 +50,16 @@ namespace kagome::blockchain {
 
   class BlockTreeImpl : public BlockTree {
    public:
-    /// Create an instance of block tree
+    /// Number of headers loaded ahead of the visitor when walking a chain
+    static constexpr primitives::BlockNumber kChainReadAhead = 32;
+
+    /**
+     * Create an instance of block tree
+     * @param state_pruner removes the states of the discarded blocks, which
+     * are unpinned as well, and of the finalized blocks beyond its pruning
+     * depth, except the pinned genesis state, all the states are kept if it is
+     * nullptr
+     */
     static outcome::result<std::shared_ptr<BlockTreeImpl>> create(
         std::shared_ptr<BlockHeaderRepository> header_repo,
         std::shared_ptr<BlockStorage> storage,
@@ -65,7 +75,8 @@ namespace kagome::blockchain {
         std::shared_ptr<primitives::BabeConfiguration> babe_configuration,
         std::shared_ptr<consensus::BabeUtil> babe_util,
         std::shared_ptr<const class JustificationStoragePolicy>
-            justification_storage_policy);
+            justification_storage_policy,
+        std::shared_ptr<storage::trie::TrieStatePruner> state_pruner);
 
     /// Recover block tree state at provided block
     static outcome::result<void> recover(
@@ -129,6 +140,12 @@ namespace kagome::blockchain {
         const primitives::BlockHash &top_block,
         const primitives::BlockHash &bottom_block) const override;
 
+    outcome::result<void> forEachBlockInChain(
+        const primitives::BlockHash &top_block,
+        const primitives::BlockHash &bottom_block,
+        GetChainDirection direction,
+        const ChainVisitor &visitor) const override;
+
     std::optional<primitives::Version> runtimeVersion() const override {
       return actual_runtime_version_;
     }
@@ -176,7 +193,8 @@ namespace kagome::blockchain {
         std::shared_ptr<storage::changes_trie::ChangesTracker> changes_tracker,
         std::shared_ptr<consensus::BabeUtil> babe_util,
         std::shared_ptr<const class JustificationStoragePolicy>
-            justification_storage_policy);
+            justification_storage_policy,
+        std::shared_ptr<storage::trie::TrieStatePruner> state_pruner);
 
     /**
      * Walks the chain backwards starting from \param start until the current
@@ -195,6 +213,24 @@ namespace kagome::blockchain {
                                      const primitives::BlockHash &bottom_block,
                                      std::optional<uint32_t> max_count) const;
 
+    /**
+     * Walks the chain from \param top_block to \param bottom_block. The blocks
+     * of the best chain are loaded by their numbers ahead of the visitor, the
+     * hash of each block is taken from the header of its child
+     */
+    outcome::result<void> ascendChain(const primitives::BlockHash &top_block,
+                                      const primitives::BlockHash &bottom_block,
+                                      const ChainVisitor &visitor) const;
+
+    /**
+     * Walks the chain from \param bottom_block back to \param top_block
+     * following the parent hashes
+     */
+    outcome::result<void> descendChain(
+        const primitives::BlockHash &top_block,
+        const primitives::BlockHash &bottom_block,
+        const ChainVisitor &visitor) const;
+
     /**
      * @returns the tree leaves sorted by their depth
      */
@@ -205,6 +241,15 @@ namespace kagome::blockchain {
 
     outcome::result<void> reorganize();
 
+    /**
+     * Prunes the states of the finalized blocks which are beyond the pruning
+     * depth after the finalization advanced from \param last_finalized to
+     * \param new_finalized
+     */
+    outcome::result<void> pruneFinalizedStates(
+        primitives::BlockNumber last_finalized,
+        primitives::BlockNumber new_finalized);
+
     std::shared_ptr<BlockHeaderRepository> header_repo_;
     std::shared_ptr<BlockStorage> storage_;
 
@@ -223,6 +268,7 @@ namespace kagome::blockchain {
     std::shared_ptr<const consensus::BabeUtil> babe_util_;
     std::shared_ptr<const class JustificationStoragePolicy>
         justification_storage_policy_;
+    std::shared_ptr<storage::trie::TrieStatePruner> state_pruner_;
     std::shared_ptr<application::AppStateManager> app_state_manager_;
 
     std::optional<primitives::BlockHash> genesis_block_hash_;
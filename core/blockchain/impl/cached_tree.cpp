@@ -78,16 +78,25 @@ namespace kagome::blockchain {
       const primitives::BlockInfo &chain_end,
       std::function<outcome::result<ExitToken>(TreeNode const &node)> const &op)
       const {
-    using ChildIdx = size_t;
-    std::map<primitives::BlockHash, ChildIdx> fork_choice;
-
-    const auto *current_node = findByHash(chain_end.hash).get();
-    if (current_node == nullptr) {
+    auto chain_end_node = findByHash(chain_end.hash);
+    if (chain_end_node == nullptr) {
       return Error::NO_CHAIN_BETWEEN_BLOCKS;
     }
 
     // mostly to catch typos in tests, but who knows
-    BOOST_ASSERT(current_node->depth == chain_end.number);
+    BOOST_ASSERT(chain_end_node->depth == chain_end.number);
+
+    return applyToChain(*chain_end_node, op);
+  }
+
+  outcome::result<void> TreeNode::applyToChain(
+      const TreeNode &chain_end,
+      std::function<outcome::result<ExitToken>(TreeNode const &node)> const &op)
+      const {
+    using ChildIdx = size_t;
+    std::map<primitives::BlockHash, ChildIdx> fork_choice;
+
+    const auto *current_node = &chain_end;
     // now we must memorize where to go on forks in order to traverse
     // from this to chain_end
     while (current_node->depth > this->depth) {
@@ -123,7 +132,7 @@ namespace kagome::blockchain {
       } else {
         break;
       }
-    } while (current_node->depth <= chain_end.number);
+    } while (current_node->depth <= chain_end.depth);
 
     return outcome::success();
   }
@@ -201,6 +210,24 @@ namespace kagome::blockchain {
         last_finalized{last_finalized},
         last_finalized_justification{std::move(last_finalized_justification)} {}
 
+  CachedTree::CachedTree(std::shared_ptr<TreeNode> root,
+                         std::shared_ptr<TreeMeta> metadata)
+      : root_{std::move(root)}, metadata_{std::move(metadata)} {
+    BOOST_ASSERT(root_ != nullptr);
+    BOOST_ASSERT(metadata_ != nullptr);
+
+    std::queue<std::shared_ptr<TreeNode>> nodes_to_index;
+    nodes_to_index.push(root_);
+    while (!nodes_to_index.empty()) {
+      auto &node = nodes_to_index.front();
+      for (const auto &child : node->children) {
+        nodes_to_index.push(child);
+      }
+      nodes_.emplace(node->block_hash, node);
+      nodes_to_index.pop();
+    }
+  }
+
   void CachedTree::updateTreeRoot(std::shared_ptr<TreeNode> new_trie_root,
                                   primitives::Justification justification) {
     auto prev_root = root_;
@@ -209,6 +236,29 @@ namespace kagome::blockchain {
     // now node won't be deleted while cleaning children
     root_ = std::move(new_trie_root);
 
+    // remove the nodes, which are not descendants of the new root, from the
+    // index
+    std::queue<std::shared_ptr<TreeNode>> nodes_to_unindex;
+    auto following_node = root_;
+    for (auto node = root_->parent.lock(); node != nullptr;
+         node = node->parent.lock()) {
+      nodes_.erase(node->block_hash);
+      for (const auto &child : node->children) {
+        if (child != following_node) {
+          nodes_to_unindex.push(child);
+        }
+      }
+      following_node = node;
+    }
+    while (!nodes_to_unindex.empty()) {
+      const auto &node = nodes_to_unindex.front();
+      nodes_.erase(node->block_hash);
+      for (const auto &child : node->children) {
+        nodes_to_unindex.push(child);
+      }
+      nodes_to_unindex.pop();
+    }
+
     // cleanup children from child to parent, because otherwise
     // when they are cleaned up when their parent shared ptr is deleted,
     // recursive calls of shared pointer destructors break the stack
@@ -236,9 +286,23 @@ namespace kagome::blockchain {
     return *metadata_;
   }
 
+  std::shared_ptr<const TreeNode> CachedTree::find(
+      const primitives::BlockHash &hash) const {
+    if (auto it = nodes_.find(hash); it != nodes_.end()) {
+      return it->second;
+    }
+    return nullptr;
+  }
+
+  std::shared_ptr<TreeNode> CachedTree::find(
+      const primitives::BlockHash &hash) {
+    return std::const_pointer_cast<TreeNode>(std::as_const(*this).find(hash));
+  }
+
   void CachedTree::updateMeta(const std::shared_ptr<TreeNode> &new_node) {
     auto parent = new_node->parent.lock();
     parent->children.push_back(new_node);
+    nodes_.emplace(new_node->block_hash, new_node);
 
     metadata_->leaves.insert(new_node->block_hash);
     metadata_->leaves.erase(parent->block_hash);
@@ -249,6 +313,8 @@ namespace kagome::blockchain {
   }
 
   void CachedTree::removeFromMeta(const std::shared_ptr<TreeNode> &node) {
+    nodes_.erase(node->block_hash);
+
     auto parent = node->parent.lock();
     if (parent == nullptr) {
       // Already removed with removed subtree
@@ -271,7 +337,7 @@ namespace kagome::blockchain {
       for (auto it = metadata_->leaves.begin();
            it != metadata_->leaves.end();) {
         auto &hash = *it++;
-        const auto leaf_node = root_->findByHash(hash);
+        const auto leaf_node = find(hash);
         if (leaf_node == nullptr) {
           // Already removed with removed subtree
           metadata_->leaves.erase(hash);
@@ -7,6 +7,7 @@
 #define KAGOME_BLOCKCHAIN_TREE_NODE_HPP
 
 #include <memory>
+#include <unordered_map>
 #include <unordered_set>
 
 #include "consensus/babe/common.hpp"
@@ -82,6 +83,15 @@ namespace kagome::blockchain {
         std::function<outcome::result<ExitToken>(TreeNode const &node)> const
             &op) const;
 
+    /**
+     * Same as above, but takes the node of \arg chain_end, which spares a
+     * search for it, if the node is already known
+     */
+    outcome::result<void> applyToChain(
+        const TreeNode &chain_end,
+        std::function<outcome::result<ExitToken>(TreeNode const &node)> const
+            &op) const;
+
     primitives::BlockInfo getBlockInfo() const {
       return {depth, block_hash};
     }
@@ -117,11 +127,8 @@ namespace kagome::blockchain {
   class CachedTree {
    public:
     explicit CachedTree(std::shared_ptr<TreeNode> root,
-                        std::shared_ptr<TreeMeta> metadata)
-        : root_{std::move(root)}, metadata_{std::move(metadata)} {
-      BOOST_ASSERT(root_ != nullptr);
-      BOOST_ASSERT(metadata_ != nullptr);
-    }
+                        std::shared_ptr<TreeMeta> metadata);
+
     /**
      * Remove nodes in block tree from current tree_ to {\arg new_trie_root}.
      * Needed to avoid cascade shared_ptr destructor calls which break
@@ -146,9 +153,22 @@ namespace kagome::blockchain {
 
     TreeMeta const &getMetadata() const;
 
+    /**
+     * Get a node of the tree, containing block with the specified hash, if it
+     * can be found. Unlike TreeNode::findByHash, takes constant time
+     */
+    std::shared_ptr<const TreeNode> find(
+        const primitives::BlockHash &hash) const;
+    std::shared_ptr<TreeNode> find(const primitives::BlockHash &hash);
+
    private:
     std::shared_ptr<TreeNode> root_;
     std::shared_ptr<TreeMeta> metadata_;
+
+    // all nodes of the tree by their block hashes, kept consistent with the
+    // tree by updateMeta, removeFromMeta and updateTreeRoot
+    std::unordered_map<primitives::BlockHash, std::shared_ptr<TreeNode>>
+        nodes_;
   };
 }  // namespace kagome::blockchain
 
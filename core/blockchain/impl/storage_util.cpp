@@ -49,6 +49,38 @@ namespace kagome::blockchain {
     return map.put(value_lookup_key, value);
   }
 
+  outcome::result<size_t> moveKeySpace(storage::BufferStorage &from,
+                                       storage::BufferStorage &to,
+                                       prefix::Prefix key_column) {
+    // limits the memory occupied by the batches
+    constexpr size_t kBatchSize = 100000;
+
+    size_t moved = 0;
+    auto cursor = from.cursor();
+    OUTCOME_TRY(cursor->seek(Buffer{key_column}));
+    while (cursor->isValid()) {
+      auto from_batch = from.batch();
+      auto to_batch = to.batch();
+      size_t count = 0;
+      for (; count < kBatchSize and cursor->isValid(); ++count) {
+        auto key = cursor->key().value();
+        if (key.empty() or key[0] != key_column) {
+          break;
+        }
+        OUTCOME_TRY(to_batch->put(key, cursor->value().value()));
+        OUTCOME_TRY(from_batch->remove(key));
+        OUTCOME_TRY(cursor->next());
+      }
+      if (count == 0) {
+        break;
+      }
+      OUTCOME_TRY(to_batch->commit());
+      OUTCOME_TRY(from_batch->commit());
+      moved += count;
+    }
+    return moved;
+  }
+
   outcome::result<bool> hasWithPrefix(const storage::BufferStorage &map,
                                       prefix::Prefix prefix,
                                       const primitives::BlockId &block_id) {
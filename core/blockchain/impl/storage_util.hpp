@@ -33,7 +33,10 @@ namespace kagome::blockchain {
       BLOCK_DATA = 5,
 
       // node of a trie db
-      TRIE_NODE = 7
+      TRIE_NODE = 7,
+
+      // reference counter of a trie db node, kept if state pruning is enabled
+      TRIE_NODE_REFCOUNT = 8
     };
   }
 
@@ -113,6 +116,17 @@ namespace kagome::blockchain {
   outcome::result<primitives::BlockNumber> lookupKeyToNumber(
       const common::BufferView &key);
 
+  /**
+   * Moves all the entries of key space \param key_column from \param from
+   * to \param to, e.g. when the key space is moved to a separate storage
+   * space. The entries are written to the target before being removed from the
+   * source, so an interrupted move can be resumed
+   * @return number of the moved entries
+   */
+  outcome::result<size_t> moveKeySpace(storage::BufferStorage &from,
+                                       storage::BufferStorage &to,
+                                       prefix::Prefix key_column);
+
 }  // namespace kagome::blockchain
 
 OUTCOME_HPP_DECLARE_ERROR(kagome::blockchain, KeyValueRepositoryError);
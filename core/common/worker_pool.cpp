@@ -0,0 +1,79 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "common/worker_pool.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
+#include <boost/assert.hpp>
+#include <soralog/util.hpp>
+
+namespace kagome::common {
+
+  WorkerPool::WorkerPool(const Configuration &configuration)
+      : work_guard_{context_.get_executor()} {
+    BOOST_ASSERT(configuration.workers != 0);
+    workers_.reserve(configuration.workers);
+    for (size_t i = 0; i < configuration.workers; ++i) {
+      workers_.emplace_back([this, number = i + 1] {
+        soralog::util::setThreadName("worker." + std::to_string(number));
+        context_.run();
+      });
+    }
+  }
+
+  WorkerPool::~WorkerPool() {
+    work_guard_.reset();
+    context_.stop();
+    for (auto &worker : workers_) {
+      worker.join();
+    }
+  }
+
+  void WorkerPool::parallelFor(size_t count,
+                               std::function<void(size_t)> task) {
+    // the state is shared with the queued jobs, which may start only after
+    // all the indices have been taken and this call has returned
+    struct State {
+      std::function<void(size_t)> task;
+      size_t count;
+      std::atomic_size_t next{0};
+      std::mutex mutex;
+      std::condition_variable finished_cv;
+      size_t finished = 0;
+    };
+    auto state = std::make_shared<State>();
+    state->task = std::move(task);
+    state->count = count;
+
+    auto run = [state] {
+      size_t finished = 0;
+      for (auto i = state->next++; i < state->count; i = state->next++) {
+        state->task(i);
+        ++finished;
+      }
+      if (finished != 0) {
+        std::lock_guard lock{state->mutex};
+        state->finished += finished;
+        if (state->finished == state->count) {
+          state->finished_cv.notify_all();
+        }
+      }
+    };
+
+    auto helpers = std::min(count, workers_.size() + 1);
+    for (size_t i = 1; i < helpers; ++i) {
+      post(run);
+    }
+    run();
+
+    std::unique_lock lock{state->mutex};
+    state->finished_cv.wait(lock,
+                            [&] { return state->finished == state->count; });
+  }
+
+}  // namespace kagome::common
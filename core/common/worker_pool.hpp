@@ -0,0 +1,67 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_CORE_COMMON_WORKER_POOL_HPP
+#define KAGOME_CORE_COMMON_WORKER_POOL_HPP
+
+#include <algorithm>
+#include <functional>
+#include <thread>
+#include <vector>
+
+#include <boost/asio/executor_work_guard.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/post.hpp>
+
+namespace kagome::common {
+
+  /**
+   * Fixed set of threads shared by the CPU-bound jobs of the node, e.g. the
+   * signature checks, so that they do not spawn threads of their own
+   */
+  class WorkerPool {
+   public:
+    struct Configuration {
+      size_t workers = std::max(1u, std::thread::hardware_concurrency());
+    };
+
+    explicit WorkerPool(const Configuration &configuration);
+
+    WorkerPool(const WorkerPool &) = delete;
+    WorkerPool &operator=(const WorkerPool &) = delete;
+
+    ~WorkerPool();
+
+    /**
+     * Queues \arg task to be run on one of the threads of the pool
+     */
+    template <typename Task>
+    void post(Task &&task) {
+      boost::asio::post(context_, std::forward<Task>(task));
+    }
+
+    /**
+     * Calls \arg task for each index of [0, count) on the threads of the pool
+     * and on the calling thread, returns when all the calls are finished.
+     * The calling thread takes the indices on its own as well, so the call
+     * makes progress even if all the threads of the pool are busy
+     */
+    void parallelFor(size_t count, std::function<void(size_t)> task);
+
+    /// Number of the threads of the pool
+    size_t size() const {
+      return workers_.size();
+    }
+
+   private:
+    boost::asio::io_context context_;
+    boost::asio::executor_work_guard<boost::asio::io_context::executor_type>
+        work_guard_;
+    std::vector<std::thread> workers_;
+  };
+
+}  // namespace kagome::common
+
+#endif  // KAGOME_CORE_COMMON_WORKER_POOL_HPP
@@ -16,6 +16,13 @@ namespace kagome::consensus {
     virtual ~BlockExecutor() = default;
 
     virtual outcome::result<void> applyBlock(primitives::BlockData &&block) = 0;
+
+    /**
+     * Starts the stateless checks of the \arg block in the background, while
+     * the blocks preceding it are being applied, so that its application takes
+     * less time. The block still has to be applied with applyBlock
+     */
+    virtual void prepareBlock(const primitives::BlockData &block) = 0;
   };
 
 }  // namespace kagome::consensus
@@ -35,6 +35,7 @@ using namespace std::literals::chrono_literals;
 namespace kagome::consensus::babe {
   BabeImpl::BabeImpl(
       std::shared_ptr<application::AppStateManager> app_state_manager,
+      const application::AppConfiguration &app_config,
       std::shared_ptr<BabeLottery> lottery,
       std::shared_ptr<primitives::BabeConfiguration> configuration,
       std::shared_ptr<authorship::Proposer> proposer,
@@ -50,7 +51,8 @@ namespace kagome::consensus::babe {
           authority_update_observer,
       std::shared_ptr<network::Synchronizer> synchronizer,
       std::shared_ptr<BabeUtil> babe_util,
-      std::shared_ptr<runtime::OffchainWorkerApi> offchain_worker_api)
+      std::shared_ptr<runtime::OffchainWorkerApi> offchain_worker_api,
+      std::shared_ptr<BlockStateCache> block_state_cache)
       : was_synchronized_{false},
         lottery_{std::move(lottery)},
         babe_configuration_{std::move(configuration)},
@@ -66,6 +68,8 @@ namespace kagome::consensus::babe {
         synchronizer_(std::move(synchronizer)),
         babe_util_(std::move(babe_util)),
         offchain_worker_api_(std::move(offchain_worker_api)),
+        block_state_cache_(std::move(block_state_cache)),
+        block_proposal_share_{app_config.blockProposalShare()},
         log_{log::createLogger("Babe", "babe")},
         telemetry_{telemetry::createTelemetryService()} {
     BOOST_ASSERT(lottery_);
@@ -81,6 +85,7 @@ namespace kagome::consensus::babe {
     BOOST_ASSERT(synchronizer_);
     BOOST_ASSERT(babe_util_);
     BOOST_ASSERT(offchain_worker_api_);
+    BOOST_ASSERT(block_state_cache_);
 
     BOOST_ASSERT(app_state_manager);
 
@@ -695,8 +700,10 @@ namespace kagome::consensus::babe {
     const auto &babe_pre_digest = babe_pre_digest_res.value();
 
     // create new block
-    auto pre_seal_block_res =
-        proposer_->propose(best_block_, inherent_data, {babe_pre_digest});
+    auto deadline = babe_util_->slotStartTime(current_slot_)
+                  + babe_util_->slotDuration() * block_proposal_share_ / 100;
+    auto pre_seal_block_res = proposer_->propose(
+        best_block_, inherent_data, {babe_pre_digest}, deadline);
     if (!pre_seal_block_res) {
       SL_ERROR(log_,
                "Cannot propose a block: {}",
@@ -782,6 +789,12 @@ namespace kagome::consensus::babe {
     }
     telemetry_->notifyBlockImported(block_info, telemetry::BlockOrigin::kOwn);
 
+    // the state of the block is in the storage already, it is not to be
+    // produced again if the block is imported once more
+    block_state_cache_->put(block_hash,
+                            paras_inherent_data.parent_header.state_root,
+                            block.header.state_root);
+
     // observe possible changes of authorities
     // (must be done strictly after block will be added)
     for (auto &digest_item : block.header.digest) {
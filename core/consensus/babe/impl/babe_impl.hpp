@@ -11,6 +11,7 @@
 #include <boost/asio/basic_waitable_timer.hpp>
 #include <memory>
 
+#include "application/app_configuration.hpp"
 #include "application/app_state_manager.hpp"
 #include "authorship/proposer.hpp"
 #include "blockchain/block_tree.hpp"
@@ -19,6 +20,7 @@
 #include "consensus/babe/babe_lottery.hpp"
 #include "consensus/babe/babe_util.hpp"
 #include "consensus/babe/block_executor.hpp"
+#include "consensus/babe/impl/block_state_cache.hpp"
 #include "consensus/babe/types/slot.hpp"
 #include "crypto/hasher.hpp"
 #include "crypto/sr25519_provider.hpp"
@@ -61,6 +63,7 @@ namespace kagome::consensus::babe {
      * Create an instance of Babe implementation
      */
     BabeImpl(std::shared_ptr<application::AppStateManager> app_state_manager,
+             const application::AppConfiguration &app_config,
              std::shared_ptr<BabeLottery> lottery,
              std::shared_ptr<primitives::BabeConfiguration> configuration,
              std::shared_ptr<authorship::Proposer> proposer,
@@ -76,7 +79,8 @@ namespace kagome::consensus::babe {
                  authority_update_observer,
              std::shared_ptr<network::Synchronizer> synchronizer,
              std::shared_ptr<BabeUtil> babe_util,
-             std::shared_ptr<runtime::OffchainWorkerApi> offchain_worker_api);
+             std::shared_ptr<runtime::OffchainWorkerApi> offchain_worker_api,
+             std::shared_ptr<BlockStateCache> block_state_cache);
 
     ~BabeImpl() override = default;
 
@@ -165,6 +169,10 @@ namespace kagome::consensus::babe {
     std::shared_ptr<network::Synchronizer> synchronizer_;
     std::shared_ptr<BabeUtil> babe_util_;
     std::shared_ptr<runtime::OffchainWorkerApi> offchain_worker_api_;
+    std::shared_ptr<BlockStateCache> block_state_cache_;
+
+    // percent of the slot duration given to block proposal
+    const uint32_t block_proposal_share_;
 
     State current_state_{State::WAIT_REMOTE_STATUS};
 
@@ -7,6 +7,8 @@
 
 #include <chrono>
 
+#include <boost/range/adaptor/transformed.hpp>
+
 #include "blockchain/block_tree_error.hpp"
 #include "blockchain/impl/common.hpp"
 #include "consensus/babe/impl/babe_digests_util.hpp"
@@ -16,6 +18,8 @@
 #include "primitives/common.hpp"
 #include "runtime/runtime_api/offchain_worker_api.hpp"
 #include "scale/scale.hpp"
+#include "storage/predefined_keys.hpp"
+#include "storage/trie/serialization/ordered_trie_hash.hpp"
 #include "transaction_pool/transaction_pool_error.hpp"
 
 OUTCOME_CPP_DEFINE_CATEGORY(kagome::consensus, BlockExecutorImpl::Error, e) {
@@ -27,6 +31,8 @@ OUTCOME_CPP_DEFINE_CATEGORY(kagome::consensus, BlockExecutorImpl::Error, e) {
       return "Parent not found";
     case E::INTERNAL_ERROR:
       return "Internal error";
+    case E::INVALID_EXTRINSICS_ROOT:
+      return "Extrinsics root does not match extrinsics in the block";
   }
   return "Unknown error";
 }
@@ -34,7 +40,24 @@ OUTCOME_CPP_DEFINE_CATEGORY(kagome::consensus, BlockExecutorImpl::Error, e) {
 namespace {
   constexpr const char *kBlockExecutionTime =
       "kagome_block_verification_and_import_time";
-}
+  constexpr const char *kBlockExecutionSkipped =
+      "kagome_block_execution_skipped";
+
+  /// Limits the number of blocks whose checks are done ahead of application
+  constexpr size_t kMaxPreparedBlocks = 64;
+
+  bool extrinsicsRootMatches(const kagome::primitives::BlockHeader &header,
+                             const kagome::primitives::BlockBody &body) {
+    using boost::adaptors::transformed;
+    auto ext_root_res = kagome::storage::trie::calculateOrderedTrieHash(
+        body | transformed([](const auto &ext) {
+          return kagome::common::Buffer{scale::encode(ext).value()};
+        }));
+    return ext_root_res.has_value()
+           and ext_root_res.value()
+                   == kagome::common::Buffer(header.extrinsics_root);
+  }
+}  // namespace
 
 namespace kagome::consensus {
 
@@ -49,7 +72,11 @@ namespace kagome::consensus {
       std::shared_ptr<authority::AuthorityUpdateObserver>
           authority_update_observer,
       std::shared_ptr<BabeUtil> babe_util,
-      std::shared_ptr<runtime::OffchainWorkerApi> offchain_worker_api)
+      std::shared_ptr<runtime::OffchainWorkerApi> offchain_worker_api,
+      std::shared_ptr<BlockStateCache> block_state_cache,
+      std::shared_ptr<storage::trie::TrieStorage> trie_storage,
+      std::shared_ptr<storage::changes_trie::ChangesTracker> changes_tracker,
+      std::shared_ptr<common::WorkerPool> worker_pool)
       : block_tree_{std::move(block_tree)},
         core_{std::move(core)},
         babe_configuration_{std::move(configuration)},
@@ -60,6 +87,10 @@ namespace kagome::consensus {
         authority_update_observer_{std::move(authority_update_observer)},
         babe_util_(std::move(babe_util)),
         offchain_worker_api_(std::move(offchain_worker_api)),
+        block_state_cache_{std::move(block_state_cache)},
+        trie_storage_{std::move(trie_storage)},
+        changes_tracker_{std::move(changes_tracker)},
+        worker_pool_{std::move(worker_pool)},
         logger_{log::createLogger("BlockExecutor", "block_executor")},
         telemetry_{telemetry::createTelemetryService()} {
     BOOST_ASSERT(block_tree_ != nullptr);
@@ -72,6 +103,10 @@ namespace kagome::consensus {
     BOOST_ASSERT(authority_update_observer_ != nullptr);
     BOOST_ASSERT(babe_util_ != nullptr);
     BOOST_ASSERT(offchain_worker_api_ != nullptr);
+    BOOST_ASSERT(block_state_cache_ != nullptr);
+    BOOST_ASSERT(trie_storage_ != nullptr);
+    BOOST_ASSERT(changes_tracker_ != nullptr);
+    BOOST_ASSERT(worker_pool_ != nullptr);
     BOOST_ASSERT(logger_ != nullptr);
     BOOST_ASSERT(telemetry_ != nullptr);
 
@@ -81,6 +116,12 @@ namespace kagome::consensus {
     metric_block_execution_time_ = metrics_registry_->registerHistogramMetric(
         kBlockExecutionTime,
         {0.005, 0.01, 0.025, 0.05, 0.1, 0.25, 0.5, 1, 2.5, 5, 10});
+    metrics_registry_->registerCounterFamily(
+        kBlockExecutionSkipped,
+        "Number of imported blocks whose execution was skipped, as their "
+        "state had already been produced by this node");
+    metric_block_execution_skipped_ =
+        metrics_registry_->registerCounterMetric(kBlockExecutionSkipped);
   }
 
   outcome::result<void> BlockExecutorImpl::applyBlock(
@@ -105,6 +146,8 @@ namespace kagome::consensus {
 
     auto block_hash = hasher_->blake2b_256(scale::encode(header).value());
 
+    auto prepared = takePreparedBlock(block_hash);
+
     bool block_already_exists = false;
 
     // check if block body already exists. If so, do not apply
@@ -126,6 +169,12 @@ namespace kagome::consensus {
     }
     auto &body = b.body.value();
 
+    if (not(prepared.has_value() ? prepared->extrinsics_root_valid
+                                 : extrinsicsRootMatches(header, body))) {
+      logger_->warn("Skipping a block with invalid extrinsics root");
+      return Error::INVALID_EXTRINSICS_ROOT;
+    }
+
     primitives::Block block{.header = std::move(header),
                             .body = std::move(body)};
 
@@ -196,12 +245,24 @@ namespace kagome::consensus {
                                         this_block_epoch_descriptor.authorities,
                                         babe_header.authority_index);
 
-    OUTCOME_TRY(block_validator_->validateHeader(
-        block.header,
+    HeaderValidationParams validation_params{
         epoch_number,
         this_block_epoch_descriptor.authorities[babe_header.authority_index].id,
         threshold,
-        this_block_epoch_descriptor.randomness));
+        this_block_epoch_descriptor.randomness};
+    if (prepared.has_value()
+        and prepared->validated_with == validation_params) {
+      SL_TRACE(logger_,
+               "Header of block {} has been validated ahead",
+               primitives::BlockInfo(block.header.number, block_hash));
+    } else {
+      OUTCOME_TRY(
+          block_validator_->validateHeader(block.header,
+                                           validation_params.epoch_number,
+                                           validation_params.authority_id,
+                                           validation_params.threshold,
+                                           validation_params.randomness));
+    }
 
     if (auto next_epoch_digest_res = getNextEpochDigest(block.header)) {
       auto &next_epoch_digest = next_epoch_digest_res.value();
@@ -227,24 +288,43 @@ namespace kagome::consensus {
     const auto &previous_best_block = previous_best_block_res.value();
 
     if (not block_already_exists) {
-      auto exec_start = std::chrono::high_resolution_clock::now();
-      SL_DEBUG(logger_,
-               "Execute block {}, state {}, a child of block {}, state {}",
-               primitives::BlockInfo(block.header.number, block_hash),
-               block.header.state_root,
-               primitives::BlockInfo(parent.number, block.header.parent_hash),
-               parent.state_root);
-
-      OUTCOME_TRY(core_->execute_block(block_without_seal_digest));
-
-      auto exec_end = std::chrono::high_resolution_clock::now();
-      auto duration_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
-                             exec_end - exec_start)
-                             .count();
-      SL_DEBUG(logger_, "Core_execute_block: {} ms", duration_ms);
-
-      metric_block_execution_time_->observe(static_cast<double>(duration_ms)
-                                            / 1000);
+      OUTCOME_TRY(execution_known,
+                  isExecutionKnown(block_hash, block.header, parent));
+      if (execution_known) {
+        SL_DEBUG(logger_,
+                 "Skip execution of block {}, its state {} is known",
+                 primitives::BlockInfo(block.header.number, block_hash),
+                 block.header.state_root);
+        // the changes of the last executed block must not be attributed to
+        // this one when it is added
+        OUTCOME_TRY(changes_tracker_->onBlockExecutionStart(
+            block.header.parent_hash, parent.number));
+        metric_block_execution_skipped_->inc();
+      } else {
+        auto exec_start = std::chrono::high_resolution_clock::now();
+        SL_DEBUG(
+            logger_,
+            "Execute block {}, state {}, a child of block {}, state {}",
+            primitives::BlockInfo(block.header.number, block_hash),
+            block.header.state_root,
+            primitives::BlockInfo(parent.number, block.header.parent_hash),
+            parent.state_root);
+
+        OUTCOME_TRY(core_->execute_block(block_without_seal_digest));
+
+        auto exec_end = std::chrono::high_resolution_clock::now();
+        auto duration_ms =
+            std::chrono::duration_cast<std::chrono::milliseconds>(exec_end
+                                                                  - exec_start)
+                .count();
+        SL_DEBUG(logger_, "Core_execute_block: {} ms", duration_ms);
+
+        metric_block_execution_time_->observe(static_cast<double>(duration_ms)
+                                              / 1000);
+
+        block_state_cache_->put(
+            block_hash, parent.state_root, block.header.state_root);
+      }
 
       // add block header if it does not exist
       OUTCOME_TRY(block_tree_->addBlock(block));
@@ -329,6 +409,145 @@ namespace kagome::consensus {
     return outcome::success();
   }
 
+  void BlockExecutorImpl::prepareBlock(const primitives::BlockData &b) {
+    if (not b.header.has_value() or not b.body.has_value()) {
+      return;
+    }
+    const auto &header = b.header.value();
+    auto block_hash = hasher_->blake2b_256(scale::encode(header).value());
+
+    {
+      std::lock_guard lock{prepared_blocks_mutex_};
+      if (prepared_blocks_.count(block_hash) != 0) {
+        return;
+      }
+      // forget the blocks which have been discarded instead of being applied
+      auto last_finalized_number = block_tree_->getLastFinalized().number;
+      for (auto it = prepared_blocks_.begin(); it != prepared_blocks_.end();) {
+        if (it->second.first <= last_finalized_number) {
+          it = prepared_blocks_.erase(it);
+        } else {
+          ++it;
+        }
+      }
+      if (prepared_blocks_.size() >= kMaxPreparedBlocks) {
+        return;
+      }
+    }
+
+    // The parent of the block is usually not applied yet, so the epoch
+    // descriptor is speculatively taken from the best block, if it is of the
+    // same epoch. The header is validated with it in background, and the
+    // result is used by applyBlock only if the actual validation params turn
+    // out to be the same. Near an epoch change the descriptor can not be
+    // determined that way, so the header is left to applyBlock, instead of
+    // failing the validation with a wrong randomness.
+    std::optional<HeaderValidationParams> validation_params;
+    if (auto babe_digests = getBabeDigests(header); babe_digests.has_value()) {
+      const auto &babe_header = babe_digests.value().second;
+      auto epoch_number = babe_util_->slotToEpoch(babe_header.slot_number);
+      auto epoch_res =
+          block_tree_->getEpochDigest(epoch_number, header.parent_hash);
+      if (epoch_res.has_error()) {
+        auto best_block = block_tree_->deepestLeaf();
+        auto best_header = block_tree_->getBlockHeader(best_block.hash);
+        if (best_header.has_value()) {
+          auto best_digests = getBabeDigests(best_header.value());
+          if (best_digests.has_value()
+              and babe_util_->slotToEpoch(
+                      best_digests.value().second.slot_number)
+                      == epoch_number) {
+            epoch_res =
+                block_tree_->getEpochDigest(epoch_number, best_block.hash);
+          }
+        }
+      }
+      if (epoch_res.has_value()
+          and babe_header.authority_index
+                  < epoch_res.value().authorities.size()) {
+        const auto &epoch = epoch_res.value();
+        validation_params = HeaderValidationParams{
+            epoch_number,
+            epoch.authorities[babe_header.authority_index].id,
+            calculateThreshold(babe_configuration_->leadership_rate,
+                               epoch.authorities,
+                               babe_header.authority_index),
+            epoch.randomness};
+      }
+    }
+
+    SL_TRACE(logger_,
+             "Prepare block {} for application",
+             primitives::BlockInfo(header.number, block_hash));
+    auto preparation = std::make_shared<std::packaged_task<PreparedBlock()>>(
+        [block_validator = block_validator_,
+         header = header,
+         body = b.body.value(),
+         validation_params = std::move(validation_params)] {
+          PreparedBlock prepared;
+          prepared.extrinsics_root_valid = extrinsicsRootMatches(header, body);
+          if (validation_params.has_value()
+              and block_validator
+                      ->validateHeader(header,
+                                       validation_params->epoch_number,
+                                       validation_params->authority_id,
+                                       validation_params->threshold,
+                                       validation_params->randomness)
+                      .has_value()) {
+            prepared.validated_with = validation_params;
+          }
+          return prepared;
+        });
+    auto prepared = preparation->get_future().share();
+    worker_pool_->post([preparation] { (*preparation)(); });
+
+    std::lock_guard lock{prepared_blocks_mutex_};
+    prepared_blocks_.emplace(
+        block_hash, std::make_pair(header.number, std::move(prepared)));
+  }
+
+  std::optional<BlockExecutorImpl::PreparedBlock>
+  BlockExecutorImpl::takePreparedBlock(
+      const primitives::BlockHash &block_hash) {
+    std::shared_future<PreparedBlock> prepared;
+    {
+      std::lock_guard lock{prepared_blocks_mutex_};
+      auto it = prepared_blocks_.find(block_hash);
+      if (it == prepared_blocks_.end()) {
+        return std::nullopt;
+      }
+      prepared = std::move(it->second.second);
+      prepared_blocks_.erase(it);
+    }
+    return prepared.get();
+  }
+
+  outcome::result<bool> BlockExecutorImpl::isExecutionKnown(
+      const primitives::BlockHash &block_hash,
+      const primitives::BlockHeader &header,
+      const primitives::BlockHeader &parent) const {
+    // the block hash commits to the parent and the state root, so the
+    // execution result is reused, unless the state has been pruned since
+    if (block_state_cache_->get(block_hash, parent.state_root)
+        != header.state_root) {
+      return false;
+    }
+    auto state = trie_storage_->getEphemeralBatchAt(header.state_root);
+    auto parent_state = trie_storage_->getEphemeralBatchAt(parent.state_root);
+    if (not state or not parent_state) {
+      return false;
+    }
+    // the runtime upgrade is announced by the changes tracker, which observes
+    // the execution, so a block changing the code is always executed
+    OUTCOME_TRY(code, state.value()->tryGet(storage::kRuntimeCodeKey));
+    OUTCOME_TRY(parent_code,
+                parent_state.value()->tryGet(storage::kRuntimeCodeKey));
+    if (code.has_value() != parent_code.has_value()) {
+      return false;
+    }
+    return not code.has_value() or code->get() == parent_code->get();
+  }
+
   void BlockExecutorImpl::rollbackBlock(
       const primitives::BlockHash &block_hash) {
     auto removal_res = block_tree_->removeLeaf(block_hash);
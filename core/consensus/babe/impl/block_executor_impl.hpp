@@ -8,12 +8,18 @@
 
 #include "consensus/babe/block_executor.hpp"
 
+#include <future>
+#include <mutex>
+#include <unordered_map>
+
 #include <libp2p/peer/peer_id.hpp>
 
 #include "blockchain/block_tree.hpp"
 #include "clock/timer.hpp"
+#include "common/worker_pool.hpp"
 #include "consensus/authority/authority_update_observer.hpp"
 #include "consensus/babe/babe_util.hpp"
+#include "consensus/babe/impl/block_state_cache.hpp"
 #include "consensus/grandpa/environment.hpp"
 #include "consensus/validation/block_validator.hpp"
 #include "crypto/hasher.hpp"
@@ -22,6 +28,8 @@
 #include "primitives/babe_configuration.hpp"
 #include "primitives/block_header.hpp"
 #include "runtime/runtime_api/core.hpp"
+#include "storage/changes_trie/changes_tracker.hpp"
+#include "storage/trie/trie_storage.hpp"
 #include "telemetry/service.hpp"
 #include "transaction_pool/transaction_pool.hpp"
 
@@ -35,7 +43,12 @@ namespace kagome::consensus {
       : public BlockExecutor,
         public std::enable_shared_from_this<BlockExecutorImpl> {
    public:
-    enum class Error { INVALID_BLOCK = 1, PARENT_NOT_FOUND, INTERNAL_ERROR };
+    enum class Error {
+      INVALID_BLOCK = 1,
+      PARENT_NOT_FOUND,
+      INTERNAL_ERROR,
+      INVALID_EXTRINSICS_ROOT
+    };
 
     BlockExecutorImpl(
         std::shared_ptr<blockchain::BlockTree> block_tree,
@@ -48,11 +61,58 @@ namespace kagome::consensus {
         std::shared_ptr<authority::AuthorityUpdateObserver>
             authority_update_observer,
         std::shared_ptr<BabeUtil> babe_util,
-        std::shared_ptr<runtime::OffchainWorkerApi> offchain_worker_api);
+        std::shared_ptr<runtime::OffchainWorkerApi> offchain_worker_api,
+        std::shared_ptr<BlockStateCache> block_state_cache,
+        std::shared_ptr<storage::trie::TrieStorage> trie_storage,
+        std::shared_ptr<storage::changes_trie::ChangesTracker> changes_tracker,
+        std::shared_ptr<common::WorkerPool> worker_pool);
 
     outcome::result<void> applyBlock(primitives::BlockData &&block) override;
 
+    void prepareBlock(const primitives::BlockData &block) override;
+
    private:
+    /// Arguments of BlockValidator::validateHeader, except for the header
+    struct HeaderValidationParams {
+      EpochNumber epoch_number;
+      primitives::AuthorityId authority_id;
+      Threshold threshold;
+      Randomness randomness;
+
+      bool operator==(const HeaderValidationParams &rhs) const {
+        return epoch_number == rhs.epoch_number
+               and authority_id == rhs.authority_id
+               and threshold == rhs.threshold and randomness == rhs.randomness;
+      }
+    };
+
+    /// Results of the stateless checks of a block done by prepareBlock
+    struct PreparedBlock {
+      bool extrinsics_root_valid = false;
+      /// the header has been successfully validated with these params,
+      /// speculatively taken from the block tree state at preparation
+      std::optional<HeaderValidationParams> validated_with;
+    };
+
+    /**
+     * @returns the results of the checks of the block with \arg block_hash
+     * started by prepareBlock, waiting for them if needed, or std::nullopt if
+     * the block has not been prepared
+     */
+    std::optional<PreparedBlock> takePreparedBlock(
+        const primitives::BlockHash &block_hash);
+
+    /**
+     * @returns true if the execution of the block with \arg header and \arg
+     * block_hash on top of \arg parent may be skipped: the block has already
+     * produced its state, which is still in the storage, and it has not
+     * upgraded the runtime, which is otherwise detected by the execution only
+     */
+    outcome::result<bool> isExecutionKnown(
+        const primitives::BlockHash &block_hash,
+        const primitives::BlockHeader &header,
+        const primitives::BlockHeader &parent) const;
+
     void rollbackBlock(const primitives::BlockHash &block_hash);
 
     std::shared_ptr<blockchain::BlockTree> block_tree_;
@@ -66,10 +126,21 @@ namespace kagome::consensus {
         authority_update_observer_;
     std::shared_ptr<BabeUtil> babe_util_;
     std::shared_ptr<runtime::OffchainWorkerApi> offchain_worker_api_;
+    std::shared_ptr<BlockStateCache> block_state_cache_;
+    std::shared_ptr<storage::trie::TrieStorage> trie_storage_;
+    std::shared_ptr<storage::changes_trie::ChangesTracker> changes_tracker_;
+    std::shared_ptr<common::WorkerPool> worker_pool_;
+
+    std::mutex prepared_blocks_mutex_;
+    std::unordered_map<primitives::BlockHash,
+                       std::pair<primitives::BlockNumber,
+                                 std::shared_future<PreparedBlock>>>
+        prepared_blocks_;
 
     // Metrics
     metrics::RegistryPtr metrics_registry_ = metrics::createRegistry();
     metrics::Histogram *metric_block_execution_time_;
+    metrics::Counter *metric_block_execution_skipped_;
 
     log::Logger logger_;
     telemetry::Telemetry telemetry_;
@@ -0,0 +1,38 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "consensus/babe/impl/block_state_cache.hpp"
+
+namespace kagome::consensus {
+
+  void BlockStateCache::put(const primitives::BlockHash &block_hash,
+                            const storage::trie::RootHash &parent_state,
+                            const storage::trie::RootHash &state) {
+    std::lock_guard lock{mutex_};
+    auto inserted =
+        entries_.insert_or_assign(block_hash, Entry{parent_state, state})
+            .second;
+    if (not inserted) {
+      return;
+    }
+    order_.push_back(block_hash);
+    if (order_.size() > kCapacity) {
+      entries_.erase(order_.front());
+      order_.pop_front();
+    }
+  }
+
+  std::optional<storage::trie::RootHash> BlockStateCache::get(
+      const primitives::BlockHash &block_hash,
+      const storage::trie::RootHash &parent_state) const {
+    std::lock_guard lock{mutex_};
+    auto it = entries_.find(block_hash);
+    if (it == entries_.end() or it->second.parent_state != parent_state) {
+      return std::nullopt;
+    }
+    return it->second.state;
+  }
+
+}  // namespace kagome::consensus
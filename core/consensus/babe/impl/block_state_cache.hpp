@@ -0,0 +1,60 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_CONSENSUS_BABE_BLOCKSTATECACHE
+#define KAGOME_CONSENSUS_BABE_BLOCKSTATECACHE
+
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+
+#include "primitives/common.hpp"
+#include "storage/trie/types.hpp"
+
+namespace kagome::consensus {
+
+  /**
+   * Remembers the post-state roots of the recently produced or executed
+   * blocks, so that a block already executed by this node is not executed
+   * once more when it is imported again, e.g. after it has been dropped from
+   * the block tree or when it comes back from the network
+   */
+  class BlockStateCache {
+   public:
+    /// Maximum number of the remembered blocks, the oldest ones are evicted
+    static constexpr size_t kCapacity = 256;
+
+    /**
+     * Remembers that the execution of the block with \arg block_hash on top
+     * of \arg parent_state has produced \arg state
+     */
+    void put(const primitives::BlockHash &block_hash,
+             const storage::trie::RootHash &parent_state,
+             const storage::trie::RootHash &state);
+
+    /**
+     * @returns the post-state root of the block with \arg block_hash if it has
+     * been executed on top of \arg parent_state, std::nullopt otherwise
+     */
+    std::optional<storage::trie::RootHash> get(
+        const primitives::BlockHash &block_hash,
+        const storage::trie::RootHash &parent_state) const;
+
+   private:
+    struct Entry {
+      storage::trie::RootHash parent_state;
+      storage::trie::RootHash state;
+    };
+
+    mutable std::mutex mutex_;
+    std::unordered_map<primitives::BlockHash, Entry> entries_;
+    // hashes of the remembered blocks in the order of insertion
+    std::deque<primitives::BlockHash> order_;
+  };
+
+}  // namespace kagome::consensus
+
+#endif  // KAGOME_CONSENSUS_BABE_BLOCKSTATECACHE
@@ -32,7 +32,8 @@ namespace kagome::consensus::grandpa {
       std::shared_ptr<authority::AuthorityManager> authority_manager,
       std::shared_ptr<network::Synchronizer> synchronizer,
       std::shared_ptr<network::PeerManager> peer_manager,
-      std::shared_ptr<blockchain::BlockTree> block_tree)
+      std::shared_ptr<blockchain::BlockTree> block_tree,
+      std::shared_ptr<common::WorkerPool> worker_pool)
       : environment_{std::move(environment)},
         crypto_provider_{std::move(crypto_provider)},
         grandpa_api_{std::move(grandpa_api)},
@@ -42,7 +43,8 @@ namespace kagome::consensus::grandpa {
         authority_manager_(std::move(authority_manager)),
         synchronizer_(std::move(synchronizer)),
         peer_manager_(std::move(peer_manager)),
-        block_tree_(std::move(block_tree)) {
+        block_tree_(std::move(block_tree)),
+        worker_pool_(std::move(worker_pool)) {
     BOOST_ASSERT(environment_ != nullptr);
     BOOST_ASSERT(crypto_provider_ != nullptr);
     BOOST_ASSERT(grandpa_api_ != nullptr);
@@ -52,6 +54,7 @@ namespace kagome::consensus::grandpa {
     BOOST_ASSERT(synchronizer_ != nullptr);
     BOOST_ASSERT(peer_manager_ != nullptr);
     BOOST_ASSERT(block_tree_ != nullptr);
+    BOOST_ASSERT(worker_pool_ != nullptr);
 
     BOOST_ASSERT(app_state_manager != nullptr);
 
@@ -136,7 +139,12 @@ namespace kagome::consensus::grandpa {
                                    : std::nullopt};
 
     auto vote_crypto_provider = std::make_shared<VoteCryptoProviderImpl>(
-        keypair_, crypto_provider_, round_state.round_number, config.voters);
+        keypair_,
+        crypto_provider_,
+        round_state.round_number,
+        config.voters,
+        verified_votes_,
+        worker_pool_);
 
     auto new_round = std::make_shared<VotingRoundImpl>(
         shared_from_this(),
@@ -196,7 +204,12 @@ namespace kagome::consensus::grandpa {
                                    : std::nullopt};
 
     auto vote_crypto_provider = std::make_shared<VoteCryptoProviderImpl>(
-        keypair_, crypto_provider_, new_round_number, config.voters);
+        keypair_,
+        crypto_provider_,
+        new_round_number,
+        config.voters,
+        verified_votes_,
+        worker_pool_);
 
     auto new_round = std::make_shared<VotingRoundImpl>(
         shared_from_this(),
@@ -13,8 +13,10 @@
 
 #include "application/app_state_manager.hpp"
 #include "blockchain/block_tree.hpp"
+#include "common/worker_pool.hpp"
 #include "consensus/authority/authority_manager.hpp"
 #include "consensus/grandpa/environment.hpp"
+#include "consensus/grandpa/impl/verified_vote_cache.hpp"
 #include "consensus/grandpa/impl/voting_round_impl.hpp"
 #include "consensus/grandpa/movable_round_state.hpp"
 #include "consensus/grandpa/voter_set.hpp"
@@ -51,7 +53,8 @@ namespace kagome::consensus::grandpa {
                 std::shared_ptr<authority::AuthorityManager> authority_manager,
                 std::shared_ptr<network::Synchronizer> synchronizer,
                 std::shared_ptr<network::PeerManager> peer_manager,
-                std::shared_ptr<blockchain::BlockTree> block_tree);
+                std::shared_ptr<blockchain::BlockTree> block_tree,
+                std::shared_ptr<common::WorkerPool> worker_pool);
 
     /** @see AppStateManager::takeControl */
     bool prepare();
@@ -124,6 +127,11 @@ namespace kagome::consensus::grandpa {
     std::shared_ptr<network::Synchronizer> synchronizer_;
     std::shared_ptr<network::PeerManager> peer_manager_;
     std::shared_ptr<blockchain::BlockTree> block_tree_;
+    std::shared_ptr<common::WorkerPool> worker_pool_;
+
+    /// Votes with verified signatures, shared by the rounds
+    std::shared_ptr<VerifiedVoteCache> verified_votes_ =
+        std::make_shared<VerifiedVoteCache>();
 
     // Metrics
     metrics::RegistryPtr metrics_registry_ = metrics::createRegistry();
@@ -0,0 +1,45 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "consensus/grandpa/impl/verified_vote_cache.hpp"
+
+#include <boost/assert.hpp>
+
+namespace kagome::consensus::grandpa {
+
+  VerifiedVoteCache::VerifiedVoteCache(size_t capacity) : capacity_{capacity} {
+    BOOST_ASSERT(capacity_ > 0);
+  }
+
+  bool VerifiedVoteCache::contains(const common::Buffer &key) {
+    std::lock_guard lock{mutex_};
+    auto it = index_.find(key);
+    if (it == index_.end()) {
+      return false;
+    }
+    entries_.splice(entries_.begin(), entries_, it->second);
+    return true;
+  }
+
+  void VerifiedVoteCache::put(common::Buffer key) {
+    std::lock_guard lock{mutex_};
+    if (auto it = index_.find(key); it != index_.end()) {
+      entries_.splice(entries_.begin(), entries_, it->second);
+      return;
+    }
+    if (entries_.size() >= capacity_) {
+      index_.erase(entries_.back());
+      entries_.pop_back();
+    }
+    entries_.push_front(std::move(key));
+    index_.emplace(entries_.front(), entries_.begin());
+  }
+
+  size_t VerifiedVoteCache::size() const {
+    std::lock_guard lock{mutex_};
+    return entries_.size();
+  }
+
+}  // namespace kagome::consensus::grandpa
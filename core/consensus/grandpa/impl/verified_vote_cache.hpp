@@ -0,0 +1,58 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_CORE_CONSENSUS_GRANDPA_IMPL_VERIFIED_VOTE_CACHE_HPP
+#define KAGOME_CORE_CONSENSUS_GRANDPA_IMPL_VERIFIED_VOTE_CACHE_HPP
+
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+#include "common/buffer.hpp"
+
+namespace kagome::consensus::grandpa {
+
+  /**
+   * Thread-safe LRU set of the votes, which signatures are known to be valid.
+   * A vote is identified by its signed payload (vote, round number and voter
+   * set id) together with the signature and the voter, so the same vote
+   * received from several peers or in several justifications is verified once
+   */
+  class VerifiedVoteCache final {
+   public:
+    static constexpr size_t kDefaultCapacity = 8192;
+
+    /**
+     * @param capacity maximum number of the remembered votes
+     */
+    explicit VerifiedVoteCache(size_t capacity = kDefaultCapacity);
+
+    /**
+     * @returns true if the vote with {@param key} was verified
+     */
+    bool contains(const common::Buffer &key);
+
+    /**
+     * Remembers the vote with {@param key} as verified, evicting the least
+     * recently used one if the cache is full
+     */
+    void put(common::Buffer key);
+
+    size_t size() const;
+
+   private:
+    using EntryList = std::list<common::Buffer>;
+
+    const size_t capacity_;
+
+    mutable std::mutex mutex_;
+    // the most recently used keys are in the front
+    EntryList entries_;
+    std::unordered_map<common::Buffer, EntryList::iterator> index_;
+  };
+
+}  // namespace kagome::consensus::grandpa
+
+#endif  // KAGOME_CORE_CONSENSUS_GRANDPA_IMPL_VERIFIED_VOTE_CACHE_HPP
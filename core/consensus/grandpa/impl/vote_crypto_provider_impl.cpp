@@ -5,6 +5,8 @@
 
 #include "consensus/grandpa/impl/vote_crypto_provider_impl.hpp"
 
+#include <algorithm>
+
 #include "primitives/common.hpp"
 #include "scale/scale.hpp"
 
@@ -14,11 +16,18 @@ namespace kagome::consensus::grandpa {
       const std::shared_ptr<crypto::Ed25519Keypair> &keypair,
       std::shared_ptr<kagome::crypto::Ed25519Provider> ed_provider,
       RoundNumber round_number,
-      std::shared_ptr<VoterSet> voter_set)
+      std::shared_ptr<VoterSet> voter_set,
+      std::shared_ptr<VerifiedVoteCache> verified_votes,
+      std::shared_ptr<common::WorkerPool> worker_pool)
       : keypair_{keypair},
         ed_provider_{std::move(ed_provider)},
         round_number_{round_number},
-        voter_set_{std::move(voter_set)} {}
+        voter_set_{std::move(voter_set)},
+        verified_votes_{std::move(verified_votes)},
+        worker_pool_{std::move(worker_pool)} {
+    BOOST_ASSERT(verified_votes_ != nullptr);
+    BOOST_ASSERT(worker_pool_ != nullptr);
+  }
 
   std::optional<SignedMessage> VoteCryptoProviderImpl::sign(Vote vote) const {
     if (not keypair_) {
@@ -35,9 +44,43 @@ namespace kagome::consensus::grandpa {
                                       RoundNumber number) const {
     auto payload =
         scale::encode(vote.message, round_number_, voter_set_->id()).value();
+    // the payload identifies the vote within the round and the voter set
+    common::Buffer key{payload};
+    key.put(vote.signature).put(vote.id);
+    if (verified_votes_->contains(key)) {
+      return true;
+    }
     auto verifying_result =
         ed_provider_->verify(vote.signature, payload, vote.id);
-    return verifying_result.has_value() and verifying_result.value();
+    if (verifying_result.has_value() and verifying_result.value()) {
+      verified_votes_->put(std::move(key));
+      return true;
+    }
+    return false;
+  }
+
+  template <typename SignedVote>
+  void VoteCryptoProviderImpl::preverifyVotes(
+      gsl::span<const SignedVote> votes) const {
+    // the votes are split into jobs run on the shared worker pool
+    auto size = static_cast<size_t>(votes.size());
+    auto jobs = (size + kVotesPerJob - 1) / kVotesPerJob;
+    worker_pool_->parallelFor(jobs, [&](size_t job) {
+      auto end = std::min(size, (job + 1) * kVotesPerJob);
+      for (auto i = job * kVotesPerJob; i < end; ++i) {
+        verify(votes[i], round_number_);
+      }
+    });
+  }
+
+  void VoteCryptoProviderImpl::preverify(
+      gsl::span<const SignedMessage> votes) const {
+    preverifyVotes(votes);
+  }
+
+  void VoteCryptoProviderImpl::preverifyPrecommits(
+      gsl::span<const SignedPrecommit> precommits) const {
+    preverifyVotes(precommits);
   }
 
   bool VoteCryptoProviderImpl::verifyPrimaryPropose(
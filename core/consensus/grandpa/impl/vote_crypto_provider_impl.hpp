@@ -7,6 +7,9 @@
 #define KAGOME_CORE_CONSENSUS_GRANDPA_IMPL_VOTE_CRYPTO_PROVIDER_IMPL_HPP
 
 #include "consensus/grandpa/vote_crypto_provider.hpp"
+
+#include "common/worker_pool.hpp"
+#include "consensus/grandpa/impl/verified_vote_cache.hpp"
 #include "consensus/grandpa/voter_set.hpp"
 #include "crypto/ed25519_provider.hpp"
 
@@ -16,17 +19,27 @@ namespace kagome::consensus::grandpa {
    public:
     ~VoteCryptoProviderImpl() override = default;
 
+    /**
+     * @param verified_votes cache of the verified votes shared by the rounds
+     * @param worker_pool threads that preverify the votes
+     */
     VoteCryptoProviderImpl(
         const std::shared_ptr<crypto::Ed25519Keypair> &keypair,
         std::shared_ptr<crypto::Ed25519Provider> ed_provider,
         RoundNumber round_number,
-        std::shared_ptr<VoterSet> voter_set);
+        std::shared_ptr<VoterSet> voter_set,
+        std::shared_ptr<VerifiedVoteCache> verified_votes,
+        std::shared_ptr<common::WorkerPool> worker_pool);
 
     bool verifyPrimaryPropose(
         const SignedMessage &primary_propose) const override;
     bool verifyPrevote(const SignedMessage &prevote) const override;
     bool verifyPrecommit(const SignedMessage &precommit) const override;
 
+    void preverify(gsl::span<const SignedMessage> votes) const override;
+    void preverifyPrecommits(
+        gsl::span<const SignedPrecommit> precommits) const override;
+
     std::optional<SignedMessage> signPrimaryPropose(
         const PrimaryPropose &primary_propose) const override;
     std::optional<SignedMessage> signPrevote(
@@ -37,11 +50,18 @@ namespace kagome::consensus::grandpa {
    private:
     std::optional<SignedMessage> sign(Vote vote) const;
     bool verify(const SignedMessage &vote, RoundNumber number) const;
+    template <typename SignedVote>
+    void preverifyVotes(gsl::span<const SignedVote> votes) const;
+
+    /// Votes verified by a single job of preverify()
+    static constexpr size_t kVotesPerJob = 16;
 
     const std::shared_ptr<crypto::Ed25519Keypair> &keypair_;
     std::shared_ptr<crypto::Ed25519Provider> ed_provider_;
     RoundNumber round_number_;
     std::shared_ptr<VoterSet> voter_set_;
+    std::shared_ptr<VerifiedVoteCache> verified_votes_;
+    std::shared_ptr<common::WorkerPool> worker_pool_;
   };
 
 }  // namespace kagome::consensus::grandpa
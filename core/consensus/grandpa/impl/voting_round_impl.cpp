@@ -165,6 +165,18 @@ namespace kagome::consensus::grandpa {
             [](auto...) {});
       };
 
+      std::vector<SignedMessage> votes;
+      for (auto &vote_variant : round_state.votes) {
+        visit_in_place(
+            vote_variant,
+            [&](const SignedMessage &vote) { votes.push_back(vote); },
+            [&](const EquivocatorySignedMessage &pair) {
+              votes.push_back(pair.first);
+              votes.push_back(pair.second);
+            });
+      }
+      vote_crypto_provider_->preverify(votes);
+
       for (auto &vote_variant : round_state.votes) {
         visit_in_place(
             vote_variant,
@@ -755,6 +767,9 @@ namespace kagome::consensus::grandpa {
     std::unordered_map<Id, BlockHash> validators;
     std::unordered_set<Id> equivocators;
 
+    // signatures of a justification are verified in parallel beforehand
+    vote_crypto_provider_->preverifyPrecommits(justification.items);
+
     for (const auto &signed_precommit : justification.items) {
       // Skip known equivocators
       if (auto index = voter_set_->voterIndex(signed_precommit.id);
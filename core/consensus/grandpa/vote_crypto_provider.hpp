@@ -6,6 +6,8 @@
 #ifndef KAGOME_CORE_CONSENSUS_GRANDPA_VOTE_CRYPTO_PROVIDER_HPP
 #define KAGOME_CORE_CONSENSUS_GRANDPA_VOTE_CRYPTO_PROVIDER_HPP
 
+#include <gsl/span>
+
 #include "consensus/grandpa/structs.hpp"
 
 namespace kagome::consensus::grandpa {
@@ -22,6 +24,19 @@ namespace kagome::consensus::grandpa {
     virtual bool verifyPrevote(const SignedMessage &prevote) const = 0;
     virtual bool verifyPrecommit(const SignedMessage &precommit) const = 0;
 
+    /**
+     * Verifies signatures of {@param votes} in parallel, so that the following
+     * verification of the valid ones does not repeat the crypto
+     */
+    virtual void preverify(gsl::span<const SignedMessage> votes) const = 0;
+
+    /**
+     * Verifies signatures of {@param precommits} of a justification in
+     * parallel, the same way as preverify()
+     */
+    virtual void preverifyPrecommits(
+        gsl::span<const SignedPrecommit> precommits) const = 0;
+
     virtual std::optional<SignedMessage> signPrimaryPropose(
         const PrimaryPropose &primary_propose) const = 0;
     virtual std::optional<SignedMessage> signPrevote(
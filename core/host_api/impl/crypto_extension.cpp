@@ -6,6 +6,7 @@
 #include "host_api/impl/crypto_extension.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <exception>
 
 #include <boost/assert.hpp>
@@ -68,7 +69,8 @@ namespace kagome::host_api {
       std::shared_ptr<const crypto::Secp256k1Provider> secp256k1_provider,
       std::shared_ptr<const crypto::Hasher> hasher,
       std::shared_ptr<crypto::CryptoStore> crypto_store,
-      std::shared_ptr<const crypto::Bip39Provider> bip39_provider)
+      std::shared_ptr<const crypto::Bip39Provider> bip39_provider,
+      std::shared_ptr<common::WorkerPool> worker_pool)
       : memory_provider_(std::move(memory_provider)),
         sr25519_provider_(std::move(sr25519_provider)),
         ecdsa_provider_(std::move(ecdsa_provider)),
@@ -77,6 +79,7 @@ namespace kagome::host_api {
         hasher_(std::move(hasher)),
         crypto_store_(std::move(crypto_store)),
         bip39_provider_(std::move(bip39_provider)),
+        worker_pool_(std::move(worker_pool)),
         logger_{log::createLogger("CryptoExtension", "crypto_extension")} {
     BOOST_ASSERT(memory_provider_ != nullptr);
     BOOST_ASSERT(sr25519_provider_ != nullptr);
@@ -86,6 +89,7 @@ namespace kagome::host_api {
     BOOST_ASSERT(hasher_ != nullptr);
     BOOST_ASSERT(crypto_store_ != nullptr);
     BOOST_ASSERT(bip39_provider_ != nullptr);
+    BOOST_ASSERT(worker_pool_ != nullptr);
     BOOST_ASSERT(logger_ != nullptr);
   }
 
@@ -94,7 +98,7 @@ namespace kagome::host_api {
   runtime::WasmPointer CryptoExtension::ext_hashing_keccak_256_version_1(
       runtime::WasmSpan data) {
     auto [addr, len] = runtime::PtrSize(data);
-    const auto &buf = getMemory().loadN(addr, len);
+    auto buf = getMemory().view(addr, len);
     auto hash = hasher_->keccak_256(buf);
 
     SL_TRACE_FUNC_CALL(logger_, hash, buf);
@@ -105,7 +109,7 @@ namespace kagome::host_api {
   runtime::WasmPointer CryptoExtension::ext_hashing_sha2_256_version_1(
       runtime::WasmSpan data) {
     auto [addr, len] = runtime::PtrSize(data);
-    const auto &buf = getMemory().loadN(addr, len);
+    auto buf = getMemory().view(addr, len);
     auto hash = hasher_->sha2_256(buf);
     SL_TRACE_FUNC_CALL(logger_, hash, buf);
 
@@ -115,7 +119,7 @@ namespace kagome::host_api {
   runtime::WasmPointer CryptoExtension::ext_hashing_blake2_128_version_1(
       runtime::WasmSpan data) {
     auto [addr, len] = runtime::PtrSize(data);
-    const auto &buf = getMemory().loadN(addr, len);
+    auto buf = getMemory().view(addr, len);
     auto hash = hasher_->blake2b_128(buf);
     SL_TRACE_FUNC_CALL(logger_, hash, buf);
 
@@ -125,7 +129,7 @@ namespace kagome::host_api {
   runtime::WasmPointer CryptoExtension::ext_hashing_blake2_256_version_1(
       runtime::WasmSpan data) {
     auto [addr, len] = runtime::PtrSize(data);
-    const auto &buf = getMemory().loadN(addr, len);
+    auto buf = getMemory().view(addr, len);
     auto hash = hasher_->blake2b_256(buf);
     SL_TRACE_FUNC_CALL(logger_, hash, buf);
 
@@ -135,7 +139,7 @@ namespace kagome::host_api {
   runtime::WasmPointer CryptoExtension::ext_hashing_twox_64_version_1(
       runtime::WasmSpan data) {
     auto [addr, len] = runtime::PtrSize(data);
-    const auto &buf = getMemory().loadN(addr, len);
+    auto buf = getMemory().view(addr, len);
     auto hash = hasher_->twox_64(buf);
     SL_TRACE_FUNC_CALL(logger_, hash, buf);
 
@@ -145,7 +149,7 @@ namespace kagome::host_api {
   runtime::WasmPointer CryptoExtension::ext_hashing_twox_128_version_1(
       runtime::WasmSpan data) {
     auto [addr, len] = runtime::PtrSize(data);
-    const auto &buf = getMemory().loadN(addr, len);
+    auto buf = getMemory().view(addr, len);
     auto hash = hasher_->twox_128(buf);
     SL_TRACE_FUNC_CALL(logger_, hash, buf);
 
@@ -155,21 +159,59 @@ namespace kagome::host_api {
   runtime::WasmPointer CryptoExtension::ext_hashing_twox_256_version_1(
       runtime::WasmSpan data) {
     auto [ptr, size] = runtime::PtrSize(data);
-    const auto &buf = getMemory().loadN(ptr, size);
+    auto buf = getMemory().view(ptr, size);
     auto hash = hasher_->twox_256(buf);
     SL_TRACE_FUNC_CALL(logger_, hash, buf);
 
     return getMemory().storeBuffer(hash);
   }
 
+  void CryptoExtension::reset() {
+    batch_verify_.reset();
+  }
+
+  int32_t CryptoExtension::verifyOrPushToBatch(
+      gsl::span<const uint8_t> message,
+      std::function<bool(gsl::span<const uint8_t>)> verify) {
+    if (batch_verify_.has_value()) {
+      // the wasm memory may change till the end of the batch
+      batch_verify_->emplace_back(
+          [verify = std::move(verify), message = common::Buffer{message}] {
+            return verify(message);
+          });
+      return kVerifySuccess;
+    }
+    return verify(message) ? kVerifySuccess : kVerifyFail;
+  }
+
   void CryptoExtension::ext_crypto_start_batch_verify_version_1() {
-    // TODO (kamilsa) 05.07.21 https://github.com/soramitsu/kagome/issues/804
+    if (batch_verify_.has_value()) {
+      throw_with_error(logger_, "Previous batch verification is not finished");
+    }
+    batch_verify_.emplace();
+    SL_TRACE_VOID_FUNC_CALL(logger_);
   }
 
   runtime::WasmSize
   CryptoExtension::ext_crypto_finish_batch_verify_version_1() {
-    // TODO (kamilsa) 05.07.21 https://github.com/soramitsu/kagome/issues/804
-    return kVerifyBatchSuccess;
+    if (not batch_verify_.has_value()) {
+      throw_with_error(logger_, "No batch verification was started");
+    }
+    auto batch = std::move(batch_verify_.value());
+    batch_verify_.reset();
+
+    // the batch is verified on the shared worker pool, the signatures left
+    // unchecked once an invalid one is found are skipped
+    std::atomic_bool valid{true};
+    worker_pool_->parallelFor(batch.size(), [&](size_t i) {
+      if (valid and not batch[i]()) {
+        valid = false;
+      }
+    });
+
+    auto res = valid ? kVerifyBatchSuccess : kVerifyBatchFail;
+    SL_TRACE_FUNC_CALL(logger_, res, batch.size());
+    return res;
   }
 
   runtime::WasmSpan CryptoExtension::ext_crypto_ed25519_public_keys_version_1(
@@ -239,7 +281,7 @@ namespace kagome::host_api {
     checkIfKeyIsSupported(key_type_id, logger_);
 
     auto [seed_ptr, seed_len] = runtime::PtrSize(seed);
-    auto seed_buffer = getMemory().loadN(seed_ptr, seed_len);
+    auto seed_buffer = getMemory().view(seed_ptr, seed_len);
     auto seed_res = scale::decode<std::optional<std::string>>(seed_buffer);
     if (!seed_res) {
       throw_with_error(logger_, "failed to decode seed");
@@ -275,9 +317,9 @@ namespace kagome::host_api {
     checkIfKeyIsSupported(key_type_id, logger_);
 
     auto public_buffer =
-        getMemory().loadN(key, crypto::Ed25519PublicKey::size());
+        getMemory().view(key, crypto::Ed25519PublicKey::size());
     auto [msg_data, msg_len] = runtime::PtrSize(msg);
-    auto msg_buffer = getMemory().loadN(msg_data, msg_len);
+    auto msg_buffer = getMemory().view(msg_data, msg_len);
     auto pk = crypto::Ed25519PublicKey::fromSpan(public_buffer);
     if (!pk) {
       BOOST_UNREACHABLE_RETURN({});
@@ -306,9 +348,8 @@ namespace kagome::host_api {
       runtime::WasmSpan msg_span,
       runtime::WasmPointer pubkey_data) {
     auto [msg_data, msg_len] = runtime::PtrSize(msg_span);
-    auto msg = getMemory().loadN(msg_data, msg_len);
-    auto sig_bytes =
-        getMemory().loadN(sig, ed25519_constants::SIGNATURE_SIZE).toVector();
+    auto msg = getMemory().view(msg_data, msg_len);
+    auto sig_bytes = getMemory().view(sig, ed25519_constants::SIGNATURE_SIZE);
 
     auto signature_res = crypto::Ed25519Signature::fromSpan(sig_bytes);
     if (!signature_res) {
@@ -316,18 +357,18 @@ namespace kagome::host_api {
     }
     auto &&signature = signature_res.value();
 
-    auto pubkey_bytes = getMemory()
-                            .loadN(pubkey_data, ed25519_constants::PUBKEY_SIZE)
-                            .toVector();
+    auto pubkey_bytes =
+        getMemory().view(pubkey_data, ed25519_constants::PUBKEY_SIZE);
     auto pubkey_res = crypto::Ed25519PublicKey::fromSpan(pubkey_bytes);
     if (!pubkey_res) {
       BOOST_UNREACHABLE_RETURN(kVerifyFail);
     }
     auto pubkey = pubkey_res.value();
 
-    auto verify_res = ed25519_provider_->verify(signature, msg, pubkey);
-
-    auto res = verify_res && verify_res.value() ? kVerifySuccess : kVerifyFail;
+    auto res = verifyOrPushToBatch(msg, [this, signature, pubkey](auto msg) {
+      auto verify_res = ed25519_provider_->verify(signature, msg, pubkey);
+      return verify_res and verify_res.value();
+    });
 
     SL_TRACE_FUNC_CALL(logger_, res, signature, msg, pubkey);
     return res;
@@ -362,7 +403,7 @@ namespace kagome::host_api {
     checkIfKeyIsSupported(key_type_id, logger_);
 
     auto [seed_ptr, seed_len] = runtime::PtrSize(seed);
-    auto seed_buffer = getMemory().loadN(seed_ptr, seed_len);
+    auto seed_buffer = getMemory().view(seed_ptr, seed_len);
     auto seed_res = scale::decode<std::optional<std::string>>(seed_buffer);
     if (!seed_res) {
       throw_with_error(logger_, "failed to decode seed");
@@ -404,9 +445,9 @@ namespace kagome::host_api {
     checkIfKeyIsSupported(key_type_id, logger_);
 
     auto public_buffer =
-        getMemory().loadN(key, crypto::Sr25519PublicKey::size());
+        getMemory().view(key, crypto::Sr25519PublicKey::size());
     auto [msg_data, msg_len] = runtime::PtrSize(msg);
-    auto msg_buffer = getMemory().loadN(msg_data, msg_len);
+    auto msg_buffer = getMemory().view(msg_data, msg_len);
     auto pk = crypto::Sr25519PublicKey::fromSpan(public_buffer);
     if (!pk) {
       // error is not possible, since we loaded correct number of bytes
@@ -438,12 +479,12 @@ namespace kagome::host_api {
     // TODO(Harrm): this should support deprecated signatures from schnorrkel
     // 0.1.1 in contrary to version_2
     auto [msg_data, msg_len] = runtime::PtrSize(msg_span);
-    auto msg = getMemory().loadN(msg_data, msg_len);
+    auto msg = getMemory().view(msg_data, msg_len);
     auto signature_buffer =
-        getMemory().loadN(sig, sr25519_constants::SIGNATURE_SIZE);
+        getMemory().view(sig, sr25519_constants::SIGNATURE_SIZE);
 
     auto pubkey_buffer =
-        getMemory().loadN(pubkey_data, sr25519_constants::PUBLIC_SIZE);
+        getMemory().view(pubkey_data, sr25519_constants::PUBLIC_SIZE);
     auto key_res = crypto::Sr25519PublicKey::fromSpan(pubkey_buffer);
     if (!key_res) {
       BOOST_UNREACHABLE_RETURN(kVerifyFail)
@@ -455,9 +496,11 @@ namespace kagome::host_api {
                 sr25519_constants::SIGNATURE_SIZE,
                 signature.begin());
 
-    auto verify_res = sr25519_provider_->verify_deprecated(signature, msg, key);
-
-    auto res = verify_res && verify_res.value() ? kVerifySuccess : kVerifyFail;
+    auto res = verifyOrPushToBatch(msg, [this, signature, key](auto msg) {
+      auto verify_res =
+          sr25519_provider_->verify_deprecated(signature, msg, key);
+      return verify_res and verify_res.value();
+    });
 
     SL_TRACE_FUNC_CALL(logger_, res, signature, msg, pubkey_buffer);
     return res;
@@ -506,8 +549,8 @@ namespace kagome::host_api {
     constexpr auto signature_size = RSVSignature::size();
     constexpr auto message_size = MessageHash::size();
 
-    auto sig_buffer = getMemory().loadN(sig, signature_size);
-    auto msg_buffer = getMemory().loadN(msg, message_size);
+    auto sig_buffer = getMemory().view(sig, signature_size);
+    auto msg_buffer = getMemory().view(msg, message_size);
 
     auto signature = RSVSignature::fromSpan(sig_buffer).value();
     auto message = MessageHash::fromSpan(msg_buffer).value();
@@ -547,8 +590,8 @@ namespace kagome::host_api {
     constexpr auto signature_size = RSVSignature::size();
     constexpr auto message_size = MessageHash::size();
 
-    auto sig_buffer = getMemory().loadN(sig, signature_size);
-    auto msg_buffer = getMemory().loadN(msg, message_size);
+    auto sig_buffer = getMemory().view(sig, signature_size);
+    auto msg_buffer = getMemory().view(msg, message_size);
 
     auto signature = RSVSignature::fromSpan(sig_buffer).value();
     auto message = MessageHash::fromSpan(msg_buffer).value();
@@ -602,9 +645,9 @@ namespace kagome::host_api {
         static_cast<crypto::KeyTypeId>(getMemory().load32u(key_type));
     checkIfKeyIsSupported(key_type_id, logger_);
 
-    auto public_buffer = getMemory().loadN(key, sizeof(crypto::EcdsaPublicKey));
+    auto public_buffer = getMemory().view(key, sizeof(crypto::EcdsaPublicKey));
     auto [msg_data, msg_len] = runtime::PtrSize(msg);
-    auto msg_buffer = getMemory().loadN(msg_data, msg_len);
+    auto msg_buffer = getMemory().view(msg_data, msg_len);
 
     crypto::EcdsaPublicKey pk;
     std::copy(public_buffer.begin(), public_buffer.end(), pk.begin());
@@ -637,9 +680,9 @@ namespace kagome::host_api {
         static_cast<crypto::KeyTypeId>(getMemory().load32u(key_type));
     checkIfKeyIsSupported(key_type_id, logger_);
 
-    auto public_buffer = getMemory().loadN(key, sizeof(crypto::EcdsaPublicKey));
+    auto public_buffer = getMemory().view(key, sizeof(crypto::EcdsaPublicKey));
     auto [msg_data, msg_len] = runtime::PtrSize(msg);
-    auto msg_buffer = getMemory().loadN(msg_data, msg_len);
+    auto msg_buffer = getMemory().view(msg_data, msg_len);
 
     crypto::EcdsaPublicKey pk;
     std::copy(public_buffer.begin(), public_buffer.end(), pk.begin());
@@ -672,7 +715,7 @@ namespace kagome::host_api {
     checkIfKeyIsSupported(key_type_id, logger_);
 
     auto [seed_ptr, seed_len] = runtime::PtrSize(seed);
-    auto seed_buffer = getMemory().loadN(seed_ptr, seed_len);
+    auto seed_buffer = getMemory().view(seed_ptr, seed_len);
     auto seed_res = scale::decode<std::optional<std::string>>(seed_buffer);
     if (!seed_res) {
       throw_with_error(logger_, "failed to decode seed");
@@ -704,23 +747,24 @@ namespace kagome::host_api {
   int32_t CryptoExtension::ext_crypto_ecdsa_verify_version_1(
       runtime::WasmPointer sig,
       runtime::WasmSpan msg_span,
-      runtime::WasmPointer pubkey_data) const {
+      runtime::WasmPointer pubkey_data) {
     auto [msg_data, msg_len] = runtime::PtrSize(msg_span);
-    auto msg = getMemory().loadN(msg_data, msg_len);
+    auto msg = getMemory().view(msg_data, msg_len);
     auto signature =
         getMemory().loadN(sig, ecdsa_constants::SIGNATURE_SIZE).toVector();
 
     auto pubkey_buffer =
-        getMemory().loadN(pubkey_data, ecdsa_constants::PUBKEY_SIZE);
+        getMemory().view(pubkey_data, ecdsa_constants::PUBKEY_SIZE);
     auto key_res = crypto::EcdsaPublicKey::fromSpan(pubkey_buffer);
     if (!key_res) {
       BOOST_UNREACHABLE_RETURN(kVerifyFail)
     }
     auto &&pubkey = key_res.value();
 
-    auto verify_res = ecdsa_provider_->verify(msg, signature, pubkey);
-
-    auto res = verify_res && verify_res.value() ? kVerifySuccess : kVerifyFail;
+    auto res = verifyOrPushToBatch(msg, [this, signature, pubkey](auto msg) {
+      auto verify_res = ecdsa_provider_->verify(msg, signature, pubkey);
+      return verify_res and verify_res.value();
+    });
 
     SL_TRACE_FUNC_CALL(logger_, res, signature, msg, pubkey);
     return res;
@@ -729,14 +773,14 @@ namespace kagome::host_api {
   int32_t CryptoExtension::ext_crypto_ecdsa_verify_prehashed_version_1(
       runtime::WasmPointer sig,
       runtime::WasmSpan msg_span,
-      runtime::WasmPointer pubkey_data) const {
+      runtime::WasmPointer pubkey_data) {
     auto [msg_data, msg_len] = runtime::PtrSize(msg_span);
-    auto msg = getMemory().loadN(msg_data, msg_len);
+    auto msg = getMemory().view(msg_data, msg_len);
     auto signature =
         getMemory().loadN(sig, ecdsa_constants::SIGNATURE_SIZE).toVector();
 
     auto pubkey_buffer =
-        getMemory().loadN(pubkey_data, ecdsa_constants::PUBKEY_SIZE);
+        getMemory().view(pubkey_data, ecdsa_constants::PUBKEY_SIZE);
     auto key_res = crypto::EcdsaPublicKey::fromSpan(pubkey_buffer);
     if (!key_res) {
       BOOST_UNREACHABLE_RETURN(kVerifyFail)
@@ -746,10 +790,12 @@ namespace kagome::host_api {
     crypto::EcdsaPrehashedMessage digest;
     std::copy(msg.begin(), msg.end(), digest.begin());
 
-    auto verify_res =
-        ecdsa_provider_->verifyPrehashed(digest, signature, pubkey);
-
-    auto res = verify_res && verify_res.value() ? kVerifySuccess : kVerifyFail;
+    auto res = verifyOrPushToBatch(digest, [this, signature, pubkey](auto msg) {
+      auto digest = crypto::EcdsaPrehashedMessage::fromSpan(msg).value();
+      auto verify_res =
+          ecdsa_provider_->verifyPrehashed(digest, signature, pubkey);
+      return verify_res and verify_res.value();
+    });
 
     SL_TRACE_FUNC_CALL(logger_, res, signature, msg, pubkey);
     return res;
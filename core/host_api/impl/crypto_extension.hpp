@@ -6,10 +6,13 @@
 #ifndef KAGOME_CRYPTO_EXTENSION_HPP
 #define KAGOME_CRYPTO_EXTENSION_HPP
 
+#include <functional>
 #include <future>
 #include <optional>
 #include <queue>
+#include <vector>
 
+#include "common/worker_pool.hpp"
 #include "crypto/bip39/bip39_types.hpp"
 #include "crypto/crypto_store.hpp"
 #include "log/logger.hpp"
@@ -45,7 +48,8 @@ namespace kagome::host_api {
         std::shared_ptr<const crypto::Secp256k1Provider> secp256k1_provider,
         std::shared_ptr<const crypto::Hasher> hasher,
         std::shared_ptr<crypto::CryptoStore> crypto_store,
-        std::shared_ptr<const crypto::Bip39Provider> bip39_provider);
+        std::shared_ptr<const crypto::Bip39Provider> bip39_provider,
+        std::shared_ptr<common::WorkerPool> worker_pool);
 
     // -------------------- hashing methods v1 --------------------
 
@@ -87,10 +91,21 @@ namespace kagome::host_api {
      */
     runtime::WasmPointer ext_hashing_twox_256_version_1(runtime::WasmSpan data);
 
+    /**
+     * Drops the verifications of an unfinished batch, if any
+     */
+    void reset();
+
     // -------------------- crypto methods v1 --------------------
 
+    /**
+     * @see HostApi::ext_crypto_start_batch_verify_version_1
+     */
     void ext_crypto_start_batch_verify_version_1();
 
+    /**
+     * @see HostApi::ext_crypto_finish_batch_verify_version_1
+     */
     [[nodiscard]] runtime::WasmSize ext_crypto_finish_batch_verify_version_1();
 
     /**
@@ -199,7 +214,7 @@ namespace kagome::host_api {
      */
     int32_t ext_crypto_ecdsa_verify_version_1(runtime::WasmPointer sig,
                                               runtime::WasmSpan msg,
-                                              runtime::WasmPointer key) const;
+                                              runtime::WasmPointer key);
 
     /**
      * @see HostApi::ext_crypto_ecdsa_verify_prehashed_version_1
@@ -207,11 +222,24 @@ namespace kagome::host_api {
     int32_t ext_crypto_ecdsa_verify_prehashed_version_1(
         runtime::WasmPointer sig,
         runtime::WasmSpan msg,
-        runtime::WasmPointer key) const;
+        runtime::WasmPointer key);
 
    private:
     common::Blob<32> deriveSeed(std::string_view content);
 
+    /**
+     * Runs the verification, unless a batch is started, in which case the
+     * verification is deferred till the end of the batch
+     * @param message signed message viewed in the wasm memory, which is only
+     * copied if the verification is deferred
+     * @param verify checks a signature of the message
+     * @returns the result of the verification or kVerifySuccess if it is
+     * deferred
+     */
+    int32_t verifyOrPushToBatch(
+        gsl::span<const uint8_t> message,
+        std::function<bool(gsl::span<const uint8_t>)> verify);
+
     runtime::Memory &getMemory() const {
       return memory_provider_->getCurrentMemory()->get();
     }
@@ -224,6 +252,9 @@ namespace kagome::host_api {
     std::shared_ptr<const crypto::Hasher> hasher_;
     std::shared_ptr<crypto::CryptoStore> crypto_store_;
     std::shared_ptr<const crypto::Bip39Provider> bip39_provider_;
+    std::shared_ptr<common::WorkerPool> worker_pool_;
+    // verifications deferred till the end of the started batch
+    std::optional<std::vector<std::function<bool()>>> batch_verify_;
     log::Logger logger_;
   };
 }  // namespace kagome::host_api
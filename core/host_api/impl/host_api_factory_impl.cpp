@@ -21,7 +21,8 @@ namespace kagome::host_api {
       std::shared_ptr<crypto::Bip39Provider> bip39_provider,
       std::shared_ptr<offchain::OffchainPersistentStorage>
           offchain_persistent_storage,
-      std::shared_ptr<offchain::OffchainWorkerPool> offchain_worker_pool)
+      std::shared_ptr<offchain::OffchainWorkerPool> offchain_worker_pool,
+      std::shared_ptr<common::WorkerPool> worker_pool)
       : offchain_config_(offchain_config),
         changes_tracker_{std::move(tracker)},
         sr25519_provider_(std::move(sr25519_provider)),
@@ -32,7 +33,8 @@ namespace kagome::host_api {
         crypto_store_(std::move(crypto_store)),
         bip39_provider_(std::move(bip39_provider)),
         offchain_persistent_storage_(std::move(offchain_persistent_storage)),
-        offchain_worker_pool_(std::move(offchain_worker_pool)) {
+        offchain_worker_pool_(std::move(offchain_worker_pool)),
+        worker_pool_(std::move(worker_pool)) {
     BOOST_ASSERT(changes_tracker_ != nullptr);
     BOOST_ASSERT(sr25519_provider_ != nullptr);
     BOOST_ASSERT(ed25519_provider_ != nullptr);
@@ -42,6 +44,7 @@ namespace kagome::host_api {
     BOOST_ASSERT(bip39_provider_ != nullptr);
     BOOST_ASSERT(offchain_persistent_storage_ != nullptr);
     BOOST_ASSERT(offchain_worker_pool_ != nullptr);
+    BOOST_ASSERT(worker_pool_ != nullptr);
   }
 
   std::unique_ptr<HostApi> HostApiFactoryImpl::make(
@@ -61,7 +64,8 @@ namespace kagome::host_api {
                                          crypto_store_,
                                          bip39_provider_,
                                          offchain_persistent_storage_,
-                                         offchain_worker_pool_);
+                                         offchain_worker_pool_,
+                                         worker_pool_);
   }
 
 }  // namespace kagome::host_api
@@ -8,6 +8,7 @@
 
 #include "host_api/host_api_factory.hpp"
 
+#include "common/worker_pool.hpp"
 #include "crypto/bip39/bip39_provider.hpp"
 #include "crypto/crypto_store.hpp"
 #include "crypto/ecdsa_provider.hpp"
@@ -41,7 +42,8 @@ namespace kagome::host_api {
         std::shared_ptr<crypto::Bip39Provider> bip39_provider,
         std::shared_ptr<offchain::OffchainPersistentStorage>
             offchain_persistent_storage,
-        std::shared_ptr<offchain::OffchainWorkerPool> offchain_worker_pool);
+        std::shared_ptr<offchain::OffchainWorkerPool> offchain_worker_pool,
+        std::shared_ptr<common::WorkerPool> worker_pool);
 
     std::unique_ptr<HostApi> make(
         std::shared_ptr<const runtime::CoreApiFactory> core_factory,
@@ -62,6 +64,7 @@ namespace kagome::host_api {
     std::shared_ptr<offchain::OffchainPersistentStorage>
         offchain_persistent_storage_;
     std::shared_ptr<offchain::OffchainWorkerPool> offchain_worker_pool_;
+    std::shared_ptr<common::WorkerPool> worker_pool_;
   };
 
 }  // namespace kagome::host_api
@@ -33,7 +33,8 @@ namespace kagome::host_api {
       std::shared_ptr<const crypto::Bip39Provider> bip39_provider,
       std::shared_ptr<offchain::OffchainPersistentStorage>
           offchain_persistent_storage,
-      std::shared_ptr<offchain::OffchainWorkerPool> offchain_worker_pool)
+      std::shared_ptr<offchain::OffchainWorkerPool> offchain_worker_pool,
+      std::shared_ptr<common::WorkerPool> worker_pool)
       : memory_provider_([&] {
           BOOST_ASSERT(memory_provider);
           return std::move(memory_provider);
@@ -49,7 +50,8 @@ namespace kagome::host_api {
                     std::move(secp256k1_provider),
                     hasher,
                     std::move(crypto_store),
-                    std::move(bip39_provider)),
+                    std::move(bip39_provider),
+                    std::move(worker_pool)),
         io_ext_(memory_provider_),
         memory_ext_(memory_provider_),
         misc_ext_{DEFAULT_CHAIN_ID,
@@ -65,6 +67,7 @@ namespace kagome::host_api {
 
   void HostApiImpl::reset() {
     storage_ext_.reset();
+    crypto_ext_.reset();
   }
 
   runtime::WasmSpan HostApiImpl::ext_storage_read_version_1(
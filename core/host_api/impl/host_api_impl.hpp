@@ -48,7 +48,8 @@ namespace kagome::host_api {
         std::shared_ptr<const crypto::Bip39Provider> bip39_provider,
         std::shared_ptr<offchain::OffchainPersistentStorage>
             offchain_persistent_storage,
-        std::shared_ptr<offchain::OffchainWorkerPool> offchain_worker_pool);
+        std::shared_ptr<offchain::OffchainWorkerPool> offchain_worker_pool,
+        std::shared_ptr<common::WorkerPool> worker_pool);
 
     ~HostApiImpl() override = default;
 
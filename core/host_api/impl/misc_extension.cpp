@@ -34,7 +34,7 @@ namespace kagome::host_api {
     auto [ptr, len] = runtime::splitSpan(data);
     auto &memory = memory_provider_->getCurrentMemory()->get();
 
-    auto code = memory.loadN(ptr, len);
+    auto code = memory.view(ptr, len);
     common::Buffer uncompressed_code;
     auto uncompress_res =
         runtime::uncompressCodeIfNeeded(code, uncompressed_code);
@@ -73,7 +73,8 @@ namespace kagome::host_api {
   void MiscExtension::ext_misc_print_hex_version_1(
       runtime::WasmSpan data) const {
     auto [ptr, len] = runtime::splitSpan(data);
-    auto buf = memory_provider_->getCurrentMemory()->get().loadN(ptr, len);
+    common::BufferView buf =
+        memory_provider_->getCurrentMemory()->get().view(ptr, len);
     logger_->info("hex: {}", buf.toHex());
   }
 
@@ -84,8 +85,11 @@ namespace kagome::host_api {
   void MiscExtension::ext_misc_print_utf8_version_1(
       runtime::WasmSpan data) const {
     auto [ptr, len] = runtime::splitSpan(data);
-    auto buf = memory_provider_->getCurrentMemory()->get().loadN(ptr, len);
-    logger_->info("utf8: {}", buf.toString());
+    auto buf = memory_provider_->getCurrentMemory()->get().view(ptr, len);
+    logger_->info(
+        "utf8: {}",
+        std::string_view{reinterpret_cast<const char *>(buf.data()),
+                         static_cast<size_t>(buf.size())});
   }
 
 }  // namespace kagome::host_api
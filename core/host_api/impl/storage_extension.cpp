@@ -78,7 +78,7 @@ namespace kagome::host_api {
     auto value = runtime::PtrSize(value_out);
     auto &memory = memory_provider_->getCurrentMemory()->get();
 
-    auto key = memory.loadN(key_ptr, key_size);
+    common::BufferView key = memory.view(key_ptr, key_size);
     std::optional<uint32_t> res{std::nullopt};
     if (auto data_opt_res = get(key); data_opt_res.has_value()) {
       auto &data_opt = data_opt_res.value();
@@ -116,7 +116,7 @@ namespace kagome::host_api {
   }
 
   outcome::result<std::optional<Buffer>> StorageExtension::getStorageNextKey(
-      const common::Buffer &key) const {
+      const common::BufferView &key) const {
     auto batch = storage_provider_->getCurrentBatch();
     auto cursor = batch->trieCursor();
     OUTCOME_TRY(cursor->seekUpperBound(key));
@@ -128,13 +128,13 @@ namespace kagome::host_api {
     auto [key_ptr, key_size] = runtime::PtrSize(key_span);
     auto [value_ptr, value_size] = runtime::PtrSize(value_span);
     auto &memory = memory_provider_->getCurrentMemory()->get();
-    auto key = memory.loadN(key_ptr, key_size);
-    auto value = memory.loadN(value_ptr, value_size);
+    common::BufferView key = memory.view(key_ptr, key_size);
+    common::BufferView value = memory.view(value_ptr, value_size);
 
     SL_TRACE_VOID_FUNC_CALL(logger_, key, value);
 
     auto batch = storage_provider_->getCurrentBatch();
-    auto put_result = batch->put(key, value);
+    auto put_result = batch->put(key, common::Buffer{value});
     if (not put_result) {
       logger_->error(
           "ext_set_storage failed, due to fail in trie db with reason: {}",
@@ -146,7 +146,7 @@ namespace kagome::host_api {
       runtime::WasmSpan key) {
     auto [key_ptr, key_size] = runtime::PtrSize(key);
     auto &memory = memory_provider_->getCurrentMemory()->get();
-    auto key_buffer = memory.loadN(key_ptr, key_size);
+    common::BufferView key_buffer = memory.view(key_ptr, key_size);
 
     constexpr auto error_message =
         "ext_storage_get_version_1( {} ) => value was not obtained. Reason: {}";
@@ -170,7 +170,7 @@ namespace kagome::host_api {
     auto [key_ptr, key_size] = runtime::PtrSize(key_data);
     auto batch = storage_provider_->getCurrentBatch();
     auto &memory = memory_provider_->getCurrentMemory()->get();
-    auto key = memory.loadN(key_ptr, key_size);
+    common::BufferView key = memory.view(key_ptr, key_size);
     auto del_result = batch->remove(key);
     SL_TRACE_FUNC_CALL(logger_, del_result.has_value(), key);
     if (not del_result) {
@@ -187,7 +187,7 @@ namespace kagome::host_api {
     auto [key_ptr, key_size] = runtime::PtrSize(key_data);
     auto batch = storage_provider_->getCurrentBatch();
     auto &memory = memory_provider_->getCurrentMemory()->get();
-    auto key = memory.loadN(key_ptr, key_size);
+    common::BufferView key = memory.view(key_ptr, key_size);
     auto res = batch->contains(key);
     return (res.has_value() and res.value()) ? 1 : 0;
   }
@@ -196,7 +196,7 @@ namespace kagome::host_api {
       runtime::WasmSpan prefix_span) {
     auto [prefix_ptr, prefix_size] = runtime::PtrSize(prefix_span);
     auto &memory = memory_provider_->getCurrentMemory()->get();
-    auto prefix = memory.loadN(prefix_ptr, prefix_size);
+    common::BufferView prefix = memory.view(prefix_ptr, prefix_size);
     SL_TRACE_VOID_FUNC_CALL(logger_, prefix);
     (void)clearPrefix(prefix, std::nullopt);
   }
@@ -206,8 +206,8 @@ namespace kagome::host_api {
     auto [prefix_ptr, prefix_size] = runtime::PtrSize(prefix_span);
     auto [limit_ptr, limit_size] = runtime::PtrSize(limit_span);
     auto &memory = memory_provider_->getCurrentMemory()->get();
-    auto prefix = memory.loadN(prefix_ptr, prefix_size);
-    auto enc_limit = memory.loadN(limit_ptr, limit_size);
+    common::BufferView prefix = memory.view(prefix_ptr, prefix_size);
+    auto enc_limit = memory.view(limit_ptr, limit_size);
     auto limit_res = scale::decode<std::optional<uint32_t>>(enc_limit);
     if (!limit_res) {
       auto msg = fmt::format(
@@ -238,7 +238,9 @@ namespace kagome::host_api {
     removeEmptyChildStorages();
     if (auto opt_batch = storage_provider_->tryGetPersistentBatch();
         opt_batch.has_value() and opt_batch.value() != nullptr) {
-      res = opt_batch.value()->commit();
+      // the state is written to the storage only when the whole block is
+      // committed, so the intermediate roots are calculated in memory
+      res = opt_batch.value()->hash();
     } else {
       logger_->warn("ext_storage_root called in an ephemeral extension");
       res = storage_provider_->forceCommit();
@@ -257,7 +259,7 @@ namespace kagome::host_api {
     auto parent_hash_span = runtime::PtrSize(parent_hash_data);
     auto &memory = memory_provider_->getCurrentMemory()->get();
     auto parent_hash_bytes =
-        memory.loadN(parent_hash_span.ptr, parent_hash_span.size);
+        memory.view(parent_hash_span.ptr, parent_hash_span.size);
     common::Hash256 parent_hash;
     std::copy_n(parent_hash_bytes.begin(),
                 common::Hash256::size(),
@@ -276,7 +278,7 @@ namespace kagome::host_api {
 
     auto [key_ptr, key_size] = runtime::PtrSize(key_span);
     auto &memory = memory_provider_->getCurrentMemory()->get();
-    auto key_bytes = memory.loadN(key_ptr, key_size);
+    common::BufferView key_bytes = memory.view(key_ptr, key_size);
     auto res = getStorageNextKey(key_bytes);
     if (res.has_error()) {
       logger_->error("ext_storage_next_key resulted with error: {}",
@@ -304,8 +306,8 @@ namespace kagome::host_api {
     auto [key_ptr, key_size] = runtime::PtrSize(key_span);
     auto [append_ptr, append_size] = runtime::PtrSize(append_span);
     auto &memory = memory_provider_->getCurrentMemory()->get();
-    auto key_bytes = memory.loadN(key_ptr, key_size);
-    auto append_bytes = memory.loadN(append_ptr, append_size);
+    common::BufferView key_bytes = memory.view(key_ptr, key_size);
+    auto append_bytes = memory.view(append_ptr, append_size);
 
     auto val_opt_res = get(key_bytes);
     if (val_opt_res.has_error()) {
@@ -376,7 +378,7 @@ namespace kagome::host_api {
       runtime::WasmSpan values_data) {
     auto [ptr, size] = runtime::PtrSize(values_data);
     auto &memory = memory_provider_->getCurrentMemory()->get();
-    const auto &buffer = memory.loadN(ptr, size);
+    auto buffer = memory.view(ptr, size);
     const auto &pairs = scale::decode<KeyValueCollection>(buffer);
     if (!pairs) {
       logger_->error("failed to decode pairs: {}", pairs.error().message());
@@ -429,7 +431,7 @@ namespace kagome::host_api {
       runtime::WasmSpan values_data, runtime::WasmI32 version) {
     auto [address, size] = runtime::PtrSize(values_data);
     auto &memory = memory_provider_->getCurrentMemory()->get();
-    const auto &buffer = memory.loadN(address, size);
+    auto buffer = memory.view(address, size);
     const auto &values = scale::decode<ValuesCollection>(buffer);
     if (!values) {
       logger_->error("failed to decode values: {}", values.error().message());
@@ -161,7 +161,7 @@ namespace kagome::host_api {
      * none otherwise
      */
     outcome::result<std::optional<common::Buffer>> getStorageNextKey(
-        const common::Buffer &key) const;
+        const common::BufferView &key) const;
 
     std::optional<common::Buffer> calcStorageChangesRoot(
         common::Hash256 parent) const;
@@ -51,6 +51,7 @@
 #include "clock/impl/basic_waitable_timer.hpp"
 #include "clock/impl/clock_impl.hpp"
 #include "common/outcome_throw.hpp"
+#include "common/worker_pool.hpp"
 #include "consensus/authority/authority_manager.hpp"
 #include "consensus/authority/authority_update_observer.hpp"
 #include "consensus/authority/impl/authority_manager_impl.hpp"
@@ -120,6 +121,7 @@
 #include "runtime/runtime_api/impl/tagged_transaction_queue.hpp"
 #include "runtime/runtime_api/impl/transaction_payment_api.hpp"
 #include "runtime/wavm/compartment_wrapper.hpp"
+#include "runtime/wavm/compiled_module_cache.hpp"
 #include "runtime/wavm/core_api_factory_impl.hpp"
 #include "runtime/wavm/instance_environment_factory.hpp"
 #include "runtime/wavm/intrinsics/intrinsic_functions.hpp"
@@ -130,12 +132,15 @@
 #include "runtime/wavm/module_factory_impl.hpp"
 #include "storage/changes_trie/impl/storage_changes_tracker_impl.hpp"
 #include "storage/database_error.hpp"
-#include "storage/leveldb/leveldb.hpp"
+#include "storage/leveldb/leveldb_spaces.hpp"
 #include "storage/predefined_keys.hpp"
+#include "storage/trie/impl/trie_diff_impl.hpp"
+#include "storage/trie/impl/trie_state_pruner_impl.hpp"
 #include "storage/trie/impl/trie_storage_backend_impl.hpp"
 #include "storage/trie/impl/trie_storage_impl.hpp"
 #include "storage/trie/polkadot_trie/polkadot_trie_factory_impl.hpp"
 #include "storage/trie/serialization/polkadot_codec.hpp"
+#include "storage/trie/serialization/trie_node_cache_impl.hpp"
 #include "storage/trie/serialization/trie_serializer_impl.hpp"
 #include "telemetry/impl/service_impl.hpp"
 #include "transaction_pool/impl/pool_moderator_impl.hpp"
@@ -317,30 +322,68 @@ namespace {
     return initialized.value();
   }
 
-  sptr<storage::BufferStorage> get_level_db(
+  sptr<storage::LevelDBSpaces> get_level_db(
       application::AppConfiguration const &app_config,
       sptr<application::ChainSpec> chain_spec) {
     static auto initialized =
-        std::optional<sptr<storage::BufferStorage>>(std::nullopt);
+        std::optional<sptr<storage::LevelDBSpaces>>(std::nullopt);
     if (initialized) {
       return initialized.value();
     }
     auto options = leveldb::Options{};
-    options.max_open_files = 1500; // 1000 was the default value
     options.create_if_missing = true;
-    auto db_res = storage::LevelDB::create(
-        app_config.databasePath(chain_spec->id()), options);
+    options.write_buffer_size =
+        size_t{app_config.dbWriteBufferSize()} * 1024 * 1024;
+    options.compression = app_config.isDbCompressionEnabled()
+                              ? leveldb::kSnappyCompression
+                              : leveldb::kNoCompression;
+    auto bloom_filter_bits = static_cast<int>(app_config.dbBloomFilterBits());
+
+    // block data is mostly appended and read by the recent blocks, so the
+    // configured cache and most of the open files go to the randomly
+    // accessed trie nodes
+    storage::LevelDBSpaces::SpaceOptions default_options{
+        options, 0, bloom_filter_bits};
+    default_options.options.max_open_files = 500;
+    storage::LevelDBSpaces::SpaceOptions trie_node_options{
+        options,
+        size_t{app_config.dbCacheSize()} * 1024 * 1024,
+        bloom_filter_bits};
+    trie_node_options.options.max_open_files = 1500;
+
+    auto log = log::createLogger("Injector", "injector");
+    auto db_path = app_config.databasePath(chain_spec->id());
+    auto db_res = storage::LevelDBSpaces::create(
+        db_path,
+        {{storage::Space::kDefault, default_options},
+         {storage::Space::kTrieNode, trie_node_options}});
     if (!db_res) {
-      auto log = log::createLogger("Injector", "injector");
       log->critical("Can't create LevelDB in {}: {}",
-                    fs::absolute(app_config.databasePath(chain_spec->id()),
-                                 fs::current_path())
-                        .native(),
+                    fs::absolute(db_path, fs::current_path()).native(),
                     db_res.error().message());
       exit(EXIT_FAILURE);
     }
     auto &db = db_res.value();
 
+    // trie nodes used to share the default space with the block data
+    for (auto key_column : {blockchain::prefix::TRIE_NODE,
+                            blockchain::prefix::TRIE_NODE_REFCOUNT}) {
+      auto moved_res =
+          blockchain::moveKeySpace(*db->getSpace(storage::Space::kDefault),
+                                   *db->getSpace(storage::Space::kTrieNode),
+                                   key_column);
+      if (!moved_res) {
+        log->critical("Can't move trie nodes to a separate database space: {}",
+                      moved_res.error().message());
+        exit(EXIT_FAILURE);
+      }
+      if (moved_res.value() > 0) {
+        log->info("Moved {} trie storage entries to the '{}' database space",
+                  moved_res.value(),
+                  storage::spaceName(storage::Space::kTrieNode));
+      }
+    }
+
     initialized.emplace(std::move(db));
     return initialized.value();
   }
@@ -550,6 +593,8 @@ namespace {
     auto block_tree = injector.template create<sptr<blockchain::BlockTree>>();
     auto trie_storage =
         injector.template create<sptr<storage::trie::TrieStorage>>();
+    auto trie_diff = injector.template create<sptr<storage::trie::TrieDiff>>();
+    auto hasher = injector.template create<sptr<crypto::Hasher>>();
 
     auto api_service =
         std::make_shared<api::ApiServiceImpl>(asmgr,
@@ -562,7 +607,9 @@ namespace {
                                               ext_sub_engine,
                                               extrinsic_event_key_repo,
                                               block_tree,
-                                              trie_storage);
+                                              trie_storage,
+                                              trie_diff,
+                                              hasher);
 
     auto child_state_api =
         injector.template create<std::shared_ptr<api::ChildStateApi>>();
@@ -620,7 +667,9 @@ namespace {
         injector.template create<std::shared_ptr<consensus::BabeUtil>>();
     auto justification_storage_policy = injector.template create<
         std::shared_ptr<blockchain::JustificationStoragePolicy>>();
-    
+    auto state_pruner =
+        injector.template create<sptr<storage::trie::TrieStatePruner>>();
+
     auto block_tree_res =
         blockchain::BlockTreeImpl::create(header_repo,
                                           std::move(storage),
@@ -633,7 +682,8 @@ namespace {
                                           std::move(changes_tracker),
                                           std::move(babe_configuration),
                                           std::move(babe_util),
-                                          std::move(justification_storage_policy));
+                                          std::move(justification_storage_policy),
+                                          std::move(state_pruner));
 
     if (not block_tree_res.has_value()) {
       common::raise(block_tree_res.error());
@@ -653,6 +703,9 @@ namespace {
 
     runtime_upgrade_tracker->subscribeToBlockchainEvents(chain_events_engine,
                                                          block_tree);
+    runtime_upgrade_tracker->setModuleRepository(
+        injector.template create<sptr<runtime::ModuleRepository>>(),
+        injector.template create<sptr<runtime::RuntimeCodeProvider>>());
 
     initialized.emplace(std::move(block_tree));
     return initialized.value();
@@ -710,7 +763,11 @@ namespace {
         injector.template create<sptr<crypto::Hasher>>(),
         injector.template create<sptr<authority::AuthorityUpdateObserver>>(),
         injector.template create<sptr<consensus::BabeUtil>>(),
-        injector.template create<sptr<runtime::OffchainWorkerApi>>());
+        injector.template create<sptr<runtime::OffchainWorkerApi>>(),
+        injector.template create<sptr<consensus::BlockStateCache>>(),
+        injector.template create<sptr<storage::trie::TrieStorage>>(),
+        injector.template create<sptr<storage::changes_trie::ChangesTracker>>(),
+        injector.template create<sptr<common::WorkerPool>>());
 
     initialized.emplace(std::move(block_executor));
     return initialized.value();
@@ -776,6 +833,23 @@ namespace {
               return instance;
             }),
         di::bind<runtime::wavm::IntrinsicResolver>.template to<runtime::wavm::IntrinsicResolverImpl>(),
+        bind_by_lambda<runtime::wavm::CompiledModuleCache>(
+            [](const auto &injector)
+                -> sptr<runtime::wavm::CompiledModuleCache> {
+              const application::AppConfiguration &config = injector.template
+                  create<application::AppConfiguration const &>();
+              if (config.runtimeCacheSize() == 0) {
+                return nullptr;
+              }
+              auto chain_spec =
+                  injector.template create<sptr<application::ChainSpec>>();
+              auto hasher = injector.template create<sptr<crypto::Hasher>>();
+              return std::make_shared<runtime::wavm::CompiledModuleCache>(
+                  std::move(hasher),
+                  config.runtimeCachePath(chain_spec->id()),
+                  size_t{config.runtimeCacheSize()} * 1024 * 1024,
+                  runtime::wavm::CompiledModuleCache::compilerVersion());
+            }),
         std::forward<decltype(args)>(args)...);
   }
 
@@ -837,11 +911,14 @@ namespace {
               sptr<const primitives::CodeSubstituteBlockIds>>();
           auto block_storage =
               injector.template create<sptr<blockchain::BlockStorage>>();
+          auto state_pruner =
+              injector.template create<sptr<storage::trie::TrieStatePruner>>();
           auto res = runtime::RuntimeUpgradeTrackerImpl::create(
               std::move(header_repo),
               std::move(storage),
               std::move(substitutes),
-              std::move(block_storage));
+              std::move(block_storage),
+              std::move(state_pruner));
           if (res.has_error()) {
             throw std::runtime_error(
                 "Error creating RuntimeUpgradeTrackerImpl: "
@@ -939,6 +1016,7 @@ namespace {
     transaction_pool::PoolModeratorImpl::Params pool_moderator_config{};
     transaction_pool::TransactionPool::Limits tp_pool_limits{};
     libp2p::protocol::PingConfig ping_config{};
+    common::WorkerPool::Configuration worker_pool_config{};
     host_api::OffchainExtensionConfig offchain_ext_config{
         config.isOffchainIndexingEnabled()};
 
@@ -950,6 +1028,7 @@ namespace {
         useConfig(pool_moderator_config),
         useConfig(tp_pool_limits),
         useConfig(ping_config),
+        useConfig(worker_pool_config),
         useConfig(offchain_ext_config),
 
         // inherit host injector
@@ -1069,13 +1148,21 @@ namespace {
         di::bind<authorship::Proposer>.template to<authorship::ProposerImpl>(),
         di::bind<authorship::BlockBuilder>.template to<authorship::BlockBuilderImpl>(),
         di::bind<authorship::BlockBuilderFactory>.template to<authorship::BlockBuilderFactoryImpl>(),
-        di::bind<storage::BufferStorage>.to([](const auto &injector) {
+        di::bind<storage::LevelDBSpaces>.to([](const auto &injector) {
           const application::AppConfiguration &config =
               injector.template create<application::AppConfiguration const &>();
           auto chain_spec =
               injector.template create<sptr<application::ChainSpec>>();
           return get_level_db(config, chain_spec);
         }),
+        di::bind<storage::SpacedStorage>.to([](const auto &injector)
+            -> sptr<storage::SpacedStorage> {
+          return injector.template create<sptr<storage::LevelDBSpaces>>();
+        }),
+        di::bind<storage::BufferStorage>.to([](const auto &injector) {
+          return injector.template create<sptr<storage::SpacedStorage>>()
+              ->getSpace(storage::Space::kDefault);
+        }),
         di::bind<blockchain::BlockStorage>.to([](const auto &injector) {
           auto root_hash = get_trie_storage_and_root_hash(injector).second;
           const auto &hasher = injector.template create<sptr<crypto::Hasher>>();
@@ -1135,7 +1222,8 @@ namespace {
         di::bind<storage::trie::TrieStorageBackend>.to(
             [](auto const &injector) {
               auto storage =
-                  injector.template create<sptr<storage::BufferStorage>>();
+                  injector.template create<sptr<storage::SpacedStorage>>()
+                      ->getSpace(storage::Space::kTrieNode);
               return get_trie_storage_backend(storage);
             }),
         di::bind<storage::trie::TrieStorage>.to([](auto const &injector) {
@@ -1144,6 +1232,49 @@ namespace {
         di::bind<storage::trie::PolkadotTrieFactory>.template to<storage::trie::PolkadotTrieFactoryImpl>(),
         di::bind<storage::trie::Codec>.template to<storage::trie::PolkadotCodec>(),
         di::bind<storage::trie::TrieSerializer>.template to<storage::trie::TrieSerializerImpl>(),
+        di::bind<storage::trie::TrieDiff>.template to<storage::trie::TrieDiffImpl>(),
+        bind_by_lambda<storage::trie::TrieStatePruner>([](auto const &injector)
+            -> sptr<storage::trie::TrieStatePruner> {
+          const application::AppConfiguration &config =
+              injector.template create<application::AppConfiguration const &>();
+          auto depth = config.statePruningDepth();
+          auto storage =
+              injector.template create<sptr<storage::BufferStorage>>();
+          if (not depth.has_value()) {
+            // the nodes stored without the pruning have no counters, so they
+            // are expected if the pruning is enabled again
+            if (auto res = storage->remove(storage::kStatePruningEnabledKey);
+                not res) {
+              common::raise(res.error());
+            }
+            return nullptr;
+          }
+          auto node_storage =
+              injector.template create<sptr<storage::SpacedStorage>>()
+                  ->getSpace(storage::Space::kTrieNode);
+          auto pruner_res = storage::trie::TrieStatePrunerImpl::create(
+              injector.template create<sptr<storage::trie::Codec>>(),
+              get_trie_storage_backend(node_storage),
+              std::make_shared<storage::trie::TrieStorageBackendImpl>(
+                  node_storage,
+                  common::Buffer{blockchain::prefix::TRIE_NODE_REFCOUNT}),
+              std::move(storage),
+              depth.value());
+          if (not pruner_res) {
+            common::raise(pruner_res.error());
+          }
+          return std::move(pruner_res.value());
+        }),
+        bind_by_lambda<storage::trie::TrieNodeCache>([](auto const &injector)
+            -> sptr<storage::trie::TrieNodeCache> {
+          const application::AppConfiguration &config =
+              injector.template create<application::AppConfiguration const &>();
+          if (config.trieCacheSize() == 0) {
+            return nullptr;
+          }
+          return std::make_shared<storage::trie::TrieNodeCacheImpl>(
+              size_t{config.trieCacheSize()} * 1024 * 1024);
+        }),
         di::bind<runtime::RuntimeCodeProvider>.template to<runtime::StorageCodeProvider>(),
         di::bind<application::ChainSpec>.to([](const auto &injector) {
           const application::AppConfiguration &config =
@@ -1259,6 +1390,7 @@ namespace {
 
     initialized = std::make_shared<consensus::babe::BabeImpl>(
         injector.template create<sptr<application::AppStateManager>>(),
+        injector.template create<const application::AppConfiguration &>(),
         injector.template create<sptr<consensus::BabeLottery>>(),
         injector.template create<sptr<primitives::BabeConfiguration>>(),
         injector.template create<sptr<authorship::Proposer>>(),
@@ -1272,7 +1404,8 @@ namespace {
         injector.template create<sptr<authority::AuthorityUpdateObserver>>(),
         injector.template create<sptr<network::Synchronizer>>(),
         injector.template create<sptr<consensus::BabeUtil>>(),
-        injector.template create<sptr<runtime::OffchainWorkerApi>>());
+        injector.template create<sptr<runtime::OffchainWorkerApi>>(),
+        injector.template create<sptr<consensus::BlockStateCache>>());
 
     auto protocol_factory =
         injector.template create<std::shared_ptr<network::ProtocolFactory>>();
@@ -1324,7 +1457,8 @@ namespace {
         injector.template create<sptr<authority::AuthorityManager>>(),
         injector.template create<sptr<network::Synchronizer>>(),
         injector.template create<sptr<network::PeerManager>>(),
-        injector.template create<sptr<blockchain::BlockTree>>());
+        injector.template create<sptr<blockchain::BlockTree>>(),
+        injector.template create<sptr<common::WorkerPool>>());
 
     auto protocol_factory =
         injector.template create<std::shared_ptr<network::ProtocolFactory>>();
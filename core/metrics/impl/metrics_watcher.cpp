@@ -7,6 +7,15 @@
 
 namespace {
   constexpr auto storageSizeMetricName = "kagome_storage_size";
+  constexpr auto dbMemoryUsageMetricName = "kagome_db_memory_usage";
+  constexpr auto dbBlockCacheUsageMetricName = "kagome_db_block_cache_usage";
+  constexpr auto dbLevelFilesMetricName = "kagome_db_level_files";
+  constexpr auto dbLevelSizeMetricName = "kagome_db_level_size";
+  constexpr auto dbCompactionTimeMetricName = "kagome_db_compaction_time";
+  constexpr auto dbCompactionReadMetricName = "kagome_db_compaction_read";
+  constexpr auto dbCompactionWriteMetricName = "kagome_db_compaction_write";
+
+  constexpr double kMiB = 1024 * 1024;
 }  // namespace
 
 namespace kagome::metrics {
@@ -15,9 +24,12 @@ namespace kagome::metrics {
   MetricsWatcher::MetricsWatcher(
       std::shared_ptr<application::AppStateManager> app_state_manager,
       const application::AppConfiguration &app_config,
-      std::shared_ptr<application::ChainSpec> chain_spec)
-      : storage_path_(app_config.databasePath(chain_spec->id())) {
+      std::shared_ptr<application::ChainSpec> chain_spec,
+      std::shared_ptr<storage::LevelDBSpaces> database)
+      : storage_path_(app_config.databasePath(chain_spec->id())),
+        database_(std::move(database)) {
     BOOST_ASSERT(app_state_manager);
+    BOOST_ASSERT(database_);
 
     // Metrics
     metrics_registry_ = metrics::createRegistry();
@@ -27,6 +39,38 @@ namespace kagome::metrics {
     metric_storage_size_ =
         metrics_registry_->registerGaugeMetric(storageSizeMetricName);
 
+    metrics_registry_->registerGaugeFamily(
+        dbMemoryUsageMetricName,
+        "Approximate memory used by the database memtables and block cache");
+    metrics_registry_->registerGaugeFamily(
+        dbBlockCacheUsageMetricName,
+        "Memory charged to the database cache of uncompressed blocks");
+    for (auto space : {storage::Space::kDefault, storage::Space::kTrieNode}) {
+      std::map<std::string, std::string> labels{
+          {"space", storage::spaceName(space)}};
+      metric_db_spaces_.emplace(
+          space,
+          SpaceMetrics{
+              metrics_registry_->registerGaugeMetric(dbMemoryUsageMetricName,
+                                                     labels),
+              metrics_registry_->registerGaugeMetric(
+                  dbBlockCacheUsageMetricName, labels),
+          });
+    }
+    metrics_registry_->registerGaugeFamily(
+        dbLevelFilesMetricName, "Number of database files at a level");
+    metrics_registry_->registerGaugeFamily(
+        dbLevelSizeMetricName, "Size of database files at a level, in bytes");
+    metrics_registry_->registerGaugeFamily(
+        dbCompactionTimeMetricName,
+        "Time spent on compactions into a database level, in seconds");
+    metrics_registry_->registerGaugeFamily(
+        dbCompactionReadMetricName,
+        "Bytes read by compactions into a database level");
+    metrics_registry_->registerGaugeFamily(
+        dbCompactionWriteMetricName,
+        "Bytes written by compactions into a database level");
+
     app_state_manager->takeControl(*this);
   }
 
@@ -41,6 +85,7 @@ namespace kagome::metrics {
         if (storage_size_res.has_value()) {
           metric_storage_size_->set(storage_size_res.value());
         }
+        update_database_metrics();
 
         // Granulated waiting
         for (auto i = 0; i < 30; ++i) {
@@ -60,6 +105,53 @@ namespace kagome::metrics {
     }
   }
 
+  void MetricsWatcher::update_database_metrics() {
+    for (auto &[space, space_metrics] : metric_db_spaces_) {
+      auto database = database_->getDatabase(space);
+      if (auto usage =
+              database->getProperty("leveldb.approximate-memory-usage")) {
+        try {
+          space_metrics.memory_usage->set(std::stod(usage.value()));
+        } catch (...) {
+          // leave the previous value
+        }
+      }
+      space_metrics.block_cache_usage->set(database->getBlockCacheUsage());
+
+      for (auto &stats : database->getLevelStats()) {
+        auto &metrics = level_metrics(space, stats.level);
+        metrics.files->set(stats.files);
+        metrics.size->set(stats.size_mb * kMiB);
+        metrics.compaction_time->set(stats.compaction_time_sec);
+        metrics.compaction_read->set(stats.compaction_read_mb * kMiB);
+        metrics.compaction_write->set(stats.compaction_write_mb * kMiB);
+      }
+    }
+  }
+
+  MetricsWatcher::LevelMetrics &MetricsWatcher::level_metrics(
+      storage::Space space, int level) {
+    auto it = metric_db_levels_.find({space, level});
+    if (it != metric_db_levels_.end()) {
+      return it->second;
+    }
+    std::map<std::string, std::string> labels{
+        {"space", storage::spaceName(space)},
+        {"level", std::to_string(level)}};
+    LevelMetrics metrics{
+        metrics_registry_->registerGaugeMetric(dbLevelFilesMetricName, labels),
+        metrics_registry_->registerGaugeMetric(dbLevelSizeMetricName, labels),
+        metrics_registry_->registerGaugeMetric(dbCompactionTimeMetricName,
+                                               labels),
+        metrics_registry_->registerGaugeMetric(dbCompactionReadMetricName,
+                                               labels),
+        metrics_registry_->registerGaugeMetric(dbCompactionWriteMetricName,
+                                               labels),
+    };
+    return metric_db_levels_.emplace(std::make_pair(space, level), metrics)
+        .first->second;
+  }
+
   outcome::result<size_t> MetricsWatcher::measure_storage_size() {
     boost::system::error_code ec;
 
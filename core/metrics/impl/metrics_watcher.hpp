@@ -6,6 +6,7 @@
 #ifndef KAGOME_METRICS_METRICWATCHER
 #define KAGOME_METRICS_METRICWATCHER
 
+#include <map>
 #include <thread>
 
 #include "application/app_configuration.hpp"
@@ -13,6 +14,7 @@
 #include "application/chain_spec.hpp"
 #include "metrics/metrics.hpp"
 #include "outcome/outcome.hpp"
+#include "storage/leveldb/leveldb_spaces.hpp"
 
 namespace kagome::metrics {
 
@@ -21,7 +23,8 @@ namespace kagome::metrics {
     MetricsWatcher(
         std::shared_ptr<application::AppStateManager> app_state_manager,
         const application::AppConfiguration &app_config,
-        std::shared_ptr<application::ChainSpec> chain_spec);
+        std::shared_ptr<application::ChainSpec> chain_spec,
+        std::shared_ptr<storage::LevelDBSpaces> database);
 
     bool prepare();
     bool start();
@@ -30,7 +33,26 @@ namespace kagome::metrics {
    private:
     outcome::result<size_t> measure_storage_size();
 
+    /// Exports the memory usage and per-level statistics of each database
+    /// space
+    void update_database_metrics();
+
+    struct SpaceMetrics {
+      metrics::Gauge *memory_usage;
+      metrics::Gauge *block_cache_usage;
+    };
+
+    struct LevelMetrics {
+      metrics::Gauge *files;
+      metrics::Gauge *size;
+      metrics::Gauge *compaction_time;
+      metrics::Gauge *compaction_read;
+      metrics::Gauge *compaction_write;
+    };
+    LevelMetrics &level_metrics(storage::Space space, int level);
+
     boost::filesystem::path storage_path_;
+    std::shared_ptr<storage::LevelDBSpaces> database_;
 
     volatile bool shutdown_requested_ = false;
     std::thread thread_;
@@ -38,6 +60,8 @@ namespace kagome::metrics {
     // Metrics
     metrics::RegistryPtr metrics_registry_;
     metrics::Gauge *metric_storage_size_;
+    std::map<storage::Space, SpaceMetrics> metric_db_spaces_;
+    std::map<std::pair<storage::Space, int>, LevelMetrics> metric_db_levels_;
   };
 
 }  // namespace kagome::metrics
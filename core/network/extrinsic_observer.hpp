@@ -6,15 +6,16 @@
 #ifndef KAGOME_CORE_NETWORK_EXTRINSIC_OBSERVER_HPP
 #define KAGOME_CORE_NETWORK_EXTRINSIC_OBSERVER_HPP
 
+#include <functional>
+#include <vector>
+
 #include "common/blob.hpp"
 #include "outcome/outcome.hpp"
+#include "primitives/extrinsic.hpp"
 
 namespace kagome::api {
   class AuthorApi;
 }
-namespace kagome::primitives {
-  struct Extrinsic;
-}
 
 namespace kagome::network {
 
@@ -24,6 +25,18 @@ namespace kagome::network {
 
     virtual outcome::result<common::Hash256> onTxMessage(
         const primitives::Extrinsic &extrinsic) = 0;
+
+    /**
+     * Queues extrinsics received from the network to be validated and
+     * imported in the background
+     * @param on_processed is called from a background thread once the
+     * extrinsics are processed, so that the sender may deliver more of them
+     * @return error if too many extrinsics are queued already, the extrinsics
+     * are dropped then
+     */
+    virtual outcome::result<void> onTxMessages(
+        std::vector<primitives::Extrinsic> extrinsics,
+        std::function<void()> on_processed) = 0;
   };
 
 }  // namespace kagome::network
@@ -5,15 +5,39 @@
 
 #include "network/impl/extrinsic_observer_impl.hpp"
 
+#include <boost/asio/post.hpp>
+
 #include "primitives/transaction_validity.hpp"
 #include "transaction_pool/transaction_pool.hpp"
 
+OUTCOME_CPP_DEFINE_CATEGORY(kagome::network, ExtrinsicObserverImpl::Error, e) {
+  using E = kagome::network::ExtrinsicObserverImpl::Error;
+  switch (e) {
+    case E::QUEUE_IS_FULL:
+      return "Too many extrinsics are waiting for validation";
+  }
+  return "unknown error";
+}
+
 namespace kagome::network {
 
   ExtrinsicObserverImpl::ExtrinsicObserverImpl(
       std::shared_ptr<kagome::transaction_pool::TransactionPool> pool)
-      : pool_(std::move(pool)) {
+      : pool_(std::move(pool)),
+        work_guard_{workers_context_.get_executor()},
+        logger_{log::createLogger("ExtrinsicObserver", "network")} {
     BOOST_ASSERT(pool_);
+    for (size_t i = 0; i < kWorkers; ++i) {
+      workers_.emplace_back([this] { workers_context_.run(); });
+    }
+  }
+
+  ExtrinsicObserverImpl::~ExtrinsicObserverImpl() {
+    work_guard_.reset();
+    workers_context_.stop();
+    for (auto &worker : workers_) {
+      worker.join();
+    }
   }
 
   outcome::result<common::Hash256> ExtrinsicObserverImpl::onTxMessage(
@@ -22,4 +46,56 @@ namespace kagome::network {
                                   extrinsic);
   }
 
+  outcome::result<void> ExtrinsicObserverImpl::onTxMessages(
+      std::vector<primitives::Extrinsic> extrinsics,
+      std::function<void()> on_processed) {
+    {
+      std::lock_guard lock{queue_mutex_};
+      if (queued_extrinsics_ + extrinsics.size() > kMaxQueuedExtrinsics) {
+        return Error::QUEUE_IS_FULL;
+      }
+      queued_extrinsics_ += extrinsics.size();
+      queue_.push_back({std::move(extrinsics), std::move(on_processed)});
+    }
+    boost::asio::post(workers_context_, [this] { processQueue(); });
+    return outcome::success();
+  }
+
+  void ExtrinsicObserverImpl::processQueue() {
+    std::vector<QueuedMessage> messages;
+    std::vector<primitives::Extrinsic> batch;
+    {
+      std::lock_guard lock{queue_mutex_};
+      while (not queue_.empty() and batch.size() < kMaxBatchSize) {
+        auto &message = queue_.front();
+        queued_extrinsics_ -= message.extrinsics.size();
+        std::move(message.extrinsics.begin(),
+                  message.extrinsics.end(),
+                  std::back_inserter(batch));
+        messages.push_back(std::move(message));
+        queue_.pop_front();
+      }
+    }
+    if (messages.empty()) {
+      // the messages were merged into a batch by another worker
+      return;
+    }
+
+    auto results = pool_->submitExtrinsics(
+        primitives::TransactionSource::External, std::move(batch));
+    for (auto &result : results) {
+      if (result) {
+        SL_DEBUG(logger_, "Received tx {}", result.value());
+      } else {
+        SL_DEBUG(logger_, "Rejected tx: {}", result.error().message());
+      }
+    }
+
+    for (auto &message : messages) {
+      if (message.on_processed) {
+        message.on_processed();
+      }
+    }
+  }
+
 }  // namespace kagome::network
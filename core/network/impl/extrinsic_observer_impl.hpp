@@ -8,6 +8,13 @@
 
 #include "network/extrinsic_observer.hpp"
 
+#include <deque>
+#include <mutex>
+#include <thread>
+
+#include <boost/asio/executor_work_guard.hpp>
+#include <boost/asio/io_context.hpp>
+
 #include "log/logger.hpp"
 
 namespace kagome::transaction_pool {
@@ -16,19 +23,62 @@ namespace kagome::transaction_pool {
 
 namespace kagome::network {
 
+  /**
+   * Validates extrinsics received from the network on a bounded pool of
+   * worker threads. Extrinsics of the queued messages are merged into batches
+   * submitted to the transaction pool at once
+   */
   class ExtrinsicObserverImpl : public ExtrinsicObserver {
    public:
+    enum class Error { QUEUE_IS_FULL = 1 };
+
+    /// Number of the threads validating extrinsics
+    static constexpr size_t kWorkers = 2;
+    /// Messages are merged into a batch until it has that many extrinsics
+    static constexpr size_t kMaxBatchSize = 64;
+    /// Incoming messages are rejected while that many extrinsics are queued
+    static constexpr size_t kMaxQueuedExtrinsics = 1024;
+
     explicit ExtrinsicObserverImpl(
         std::shared_ptr<kagome::transaction_pool::TransactionPool> pool);
 
+    ~ExtrinsicObserverImpl() override;
+
     outcome::result<common::Hash256> onTxMessage(
         const primitives::Extrinsic &extrinsic) override;
 
+    outcome::result<void> onTxMessages(
+        std::vector<primitives::Extrinsic> extrinsics,
+        std::function<void()> on_processed) override;
+
    private:
+    struct QueuedMessage {
+      std::vector<primitives::Extrinsic> extrinsics;
+      std::function<void()> on_processed;
+    };
+
+    /**
+     * Takes the queued messages up to the batch size and submits their
+     * extrinsics to the pool, runs on a worker thread
+     */
+    void processQueue();
+
     std::shared_ptr<kagome::transaction_pool::TransactionPool> pool_;
+
+    std::mutex queue_mutex_;
+    std::deque<QueuedMessage> queue_;
+    size_t queued_extrinsics_ = 0;
+
+    boost::asio::io_context workers_context_;
+    boost::asio::executor_work_guard<boost::asio::io_context::executor_type>
+        work_guard_;
+    std::vector<std::thread> workers_;
+
     log::Logger logger_;
   };
 
 }  // namespace kagome::network
 
+OUTCOME_HPP_DECLARE_ERROR(kagome::network, ExtrinsicObserverImpl::Error);
+
 #endif  // KAGOME_CORE_NETWORK_IMPL_EXTRINSIC_OBSERVER_IMPL_HPP
@@ -5,6 +5,8 @@
 
 #include "network/impl/protocols/propagate_transactions_protocol.hpp"
 
+#include <boost/asio/post.hpp>
+
 #include "network/common.hpp"
 #include "network/impl/protocols/protocol_error.hpp"
 #include "network/types/no_data_message.hpp"
@@ -20,6 +22,7 @@ namespace kagome::network {
 
   PropagateTransactionsProtocol::PropagateTransactionsProtocol(
       libp2p::Host &host,
+      std::shared_ptr<boost::asio::io_context> io_context,
       const application::ChainSpec &chain_spec,
       std::shared_ptr<consensus::babe::Babe> babe,
       std::shared_ptr<ExtrinsicObserver> extrinsic_observer,
@@ -29,11 +32,13 @@ namespace kagome::network {
       std::shared_ptr<subscription::ExtrinsicEventKeyRepository>
           ext_event_key_repo)
       : host_(host),
+        io_context_(std::move(io_context)),
         babe_(std::move(babe)),
         extrinsic_observer_(std::move(extrinsic_observer)),
         stream_engine_(std::move(stream_engine)),
         extrinsic_events_engine_{std::move(extrinsic_events_engine)},
         ext_event_key_repo_{std::move(ext_event_key_repo)} {
+    BOOST_ASSERT(io_context_ != nullptr);
     BOOST_ASSERT(extrinsic_observer_ != nullptr);
     BOOST_ASSERT(stream_engine_ != nullptr);
     BOOST_ASSERT(extrinsic_events_engine_ != nullptr);
@@ -303,14 +308,26 @@ namespace kagome::network {
                  peer_id.toBase58());
 
       if (self->babe_->wasSynchronized()) {
-        for (auto &ext : message.extrinsics) {
-          auto result = self->extrinsic_observer_->onTxMessage(ext);
-          if (result) {
-            SL_DEBUG(self->log_, "  Received tx {}", result.value());
-          } else {
-            SL_DEBUG(self->log_, "  Rejected tx: {}", result.error().message());
-          }
+        // the next message is read from the peer once the extrinsics are
+        // validated, so that a peer cannot flood the validation queue
+        auto on_processed = [wp, io_context = self->io_context_, stream] {
+          boost::asio::post(*io_context, [wp, stream]() mutable {
+            if (auto self = wp.lock()) {
+              self->readPropagatedExtrinsics(std::move(stream));
+            } else {
+              stream->reset();
+            }
+          });
+        };
+        auto res = self->extrinsic_observer_->onTxMessages(
+            std::move(message.extrinsics), std::move(on_processed));
+        if (res.has_value()) {
+          return;
         }
+        SL_DEBUG(self->log_,
+                 "Dropped propagated transactions from {}: {}",
+                 peer_id.toBase58(),
+                 res.error().message());
       } else {
         SL_TRACE(self->log_,
                  "Skipping extrinsics processing since the node was not in a "
@@ -10,6 +10,7 @@
 
 #include <memory>
 
+#include <boost/asio/io_context.hpp>
 #include <libp2p/connection/stream.hpp>
 #include <libp2p/host/host.hpp>
 
@@ -53,6 +54,7 @@ namespace kagome::network {
 
     PropagateTransactionsProtocol(
         libp2p::Host &host,
+        std::shared_ptr<boost::asio::io_context> io_context,
         const application::ChainSpec &chain_spec,
         std::shared_ptr<consensus::babe::Babe> babe,
         std::shared_ptr<ExtrinsicObserver> extrinsic_observer,
@@ -90,6 +92,7 @@ namespace kagome::network {
     void readPropagatedExtrinsics(std::shared_ptr<Stream> stream);
 
     libp2p::Host &host_;
+    std::shared_ptr<boost::asio::io_context> io_context_;
     std::shared_ptr<consensus::babe::Babe> babe_;
     std::shared_ptr<ExtrinsicObserver> extrinsic_observer_;
     std::shared_ptr<StreamEngine> stream_engine_;
@@ -64,6 +64,7 @@ namespace kagome::network {
   ProtocolFactory::makePropagateTransactionsProtocol() const {
     return std::make_shared<PropagateTransactionsProtocol>(
         host_,
+        io_context_,
         chain_spec_,
         babe_.lock(),
         extrinsic_observer_.lock(),
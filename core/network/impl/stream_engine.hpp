@@ -6,15 +6,18 @@
 #ifndef KAGOME_STREAM_ENGINE_HPP
 #define KAGOME_STREAM_ENGINE_HPP
 
+#include <mutex>
 #include <numeric>
 #include <queue>
 #include <unordered_map>
 
 #include "libp2p/connection/stream.hpp"
 #include "libp2p/host/host.hpp"
+#include "libp2p/multi/uvarint.hpp"
 #include "libp2p/peer/peer_info.hpp"
 #include "libp2p/peer/protocol.hpp"
 #include "log/logger.hpp"
+#include "metrics/metrics.hpp"
 #include "network/helpers/peer_id_formatter.hpp"
 #include "network/helpers/scale_message_read_writer.hpp"
 #include "network/protocol_base.hpp"
@@ -31,6 +34,10 @@ namespace kagome::network {
    *       Incoming_Stream_0
    *       Outgoing_Stream_0
    *       MessagesQueue for creating outgoing stream
+   * Messages are SCALE-encoded with their length prefix once, and the encoded
+   * bytes are shared by all the streams they are written to. The total
+   * number and size of messages queued for sending to the peers are exported
+   * as metrics.
    */
   struct StreamEngine final : std::enable_shared_from_this<StreamEngine> {
     using PeerInfo = libp2p::peer::PeerInfo;
@@ -41,13 +48,16 @@ namespace kagome::network {
 
     enum class Direction { INCOMING = 1, OUTGOING = 2, BIDIRECTIONAL = 3 };
 
+    /// SCALE-encoded message prepended with its varint length, ready to be
+    /// written to any stream as is
+    using EncodedMessage = std::shared_ptr<const std::vector<uint8_t>>;
+
    private:
     struct ProtocolDescr {
       std::shared_ptr<ProtocolBase> protocol;
       std::shared_ptr<Stream> incoming;
       std::shared_ptr<Stream> outgoing;
-      std::queue<std::function<void(std::shared_ptr<Stream>)>>
-          deffered_messages;
+      std::queue<EncodedMessage> deffered_messages;
     };
     using ProtocolMap = std::map<Protocol, ProtocolDescr>;
     using PeerMap = std::map<PeerId, ProtocolMap>;
@@ -61,7 +71,21 @@ namespace kagome::network {
 
     ~StreamEngine() = default;
     explicit StreamEngine()
-        : logger_{log::createLogger("StreamEngine", "network")} {}
+        : logger_{log::createLogger("StreamEngine", "network")} {
+      // messages being sent to the peers, either written to their streams
+      // or waiting for the streams to be opened. The gauges are not labeled
+      // by peer, as the labels would never be removed
+      metrics_registry_->registerGaugeFamily(
+          kSendQueueMessagesMetricName,
+          "Number of messages queued for sending to the peers");
+      metric_send_queue_messages_ =
+          metrics_registry_->registerGaugeMetric(kSendQueueMessagesMetricName);
+      metrics_registry_->registerGaugeFamily(
+          kSendQueueBytesMetricName,
+          "Size in bytes of messages queued for sending to the peers");
+      metric_send_queue_bytes_ =
+          metrics_registry_->registerGaugeMetric(kSendQueueBytesMetricName);
+    }
 
     template <typename... Args>
     static StreamEnginePtr create(Args &&...args) {
@@ -156,6 +180,7 @@ namespace kagome::network {
         auto &protocols = peer_it->second;
         auto protocol_it = protocols.find(protocol->protocol());
         if (protocol_it != protocols.end()) {
+          dropDeferredMessages(protocol_it->second);
           protocols.erase(protocol_it);
           if (protocols.empty()) {
             streams_.erase(peer_it);
@@ -177,6 +202,7 @@ namespace kagome::network {
           if (descr.outgoing) {
             descr.outgoing->reset();
           }
+          dropDeferredMessages(descr);
         }
         streams_.erase(it);
       }
@@ -202,6 +228,22 @@ namespace kagome::network {
       return false;
     }
 
+    /**
+     * SCALE-encodes {@param msg} and prepends it with its varint length, the
+     * way ScaleMessageReadWriter does
+     */
+    template <typename T>
+    static outcome::result<EncodedMessage> encode(const T &msg) {
+      OUTCOME_TRY(encoded, scale::encode(msg));
+      libp2p::multi::UVarint length{encoded.size()};
+      const auto &prefix = length.toVector();
+      auto message = std::make_shared<std::vector<uint8_t>>();
+      message->reserve(prefix.size() + encoded.size());
+      message->insert(message->end(), prefix.begin(), prefix.end());
+      message->insert(message->end(), encoded.begin(), encoded.end());
+      return message;
+    }
+
     template <typename T>
     void send(const PeerId &peer_id,
               const std::shared_ptr<ProtocolBase> &protocol,
@@ -209,25 +251,18 @@ namespace kagome::network {
               const T &msg) {
       BOOST_ASSERT(stream != nullptr);
 
-      auto read_writer =
-          std::make_shared<ScaleMessageReadWriter>(std::move(stream));
-      read_writer->write(
-          msg, [wp = weak_from_this(), peer_id, protocol](auto &&res) {
-            if (auto self = wp.lock()) {
-              if (res.has_value()) {
-                SL_TRACE(self->logger_,
-                         "Message sent to {} stream with {}",
-                         protocol->protocol(),
-                         peer_id);
-              } else {
-                SL_ERROR(self->logger_,
-                         "Could not send message to {} stream with {}: {}",
-                         protocol->protocol(),
-                         peer_id,
-                         res.error().message());
-              }
-            }
-          });
+      auto message_res = encode(msg);
+      if (message_res.has_error()) {
+        SL_ERROR(logger_,
+                 "Could not encode message to {} stream with {}: {}",
+                 protocol->protocol(),
+                 peer_id,
+                 message_res.error().message());
+        return;
+      }
+      auto &message = message_res.value();
+      enqueue(*message);
+      write(peer_id, protocol, std::move(stream), std::move(message));
     }
 
     template <typename T>
@@ -237,17 +272,34 @@ namespace kagome::network {
       BOOST_ASSERT(msg != nullptr);
       BOOST_ASSERT(protocol != nullptr);
 
+      auto message_res = encode(*msg);
+      if (message_res.has_error()) {
+        SL_ERROR(logger_,
+                 "Could not encode message to {} stream with {}: {}",
+                 protocol->protocol(),
+                 peer_id,
+                 message_res.error().message());
+        return;
+      }
+      auto &message = message_res.value();
+
       std::shared_lock cs(streams_cs_);
       forSubscriber(peer_id, protocol, [&](auto type, auto &descr) {
+        enqueue(*message);
         if (descr.outgoing and not descr.outgoing->isClosed()) {
-          send(peer_id, protocol, descr.outgoing, *msg);
+          write(peer_id, protocol, descr.outgoing, std::move(message));
           return;
         }
 
-        updateStream(peer_id, protocol, std::move(msg));
+        updateStream(peer_id, protocol, std::move(message));
       });
     }
 
+    /**
+     * Sends {@param msg} to each peer satisfying {@param predicate}. The
+     * message is encoded once, and the same encoded bytes are written to the
+     * streams of all the peers.
+     */
     template <typename T>
     void broadcast(
         const std::shared_ptr<ProtocolBase> &protocol,
@@ -256,15 +308,26 @@ namespace kagome::network {
       BOOST_ASSERT(msg != nullptr);
       BOOST_ASSERT(protocol != nullptr);
 
+      auto message_res = encode(*msg);
+      if (message_res.has_error()) {
+        SL_ERROR(logger_,
+                 "Could not encode message to broadcast to {} streams: {}",
+                 protocol->protocol(),
+                 message_res.error().message());
+        return;
+      }
+      auto &message = message_res.value();
+
       std::shared_lock cs(streams_cs_);
       forEachPeer([&](const auto &peer_id, auto &proto_map) {
         if (predicate(peer_id)) {
           forProtocol(proto_map, protocol, [&](auto &descr) {
+            enqueue(*message);
             if (descr.outgoing and not descr.outgoing->isClosed()) {
-              send(peer_id, protocol, descr.outgoing, *msg);
+              write(peer_id, protocol, descr.outgoing, message);
               return;
             }
-            updateStream(peer_id, protocol, msg);
+            updateStream(peer_id, protocol, message);
           });
         }
       });
@@ -402,21 +465,62 @@ namespace kagome::network {
       }
     }
 
-    template <typename T>
+    /// writes the {@param message} previously put to the send queue
+    void write(const PeerId &peer_id,
+               const std::shared_ptr<ProtocolBase> &protocol,
+               std::shared_ptr<Stream> stream,
+               EncodedMessage message) {
+      BOOST_ASSERT(stream != nullptr);
+      BOOST_ASSERT(message != nullptr);
+
+      const auto &bytes = *message;
+      stream->write(
+          bytes,
+          bytes.size(),
+          [wp = weak_from_this(), peer_id, protocol, message](auto &&res) {
+            if (auto self = wp.lock()) {
+              self->dequeue(*message);
+              if (res.has_value()) {
+                SL_TRACE(self->logger_,
+                         "Message sent to {} stream with {}",
+                         protocol->protocol(),
+                         peer_id);
+              } else {
+                SL_ERROR(self->logger_,
+                         "Could not send message to {} stream with {}: {}",
+                         protocol->protocol(),
+                         peer_id,
+                         res.error().message());
+              }
+            }
+          });
+    }
+
+    void enqueue(const std::vector<uint8_t> &message) {
+      metric_send_queue_messages_->inc();
+      metric_send_queue_bytes_->inc(message.size());
+    }
+
+    void dequeue(const std::vector<uint8_t> &message) {
+      metric_send_queue_messages_->dec();
+      metric_send_queue_bytes_->dec(message.size());
+    }
+
+    void dropDeferredMessages(ProtocolDescr &descr) {
+      while (not descr.deffered_messages.empty()) {
+        dequeue(*descr.deffered_messages.front());
+        descr.deffered_messages.pop();
+      }
+    }
+
     void updateStream(const PeerId &peer_id,
                       const std::shared_ptr<ProtocolBase> &protocol,
-                      std::shared_ptr<T> msg) {
+                      EncodedMessage message) {
       bool need_to_create_new_stream = true;
 
       forSubscriber(peer_id, protocol, [&](auto, auto &subscriber) {
         need_to_create_new_stream = subscriber.deffered_messages.empty();
-        subscriber.deffered_messages.push(
-            [wp = weak_from_this(), peer_id, protocol, msg = std::move(msg)](
-                std::shared_ptr<Stream> stream) {
-              if (auto self = wp.lock()) {
-                self->send(peer_id, protocol, stream, *msg);
-              }
-            });
+        subscriber.deffered_messages.push(std::move(message));
       });
 
       if (not need_to_create_new_stream) {
@@ -425,7 +529,7 @@ namespace kagome::network {
 
       protocol->newOutgoingStream(
           PeerInfo{peer_id, {}},
-          [wp = weak_from_this(), protocol, peer_id, msg = std::move(msg)](
+          [wp = weak_from_this(), protocol, peer_id](
               auto &&stream_res) mutable {
             auto self = wp.lock();
             if (not self) {
@@ -440,9 +544,7 @@ namespace kagome::network {
                   stream_res.error().message());
               self->forSubscriber(
                   peer_id, protocol, [&](auto, auto &subscriber) {
-                    while (not subscriber.deffered_messages.empty()) {
-                      subscriber.deffered_messages.pop();
-                    }
+                    self->dropDeferredMessages(subscriber);
                   });
 
               return;
@@ -461,17 +563,28 @@ namespace kagome::network {
 
             self->forSubscriber(peer_id, protocol, [&](auto, auto &subscriber) {
               while (not subscriber.deffered_messages.empty()) {
-                auto &msg = subscriber.deffered_messages.front();
-                msg(stream);
+                self->write(peer_id,
+                            protocol,
+                            stream,
+                            std::move(subscriber.deffered_messages.front()));
                 subscriber.deffered_messages.pop();
               }
             });
           });
     }
 
+    static constexpr auto kSendQueueMessagesMetricName =
+        "kagome_network_send_queue_messages";
+    static constexpr auto kSendQueueBytesMetricName =
+        "kagome_network_send_queue_bytes";
+
     log::Logger logger_;
     std::shared_mutex streams_cs_;
     PeerMap streams_;
+
+    metrics::RegistryPtr metrics_registry_ = metrics::createRegistry();
+    metrics::Gauge *metric_send_queue_messages_;
+    metrics::Gauge *metric_send_queue_bytes_;
   };
 
 }  // namespace kagome::network
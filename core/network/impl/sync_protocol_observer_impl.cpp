@@ -53,18 +53,16 @@ namespace kagome::network {
     }
     auto &from_hash = from_hash_res.value();
 
-    // secondly, retrieve hashes of blocks the other peer is interested in
-    auto chain_hash_res = retrieveRequestedHashes(request, from_hash);
-    if (not chain_hash_res.has_value()) {
+    // secondly, fill the resulting response with data, which we were asked
+    // for, walking the requested chain of blocks
+    if (auto res = fillBlocksResponse(request, from_hash, response);
+        not res.has_value()) {
+      // the blocks visited before the failure still form a chain
       log_->warn("cannot retrieve a chain of blocks: {}",
-                 chain_hash_res.error().message());
+                 res.error().message());
       requested_ids_.erase(request_id);
       return response;
     }
-    auto &chain_hash = chain_hash_res.value();
-
-    // thirdly, fill the resulting response with data, which we were asked for
-    fillBlocksResponse(request, response, chain_hash);
     if (response.blocks.empty()) {
       SL_DEBUG(log_, "Return response id={}: no blocks", request_id);
     } else if (response.blocks.size() == 1) {
@@ -90,15 +88,10 @@ namespace kagome::network {
     return response;
   }
 
-  blockchain::BlockTree::BlockHashVecRes
-  SyncProtocolObserverImpl::retrieveRequestedHashes(
+  outcome::result<void> SyncProtocolObserverImpl::fillBlocksResponse(
       const BlocksRequest &request,
-      const primitives::BlockHash &from_hash) const {
-    auto direction = request.direction == network::Direction::ASCENDING
-                         ? blockchain::BlockTree::GetChainDirection::ASCEND
-                         : blockchain::BlockTree::GetChainDirection::DESCEND;
-    blockchain::BlockTree::BlockHashVecRes chain_hash_res{{}};
-
+      const primitives::BlockHash &from_hash,
+      BlocksResponse &response) const {
     uint32_t request_count =
         application::AppConfiguration::kAbsolutMaxBlocksInResponse;
     if (request.max.has_value()) {
@@ -108,58 +101,54 @@ namespace kagome::network {
           application::AppConfiguration::kAbsolutMaxBlocksInResponse);
     }
 
-    // Note: request.to is not used in substrate
-
-    switch (direction) {
-      case blockchain::BlockTree::GetChainDirection::ASCEND: {
-        OUTCOME_TRY(
-            chain_hash,
-            block_tree_->getBestChainFromBlock(from_hash, request_count));
-        return std::move(chain_hash);
-      }
-      case blockchain::BlockTree::GetChainDirection::DESCEND: {
-        OUTCOME_TRY(
-            chain_hash,
-            block_tree_->getDescendingChainToBlock(from_hash, request_count));
-        return std::move(chain_hash);
-      }
-      default:
-        BOOST_UNREACHABLE_RETURN({});
-    }
-  }
-
-  void SyncProtocolObserverImpl::fillBlocksResponse(
-      const BlocksRequest &request,
-      BlocksResponse &response,
-      const std::vector<primitives::BlockHash> &hash_chain) const {
     auto header_needed =
         request.attributeIsSet(network::BlockAttribute::HEADER);
     auto body_needed = request.attributeIsSet(network::BlockAttribute::BODY);
     auto justification_needed =
         request.attributeIsSet(network::BlockAttribute::JUSTIFICATION);
 
-    for (const auto &hash : hash_chain) {
+    auto on_block = [&](const primitives::BlockInfo &block,
+                        const primitives::BlockHeader &header)
+        -> outcome::result<bool> {
       auto &new_block =
-          response.blocks.emplace_back(primitives::BlockData{hash});
+          response.blocks.emplace_back(primitives::BlockData{block.hash});
 
       if (header_needed) {
-        auto header_res = blocks_headers_->getBlockHeader(hash);
-        if (header_res) {
-          new_block.header = std::move(header_res.value());
-        }
+        new_block.header = header;
       }
       if (body_needed) {
-        auto body_res = block_tree_->getBlockBody(hash);
+        auto body_res = block_tree_->getBlockBody(block.hash);
         if (body_res) {
           new_block.body = std::move(body_res.value());
         }
       }
       if (justification_needed) {
-        auto justification_res = block_tree_->getBlockJustification(hash);
+        auto justification_res =
+            block_tree_->getBlockJustification(block.hash);
         if (justification_res) {
           new_block.justification = std::move(justification_res.value());
         }
       }
+      return response.blocks.size() < request_count;
+    };
+
+    // Note: request.to is not used in substrate
+
+    switch (request.direction) {
+      case network::Direction::ASCENDING:
+        // the blocks of the best chain are returned
+        return block_tree_->forEachBlockInChain(
+            from_hash,
+            block_tree_->deepestLeaf().hash,
+            blockchain::BlockTree::GetChainDirection::ASCEND,
+            on_block);
+      case network::Direction::DESCENDING:
+        return block_tree_->forEachBlockInChain(
+            block_tree_->getGenesisBlockHash(),
+            from_hash,
+            blockchain::BlockTree::GetChainDirection::DESCEND,
+            on_block);
     }
+    BOOST_UNREACHABLE_RETURN(outcome::success());
   }
 }  // namespace kagome::network
@@ -35,14 +35,14 @@ namespace kagome::network {
         const BlocksRequest &request) const override;
 
    private:
-    blockchain::BlockTree::BlockHashVecRes retrieveRequestedHashes(
+    /**
+     * Fills \param response with the blocks of the chain, which starts at
+     * \param from_hash and goes in the requested direction
+     */
+    outcome::result<void> fillBlocksResponse(
         const network::BlocksRequest &request,
-        const primitives::BlockHash &from_hash) const;
-
-    void fillBlocksResponse(
-        const network::BlocksRequest &request,
-        network::BlocksResponse &response,
-        const std::vector<primitives::BlockHash> &hash_chain) const;
+        const primitives::BlockHash &from_hash,
+        network::BlocksResponse &response) const;
 
     std::shared_ptr<blockchain::BlockTree> block_tree_;
     std::shared_ptr<blockchain::BlockHeaderRepository> blocks_headers_;
@@ -743,6 +743,8 @@ namespace kagome::network {
       }
     }
 
+    prepareNextBlocks();
+
     auto node = known_blocks_.extract(hash);
     if (node) {
       auto &block = node.mapped().data;
@@ -818,6 +820,20 @@ namespace kagome::network {
     });
   }
 
+  void SynchronizerImpl::prepareNextBlocks() {
+    size_t amount = 0;
+    for (auto it = generations_.begin();
+         it != generations_.end() and amount < kBlocksToPrepareAhead;
+         ++it, ++amount) {
+      auto block_it = known_blocks_.find(it->second);
+      if (block_it == known_blocks_.end() or block_it->second.prepared) {
+        continue;
+      }
+      block_executor_->prepareBlock(block_it->second.data);
+      block_it->second.prepared = true;
+    }
+  }
+
   size_t SynchronizerImpl::discardBlock(
       const primitives::BlockHash &hash_of_discarding_block) {
     std::queue<primitives::BlockHash> queue;
@@ -35,6 +35,10 @@ namespace kagome::network {
     static constexpr size_t kMaxDistanceToBlockForSubscription =
         kMinPreloadedBlockAmount * 2;
 
+    /// Amount of queued blocks whose stateless checks run in background ahead
+    /// of their application, while preceding blocks are being executed
+    static constexpr size_t kBlocksToPrepareAhead = 16;
+
     static constexpr std::chrono::milliseconds kRecentnessDuration =
         std::chrono::seconds(60);
 
@@ -117,6 +121,10 @@ namespace kagome::network {
     /// Pops next block from queue and tries to apply that
     void applyNextBlock();
 
+    /// Hands the next blocks of the queue to the block executor to be
+    /// prepared for application in background
+    void prepareNextBlocks();
+
     /// Removes block {@param block} and all all dependent on it from the queue
     /// @returns number of affected blocks
     size_t discardBlock(const primitives::BlockHash &block);
@@ -145,6 +153,8 @@ namespace kagome::network {
       primitives::BlockData data;
       /// Peers who know this block
       std::set<libp2p::peer::PeerId> peers;
+      /// Whether the block has been handed to the executor to be prepared
+      bool prepared = false;
     };
 
     // Already known (enqueued) but is not applied yet
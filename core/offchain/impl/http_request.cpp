@@ -376,6 +376,10 @@ namespace kagome::offchain {
     return status_;
   }
 
+  void HttpRequest::cancel() {
+    io_context_.stop();
+  }
+
   Result<Success, Failure> HttpRequest::addRequestHeader(
       std::string_view name, std::string_view value) {
     if (not adding_headers_is_allowed_) {
@@ -47,6 +47,13 @@ namespace kagome::offchain {
         common::Buffer &chunk,
         std::optional<std::chrono::milliseconds> deadline);
 
+    /**
+     * Interrupts sending of the request and waiting for its response, the
+     * request is completed with DeadlineHasReached status. May be called from
+     * any thread
+     */
+    void cancel();
+
     std::string errorMessage() const {
       return error_message_;
     }
@@ -5,7 +5,7 @@
 
 #include "offchain/impl/offchain_worker_impl.hpp"
 
-#include <thread>
+#include <algorithm>
 
 #include <libp2p/host/host.hpp>
 
@@ -52,6 +52,9 @@ namespace kagome::offchain {
     BOOST_ASSERT(executor_);
     BOOST_ASSERT(ocw_pool_);
 
+    // the worker is made right before its run
+    run_deadline_ = clock_->now() + kRunTimeout;
+
     auto hash = hasher_->blake2b_256(scale::encode(header_).value());
     const_cast<primitives::BlockInfo &>(block_) =
         primitives::BlockInfo(header_.number, hash);
@@ -63,43 +66,45 @@ namespace kagome::offchain {
   outcome::result<void> OffchainWorkerImpl::run() {
     BOOST_ASSERT(not ocw_pool_->getWorker());
 
-    auto main_thread_func = [ocw = shared_from_this(), ocw_pool = ocw_pool_] {
-      soralog::util::setThreadName("ocw." + std::to_string(ocw->block_.number));
+    soralog::util::setThreadName("ocw." + std::to_string(block_.number));
 
-      ocw_pool->addWorker(ocw);
+    ocw_pool_->addWorker(shared_from_this());
 
-      SL_TRACE(
-          ocw->log_, "Offchain worker is started for block {}", ocw->block_);
+    SL_TRACE(log_, "Offchain worker is started for block {}", block_);
 
-      auto res = ocw->executor_->callAt<void>(
-          ocw->block_.hash, "OffchainWorkerApi_offchain_worker", ocw->header_);
+    auto res = executor_->callAt<void>(
+        block_.hash, "OffchainWorkerApi_offchain_worker", header_);
 
-      ocw_pool->removeWorker();
+    ocw_pool_->removeWorker();
 
-      if (res.has_failure()) {
-        SL_ERROR(ocw->log_,
-                 "Can't execute offchain worker for block {}: {}",
-                 ocw->block_,
-                 res.error().message());
-        return;
-      }
+    if (res.has_failure()) {
+      SL_ERROR(log_,
+               "Can't execute offchain worker for block {}: {}",
+               block_,
+               res.error().message());
+      return res.as_failure();
+    }
 
-      SL_DEBUG(ocw->log_,
-               "Offchain worker is successfully executed for block {}",
-               ocw->block_);
-    };
-
-    try {
-      std::thread(std::move(main_thread_func)).detach();
-    } catch (const std::system_error &exception) {
-      return outcome::failure(exception.code());
-    } catch (...) {
-      BOOST_UNREACHABLE_RETURN({});
+    if (clock_->now() > run_deadline_) {
+      SL_WARN(log_,
+              "Offchain worker for block {} has exceeded its time limit",
+              block_);
     }
 
+    SL_DEBUG(
+        log_, "Offchain worker is successfully executed for block {}", block_);
     return outcome::success();
   }
 
+  void OffchainWorkerImpl::stop() {
+    std::lock_guard lock{stop_mutex_};
+    stopped_ = true;
+    if (sending_request_) {
+      sending_request_->cancel();
+    }
+    stop_cv_.notify_all();
+  }
+
   bool OffchainWorkerImpl::isValidator() const {
     bool isValidator = app_config_.roles().flags.authority == 1;
     return isValidator;
@@ -132,6 +137,7 @@ namespace kagome::offchain {
   }
 
   void OffchainWorkerImpl::sleepUntil(Timestamp deadline) {
+    deadline = limitDeadline(deadline);
     auto ts = clock_->zero() + std::chrono::milliseconds(deadline);
     SL_TRACE(log_,
              "Falling asleep till {} (for {}ms)",
@@ -140,8 +146,10 @@ namespace kagome::offchain {
                  ts - clock_->now())
                  .count());
 
-    std::this_thread::sleep_until(decltype(clock_)::element_type::TimePoint(
-        std::chrono::milliseconds(deadline)));
+    if (waitUntilStopped(deadline)) {
+      SL_DEBUG(log_, "Woke up after stop");
+      return;
+    }
     SL_DEBUG(log_, "Woke up after sleeping");
   }
 
@@ -255,6 +263,7 @@ namespace kagome::offchain {
 
   Result<Success, HttpError> OffchainWorkerImpl::httpRequestWriteBody(
       RequestId id, common::Buffer chunk, std::optional<Timestamp> deadline) {
+    deadline = limitDeadline(deadline);
     std::optional<std::chrono::milliseconds> timeout = std::nullopt;
     if (deadline.has_value()) {
       timeout = std::chrono::duration_cast<std::chrono::milliseconds>(
@@ -268,13 +277,25 @@ namespace kagome::offchain {
     }
     auto &request = it->second;
 
+    {
+      std::lock_guard lock{stop_mutex_};
+      if (stopped_) {
+        return HttpError::Timeout;
+      }
+      sending_request_ = request;
+    }
     auto result = request->writeRequestBody(chunk, timeout);
+    {
+      std::lock_guard lock{stop_mutex_};
+      sending_request_.reset();
+    }
 
     return result;
   }
 
   std::vector<HttpStatus> OffchainWorkerImpl::httpResponseWait(
       const std::vector<RequestId> &ids, std::optional<Timestamp> deadline) {
+    deadline = limitDeadline(deadline);
     std::vector<HttpStatus> result;
     result.reserve(ids.size());
 
@@ -282,6 +303,7 @@ namespace kagome::offchain {
       auto it = active_http_requests_.find(id);
       if (it == active_http_requests_.end()) {
         result.push_back(InvalidIdentifier);
+        continue;
       }
       auto &request = it->second;
 
@@ -292,7 +314,11 @@ namespace kagome::offchain {
                     < clock_->now()) {
           break;
         }
-        std::this_thread::sleep_for(latency_of_waiting);
+        auto latency = std::chrono::duration_cast<std::chrono::milliseconds>(
+            latency_of_waiting);
+        if (waitUntilStopped(timestamp() + latency.count())) {
+          break;
+        }
       }
 
       result.push_back(status ? status : DeadlineHasReached);
@@ -317,6 +343,7 @@ namespace kagome::offchain {
 
   Result<uint32_t, HttpError> OffchainWorkerImpl::httpResponseReadBody(
       RequestId id, common::Buffer &chunk, std::optional<Timestamp> deadline) {
+    deadline = limitDeadline(deadline);
     auto it = active_http_requests_.find(id);
     if (it == active_http_requests_.end()) {
       return HttpError::InvalidId;
@@ -335,6 +362,24 @@ namespace kagome::offchain {
     return result;
   }
 
+  Timestamp OffchainWorkerImpl::limitDeadline(
+      std::optional<Timestamp> deadline) const {
+    Timestamp run_deadline =
+        std::chrono::duration_cast<std::chrono::milliseconds>(
+            run_deadline_.time_since_epoch())
+            .count();
+    return deadline.has_value() ? std::min(deadline.value(), run_deadline)
+                                : run_deadline;
+  }
+
+  bool OffchainWorkerImpl::waitUntilStopped(Timestamp deadline) {
+    std::unique_lock lock{stop_mutex_};
+    return stop_cv_.wait_until(
+        lock,
+        clock::SystemClock::TimePoint(std::chrono::milliseconds(deadline)),
+        [this] { return stopped_; });
+  }
+
   void OffchainWorkerImpl::setAuthorizedNodes(
       std::vector<libp2p::peer::PeerId> nodes, bool authorized_only) {
     // TODO(xDimon): Need to implement it
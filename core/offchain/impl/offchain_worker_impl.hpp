@@ -8,6 +8,9 @@
 
 #include "offchain/offchain_worker.hpp"
 
+#include <condition_variable>
+#include <mutex>
+
 #include <boost/asio/io_context.hpp>
 
 #include "crypto/random_generator.hpp"
@@ -43,6 +46,11 @@ namespace kagome::offchain {
     // This value because all deadline quantized with milliseconds
     static constexpr auto latency_of_waiting = 1ms;
 
+    // Limit of the run duration, counted from the creation of the worker.
+    // Sleeping and waiting for HTTP requests are interrupted after it, so the
+    // worker frees its thread
+    static constexpr auto kRunTimeout = 30s;
+
     OffchainWorkerImpl(
         const application::AppConfiguration &app_config,
         std::shared_ptr<clock::SystemClock> clock,
@@ -58,6 +66,8 @@ namespace kagome::offchain {
 
     outcome::result<void> run() override;
 
+    void stop() override;
+
     bool isValidator() const override;
 
     Result<Success, Failure> submitTransaction(
@@ -116,6 +126,18 @@ namespace kagome::offchain {
    private:
     OffchainStorage &getStorage(StorageType storage_type);
 
+    /**
+     * @returns \arg deadline requested by the runtime, limited by the end of
+     * the run of the worker
+     */
+    Timestamp limitDeadline(std::optional<Timestamp> deadline) const;
+
+    /**
+     * Waits until \arg deadline or until the worker is stopped
+     * @returns true if the worker is stopped
+     */
+    bool waitUntilStopped(Timestamp deadline);
+
     const application::AppConfiguration &app_config_;
     std::shared_ptr<clock::SystemClock> clock_;
     std::shared_ptr<crypto::Hasher> hasher_;
@@ -130,8 +152,16 @@ namespace kagome::offchain {
     std::shared_ptr<OffchainWorkerPool> ocw_pool_;
     log::Logger log_;
 
+    clock::SystemClock::TimePoint run_deadline_;
+
     int16_t request_id_ = 0;
     std::map<RequestId, std::shared_ptr<HttpRequest>> active_http_requests_;
+
+    std::mutex stop_mutex_;
+    std::condition_variable stop_cv_;
+    bool stopped_ = false;
+    // request, which sending is waited for, it is cancelled on stop
+    std::shared_ptr<HttpRequest> sending_request_;
   };
 
 }  // namespace kagome::offchain
@@ -32,8 +32,17 @@ namespace kagome::offchain {
    public:
     virtual ~OffchainWorker() = default;
 
+    /**
+     * Executes the offchain worker of the block on the calling thread
+     */
     virtual outcome::result<void> run() = 0;
 
+    /**
+     * Interrupts sleeping and waiting for HTTP requests of the running worker
+     * and of its further calls, may be called from any thread
+     */
+    virtual void stop() = 0;
+
     // ------------------------- Off-Chain API methods -------------------------
 
     virtual bool isValidator() const = 0;
@@ -36,6 +36,11 @@ namespace kagome::runtime::binaryen {
       return instance_;
     }
 
+    void precompileAt(std::shared_ptr<const RuntimeCodeProvider>,
+                      const storage::trie::RootHash &) override {
+      // the only module is compiled on the first request
+    }
+
    private:
     std::shared_ptr<runtime::ModuleInstance> instance_;
     std::shared_ptr<const InstanceEnvironmentFactory> env_factory_;
@@ -25,7 +25,11 @@ namespace kagome::runtime::binaryen {
                    std::make_unique<MemoryAllocator>(
                        MemoryAllocator::MemoryHandle{
                            [this](auto new_size) { return resize(new_size); },
-                           [this]() { return size_; }},
+                           [this]() { return size_; },
+                           [this](auto addr) { return load32u(addr); },
+                           [this](auto addr, auto value) {
+                             store32(addr, value);
+                           }},
                        kInitialMemorySize,
                        heap_base)} {
   }
@@ -77,7 +81,7 @@ namespace kagome::runtime::binaryen {
 
   common::Buffer MemoryImpl::loadN(kagome::runtime::WasmPointer addr,
                                    kagome::runtime::WasmSize n) const {
-    BOOST_ASSERT(size_ > addr and size_ - addr >= n);
+    checkBounds(addr, n);
     common::Buffer res;
     res.reserve(n);
     for (auto i = addr; i < addr + n; i++) {
@@ -88,7 +92,7 @@ namespace kagome::runtime::binaryen {
 
   std::string MemoryImpl::loadStr(kagome::runtime::WasmPointer addr,
                                   kagome::runtime::WasmSize length) const {
-    BOOST_ASSERT(size_ > addr and size_ - addr >= length);
+    checkBounds(addr, length);
     std::string res;
     res.reserve(length);
     for (auto i = addr; i < addr + length; i++) {
@@ -97,6 +101,25 @@ namespace kagome::runtime::binaryen {
     return res;
   }
 
+  gsl::span<const uint8_t> MemoryImpl::view(WasmPointer addr,
+                                            WasmSize n) const {
+    auto &buffer = view_buffers_[next_view_buffer_];
+    next_view_buffer_ = (next_view_buffer_ + 1) % kViewBuffers;
+    buffer = loadN(addr, n);
+    return buffer;
+  }
+
+  void MemoryImpl::checkBounds(WasmPointer addr, WasmSize n) const {
+    if (addr > size_ or size_ - addr < n) {
+      logger_->error(
+          "Out of bounds access to {} bytes at {}, memory size is {}",
+          n,
+          addr,
+          size_);
+      throw wasm::TrapException{};
+    }
+  }
+
   void MemoryImpl::store8(WasmPointer addr, int8_t value) {
     BOOST_ASSERT((allocator_->checkAddress<int8_t>(addr)));
     memory_->set<int8_t>(addr, value);
@@ -126,7 +149,7 @@ namespace kagome::runtime::binaryen {
   void MemoryImpl::storeBuffer(kagome::runtime::WasmPointer addr,
                                gsl::span<const uint8_t> value) {
     const auto size = static_cast<size_t>(value.size());
-    BOOST_ASSERT((allocator_->checkAddress(addr, size)));
+    checkBounds(addr, size);
     for (size_t i = addr, j = 0; i < addr + size; i++, j++) {
       memory_->set(i, value[j]);
     }
@@ -33,9 +33,14 @@ namespace kagome::runtime::binaryen {
    * https://github.com/WebAssembly/binaryen/blob/master/src/shell-interface.h#L37
    * @note Memory size of this implementation is at least a page size (4096
    * bytes)
+   * @note Binaryen does not expose the storage of its memory, so view()
+   * copies the bytes into the least recently used of kViewBuffers buffers
    */
   class MemoryImpl final : public Memory {
    public:
+    /// Number of views, which may be used at once
+    static constexpr size_t kViewBuffers = 8;
+
     MemoryImpl(wasm::ShellExternalInterface::Memory *memory,
                std::unique_ptr<MemoryAllocator> &&allocator);
     MemoryImpl(wasm::ShellExternalInterface::Memory *memory,
@@ -62,6 +67,8 @@ namespace kagome::runtime::binaryen {
                          kagome::runtime::WasmSize n) const override;
     std::string loadStr(kagome::runtime::WasmPointer addr,
                         kagome::runtime::WasmSize length) const override;
+    gsl::span<const uint8_t> view(WasmPointer addr,
+                                  WasmSize n) const override;
 
     void store8(WasmPointer addr, int8_t value) override;
     void store16(WasmPointer addr, int16_t value) override;
@@ -90,10 +97,17 @@ namespace kagome::runtime::binaryen {
     }
 
    private:
+    /// traps if {@param n} bytes at {@param addr} are out of the memory bounds
+    void checkBounds(WasmPointer addr, WasmSize n) const;
+
     wasm::ShellExternalInterface::Memory *memory_;
     WasmSize size_;
     std::unique_ptr<MemoryAllocator> allocator_;
 
+    // copies of the bytes returned by view()
+    mutable std::array<common::Buffer, kViewBuffers> view_buffers_;
+    mutable size_t next_view_buffer_ = 0;
+
     log::Logger logger_;
   };
 }  // namespace kagome::runtime::binaryen
@@ -5,6 +5,8 @@
 
 #include "runtime/common/memory_allocator.hpp"
 
+#include <stdexcept>
+
 #include "runtime/memory.hpp"
 
 namespace kagome::runtime {
@@ -15,11 +17,142 @@ namespace kagome::runtime {
   static_assert(kDefaultHeapBase < kInitialMemorySize,
                 "Heap base must be in memory");
 
+  namespace {
+    constexpr size_t kBitmapWordBits = 64;
+
+    // Free lists are rebuilt when the number of entries, which were merged or
+    // reused, exceeds the number of deallocated chunks by this amount
+    constexpr size_t kStaleEntriesThreshold = 1024;
+
+    size_t bitIndex(size_t ptr) {
+      return ptr / kAlignment;
+    }
+
+    /**
+     * Size class of a chunk is the power of two of its size in kAlignment
+     * units
+     */
+    size_t sizeClass(WasmSize size) {
+      BOOST_ASSERT(size >= kAlignment);
+      // the lowest bit keeps the argument of clz non-zero
+      return std::numeric_limits<unsigned long long>::digits - 1
+             - __builtin_clzll((size / kAlignment) | 1u);
+    }
+  }  // namespace
+
+  void MemoryAllocator::Bitmap::resize(size_t bits) {
+    auto words = bits / kBitmapWordBits + 1;
+    for (size_t level = 0;; ++level) {
+      if (level == levels_.size()) {
+        levels_.emplace_back(words, 0);
+        // a new summary level is filled from the level below it
+        if (level > 0) {
+          const auto &lower = levels_[level - 1];
+          for (size_t i = 0; i < lower.size(); ++i) {
+            if (lower[i] != 0) {
+              levels_[level][i / kBitmapWordBits] |= uint64_t{1}
+                                                     << (i % kBitmapWordBits);
+            }
+          }
+        }
+      } else if (levels_[level].size() < words) {
+        levels_[level].resize(words, 0);
+      }
+      if (words == 1) {
+        break;
+      }
+      words = (words + kBitmapWordBits - 1) / kBitmapWordBits;
+    }
+  }
+
+  bool MemoryAllocator::Bitmap::test(size_t i) const {
+    return (levels_[0][i / kBitmapWordBits] >> (i % kBitmapWordBits)) & 1u;
+  }
+
+  void MemoryAllocator::Bitmap::set(size_t i) {
+    for (auto &words : levels_) {
+      auto &word = words[i / kBitmapWordBits];
+      const auto was_empty = word == 0;
+      word |= uint64_t{1} << (i % kBitmapWordBits);
+      if (not was_empty) {
+        break;
+      }
+      i /= kBitmapWordBits;
+    }
+  }
+
+  void MemoryAllocator::Bitmap::clear(size_t i) {
+    for (auto &words : levels_) {
+      auto &word = words[i / kBitmapWordBits];
+      word &= ~(uint64_t{1} << (i % kBitmapWordBits));
+      if (word != 0) {
+        break;
+      }
+      i /= kBitmapWordBits;
+    }
+  }
+
+  std::optional<size_t> MemoryAllocator::Bitmap::next(size_t i) const {
+    // go up until a word has a set bit at or after the position
+    size_t level = 0;
+    for (;; ++level) {
+      if (level == levels_.size()) {
+        return std::nullopt;
+      }
+      const auto &words = levels_[level];
+      const auto word = i / kBitmapWordBits;
+      if (word >= words.size()) {
+        return std::nullopt;
+      }
+      const auto bits = words[word] & (~uint64_t{0} << (i % kBitmapWordBits));
+      if (bits != 0) {
+        i = word * kBitmapWordBits + __builtin_ctzll(bits);
+        break;
+      }
+      i = word + 1;
+    }
+    // go down along the lowest set bits
+    while (level > 0) {
+      --level;
+      i = i * kBitmapWordBits + __builtin_ctzll(levels_[level][i]);
+    }
+    return i;
+  }
+
+  std::optional<size_t> MemoryAllocator::Bitmap::prev(size_t i) const {
+    // go up until a word has a set bit before the position
+    size_t level = 0;
+    for (;; ++level) {
+      if (level == levels_.size() or i == 0) {
+        return std::nullopt;
+      }
+      const auto word = (i - 1) / kBitmapWordBits;
+      const auto pos = (i - 1) % kBitmapWordBits;
+      const auto bits =
+          levels_[level][word] & (~uint64_t{0} >> (kBitmapWordBits - 1 - pos));
+      if (bits != 0) {
+        i = word * kBitmapWordBits + kBitmapWordBits - 1
+            - __builtin_clzll(bits);
+        break;
+      }
+      i = word;
+    }
+    // go down along the highest set bits
+    while (level > 0) {
+      --level;
+      i = i * kBitmapWordBits + kBitmapWordBits - 1
+          - __builtin_clzll(levels_[level][i]);
+    }
+    return i;
+  }
+
   MemoryAllocator::MemoryAllocator(MemoryHandle memory,
                                    size_t size,
                                    WasmPointer heap_base)
       : memory_{std::move(memory)},
-        offset_{heap_base},
+        // chunk boundaries are tracked with kAlignment granularity
+        heap_base_{roundUpAlign(heap_base)},
+        offset_{heap_base_},
         size_{size},
         logger_{log::createLogger("Allocator", "runtime")} {
     // Heap base (and offset in according) must be non-zero to prohibit
@@ -28,9 +161,13 @@ namespace kagome::runtime {
     BOOST_ASSERT(offset_ > 0);
     BOOST_ASSERT(memory_.getSize);
     BOOST_ASSERT(memory_.resize);
+    BOOST_ASSERT(memory_.load32u);
+    BOOST_ASSERT(memory_.store32u);
 
     size_ = std::max(size_, offset_);
     BOOST_ASSERT(offset_ <= Memory::kMaxMemorySize - size_);
+    chunks_.resize(bitIndex(size_) + 1);
+    free_chunks_.resize(bitIndex(size_) + 1);
   }
 
   WasmPointer MemoryAllocator::allocate(WasmSize size) {
@@ -43,7 +180,6 @@ namespace kagome::runtime {
     // Round up allocating chunk of memory
     size = new_offset - ptr;
 
-    BOOST_ASSERT(allocated_.find(ptr) == allocated_.end());
     if (Memory::kMaxMemorySize - offset_ < size) {  // overflow
       logger_->error(
           "overflow occurred while trying to allocate {} bytes at offset "
@@ -54,7 +190,8 @@ namespace kagome::runtime {
     }
     if (new_offset <= size_) {
       offset_ = new_offset;
-      allocated_[ptr] = size;
+      chunks_.set(bitIndex(ptr));
+      ++allocated_chunks_num_;
       SL_TRACE_FUNC_CALL(logger_, ptr, this, size);
       return ptr;
     }
@@ -65,40 +202,51 @@ namespace kagome::runtime {
   }
 
   std::optional<WasmSize> MemoryAllocator::deallocate(WasmPointer ptr) {
-    auto a_it = allocated_.find(ptr);
-    if (a_it == allocated_.end()) {
+    if (not isChunk(ptr) or isFreeChunk(ptr)) {
       return std::nullopt;
     }
 
-    auto a_node = allocated_.extract(a_it);
-    auto size = a_node.mapped();
-    auto [d_it, is_emplaced] = deallocated_.emplace(ptr, size);
-    BOOST_ASSERT(is_emplaced);
-
-    // Combine with next chunk if it adjacent
-    while (true) {
-      auto node = deallocated_.extract(ptr + size);
-      if (not node) break;
-      d_it->second += node.mapped();
+    const WasmSize size = nextChunk(ptr) - ptr;
+
+    // Adjacent deallocated chunks are always combined, so there is at most
+    // one on each side. Their headers are checked before any change
+    const auto next = ptr + size;
+    const auto next_size =
+        isFreeChunk(next) ? std::make_optional(freeChunkSize(next))
+                          : std::nullopt;
+    auto prev = prevChunk(ptr);
+    if (prev and not isFreeChunk(*prev)) {
+      prev.reset();
+    }
+    const auto prev_size =
+        prev ? std::make_optional(freeChunkSize(*prev)) : std::nullopt;
+
+    --allocated_chunks_num_;
+    WasmPointer chunk_ptr = ptr;
+    WasmSize chunk_size = size;
+
+    // Combine with next chunk if it is deallocated
+    if (next_size) {
+      chunk_size += *next_size;
+      chunks_.clear(bitIndex(next));
+      free_chunks_.clear(bitIndex(next));
+      --deallocated_chunks_num_;
     }
 
-    // Combine with previous chunk if it adjacent
-    while (deallocated_.begin() != d_it) {
-      auto d_it_prev = std::prev(d_it);
-      if (d_it_prev->first + d_it_prev->second != d_it->first) {
-        break;
-      }
-      d_it_prev->second += d_it->second;
-      deallocated_.erase(d_it);
-      d_it = d_it_prev;
+    // Combine with previous chunk if it is deallocated
+    if (prev_size) {
+      chunk_ptr = *prev;
+      chunk_size += *prev_size;
+      chunks_.clear(bitIndex(ptr));
+      free_chunks_.clear(bitIndex(*prev));
+      --deallocated_chunks_num_;
     }
 
-    auto d_it_next = std::next(d_it);
-    if (d_it_next == deallocated_.end()) {
-      if (d_it->first + d_it->second == offset_) {
-        offset_ = d_it->first;
-        deallocated_.erase(d_it);
-      }
+    if (chunk_ptr + chunk_size == offset_) {
+      offset_ = chunk_ptr;
+      chunks_.clear(bitIndex(chunk_ptr));
+    } else {
+      putFreeChunk(chunk_ptr, chunk_size);
     }
 
     SL_TRACE_FUNC_CALL(logger_, size, this, ptr);
@@ -113,41 +261,149 @@ namespace kagome::runtime {
     // Round up size of allocating memory chunk
     size = roundUpAlign(size);
 
-    auto min_chunk_size = std::numeric_limits<WasmPointer>::max();
-    WasmPointer ptr = 0;
-    for (const auto &[chunk_ptr, chunk_size] : deallocated_) {
-      BOOST_ASSERT(chunk_size > 0);
-      if (chunk_size >= size and chunk_size < min_chunk_size) {
-        min_chunk_size = chunk_size;
-        ptr = chunk_ptr;
-        if (min_chunk_size == size) {
-          break;
-        }
-      }
-    }
-    if (ptr == 0) {
+    const auto chunk = takeFreeChunk(size);
+    if (not chunk) {
       // if did not find available space among deallocated memory chunks,
       // then grow memory and allocate in new space
       return growAlloc(size);
     }
 
-    const auto node = deallocated_.extract(ptr);
-    BOOST_ASSERT_MSG(!node.empty(),
-                     "pointer to the node was received by searching list of "
-                     "deallocated nodes, must not be none");
-
-    auto old_size = node.mapped();
+    const auto [ptr, old_size] = *chunk;
+    free_chunks_.clear(bitIndex(ptr));
+    --deallocated_chunks_num_;
     if (old_size > size) {
-      auto new_ptr = ptr + size;
-      auto new_size = old_size - size;
-      BOOST_ASSERT(new_size > 0);
+      chunks_.set(bitIndex(ptr + size));
+      putFreeChunk(ptr + size, old_size - size);
+    }
+
+    ++allocated_chunks_num_;
+    return ptr;
+  }
 
-      deallocated_[new_ptr] = new_size;
+  std::optional<std::pair<WasmPointer, WasmSize>>
+  MemoryAllocator::takeFreeChunk(WasmSize size) {
+    // chunks of the smallest suitable class may be less than needed, so only
+    // the last one is tried, while any chunk of a greater class fits
+    const auto min_class = sizeClass(size);
+    if (auto chunk = lastFreeChunk(min_class);
+        chunk and chunk->second >= size) {
+      popFreeChunk(min_class);
+      return chunk;
+    }
+    // the greater classes with free chunks, from the smallest one
+    auto classes = nonempty_classes_ & ~((uint32_t{2} << min_class) - 1);
+    for (; classes != 0; classes &= classes - 1) {
+      const size_t size_class = __builtin_ctz(classes);
+      if (auto chunk = lastFreeChunk(size_class); chunk) {
+        popFreeChunk(size_class);
+        return chunk;
+      }
     }
+    return std::nullopt;
+  }
 
-    allocated_[ptr] = size;
+  std::optional<std::pair<WasmPointer, WasmSize>>
+  MemoryAllocator::lastFreeChunk(size_t size_class) {
+    auto &list = free_lists_[size_class];
+    // each stale entry is dropped once, so it takes amortized O(1)
+    while (not list.empty()) {
+      const auto ptr = list.back();
+      if (auto size = checkFreeChunk(ptr, size_class); size) {
+        return std::make_pair(ptr, *size);
+      }
+      popFreeChunk(size_class);
+    }
+    return std::nullopt;
+  }
 
-    return ptr;
+  void MemoryAllocator::popFreeChunk(size_t size_class) {
+    auto &list = free_lists_[size_class];
+    list.pop_back();
+    --free_lists_entries_num_;
+    if (list.empty()) {
+      nonempty_classes_ &= ~(uint32_t{1} << size_class);
+    }
+  }
+
+  void MemoryAllocator::putFreeChunk(WasmPointer ptr, WasmSize size) {
+    memory_.store32u(ptr, size);
+    free_chunks_.set(bitIndex(ptr));
+    ++deallocated_chunks_num_;
+
+    const auto size_class = sizeClass(size);
+    free_lists_[size_class].push_back(ptr);
+    nonempty_classes_ |= uint32_t{1} << size_class;
+    ++free_lists_entries_num_;
+    if (free_lists_entries_num_
+        > 2 * deallocated_chunks_num_ + kStaleEntriesThreshold) {
+      rebuildFreeLists();
+    }
+  }
+
+  std::optional<WasmSize> MemoryAllocator::checkFreeChunk(
+      WasmPointer ptr, size_t size_class) const {
+    if (not isFreeChunk(ptr)) {
+      return std::nullopt;
+    }
+    auto size = freeChunkSize(ptr);
+    if (sizeClass(size) != size_class) {
+      return std::nullopt;
+    }
+    return size;
+  }
+
+  WasmSize MemoryAllocator::freeChunkSize(WasmPointer ptr) const {
+    BOOST_ASSERT(isFreeChunk(ptr));
+    const auto size = memory_.load32u(ptr);
+    if (size == 0 or size % kAlignment != 0 or size > offset_ - ptr
+        or nextChunk(ptr) != ptr + size) {
+      logger_->error("Header of deallocated chunk 0x{:x} is corrupted: {}",
+                     ptr,
+                     size);
+      throw std::runtime_error{
+          "Header of a deallocated chunk in the runtime memory is corrupted"};
+    }
+    return size;
+  }
+
+  void MemoryAllocator::rebuildFreeLists() {
+    for (auto &list : free_lists_) {
+      list.clear();
+    }
+    free_lists_entries_num_ = 0;
+    nonempty_classes_ = 0;
+    for (auto i = free_chunks_.next(0); i; i = free_chunks_.next(*i + 1)) {
+      const WasmPointer ptr = *i * kAlignment;
+      const auto size_class = sizeClass(freeChunkSize(ptr));
+      free_lists_[size_class].push_back(ptr);
+      nonempty_classes_ |= uint32_t{1} << size_class;
+      ++free_lists_entries_num_;
+    }
+  }
+
+  WasmPointer MemoryAllocator::nextChunk(WasmPointer ptr) const {
+    const auto end = bitIndex(offset_);
+    const auto i = chunks_.next(bitIndex(ptr) + 1);
+    return i and *i < end ? *i * kAlignment : offset_;
+  }
+
+  std::optional<WasmPointer> MemoryAllocator::prevChunk(
+      WasmPointer ptr) const {
+    const auto i = chunks_.prev(bitIndex(ptr));
+    if (i and *i >= bitIndex(heap_base_)) {
+      return *i * kAlignment;
+    }
+    return std::nullopt;
+  }
+
+  bool MemoryAllocator::isChunk(WasmPointer ptr) const {
+    return ptr >= heap_base_ and ptr < offset_ and ptr % kAlignment == 0
+           and chunks_.test(bitIndex(ptr));
+  }
+
+  bool MemoryAllocator::isFreeChunk(WasmPointer ptr) const {
+    return ptr >= heap_base_ and ptr < offset_ and ptr % kAlignment == 0
+           and free_chunks_.test(bitIndex(ptr));
   }
 
   WasmPointer MemoryAllocator::growAlloc(WasmSize size) {
@@ -174,35 +430,36 @@ namespace kagome::runtime {
 
   void MemoryAllocator::resize(WasmSize new_size) {
     /**
-     * We use this condition to avoid deallocated_ pointers fixup
+     * We use this condition to avoid deallocated chunks pointers fixup
      */
     BOOST_ASSERT(offset_ <= Memory::kMaxMemorySize - new_size);
     if (new_size >= size_) {
       size_ = new_size;
       memory_.resize(new_size);
+      chunks_.resize(bitIndex(size_) + 1);
+      free_chunks_.resize(bitIndex(size_) + 1);
     }
   }
 
   std::optional<WasmSize> MemoryAllocator::getDeallocatedChunkSize(
       WasmPointer ptr) const {
-    auto it = deallocated_.find(ptr);
-    return it != deallocated_.cend() ? std::make_optional(it->second)
-                                     : std::nullopt;
+    return isFreeChunk(ptr) ? std::make_optional(freeChunkSize(ptr))
+                            : std::nullopt;
   }
 
   std::optional<WasmSize> MemoryAllocator::getAllocatedChunkSize(
       WasmPointer ptr) const {
-    auto it = allocated_.find(ptr);
-    return it != allocated_.cend() ? std::make_optional(it->second)
-                                   : std::nullopt;
+    return isChunk(ptr) and not isFreeChunk(ptr)
+               ? std::make_optional<WasmSize>(nextChunk(ptr) - ptr)
+               : std::nullopt;
   }
 
   size_t MemoryAllocator::getAllocatedChunksNum() const {
-    return allocated_.size();
+    return allocated_chunks_num_;
   }
 
   size_t MemoryAllocator::getDeallocatedChunksNum() const {
-    return deallocated_.size();
+    return deallocated_chunks_num_;
   }
 
 }  // namespace kagome::runtime
@@ -6,10 +6,11 @@
 #ifndef KAGOME_CORE_RUNTIME_COMMON_MEMORY_ALLOCATOR_HPP
 #define KAGOME_CORE_RUNTIME_COMMON_MEMORY_ALLOCATOR_HPP
 
-#include <map>
-#include <unordered_map>
-
+#include <array>
+#include <functional>
 #include <optional>
+#include <utility>
+#include <vector>
 
 #include "common/literals.hpp"
 #include "log/logger.hpp"
@@ -40,13 +41,22 @@ namespace kagome::runtime {
 
   /**
    * Implementation of allocator for the runtime memory
-   * Combination of monotonic and free-list allocator
+   * Combination of monotonic and free-list allocator.
+   * Deallocated chunks are kept in segregated free lists by the power of two
+   * of their size and store their size in a header in the runtime memory.
+   * Chunk boundaries are tracked by bitmaps with a bit per kAlignment bytes,
+   * so that no host memory is allocated per (de)allocation.
+   * As the runtime may overwrite the headers, each header is checked against
+   * the bitmaps before use, and the call fails with std::runtime_error if it
+   * is corrupted.
    */
   class MemoryAllocator final {
    public:
     struct MemoryHandle {
       std::function<void(size_t)> resize;
       std::function<size_t()> getSize;
+      std::function<uint32_t(WasmPointer)> load32u;
+      std::function<void(WasmPointer, uint32_t)> store32u;
     };
     MemoryAllocator(MemoryHandle memory, size_t size, WasmPointer heap_base);
 
@@ -69,6 +79,33 @@ namespace kagome::runtime {
     size_t getDeallocatedChunksNum() const;
 
    private:
+    // a free list per each power of two of a chunk size in kAlignment units
+    static constexpr size_t kSizeClassesNum = 32;
+
+    /**
+     * Bitmap with summary levels, where a bit is set if the corresponding
+     * word of the level below is not zero. So the nearest set bit is found
+     * with a find-first-set per level instead of a scan of the words
+     */
+    class Bitmap {
+     public:
+      /// Grows the bitmap to hold at least {@param bits} bits
+      void resize(size_t bits);
+
+      bool test(size_t i) const;
+      void set(size_t i);
+      void clear(size_t i);
+
+      /// @return index of the first set bit not less than {@param i} if any
+      std::optional<size_t> next(size_t i) const;
+
+      /// @return index of the last set bit less than {@param i} if any
+      std::optional<size_t> prev(size_t i) const;
+
+     private:
+      std::vector<std::vector<uint64_t>> levels_;
+    };
+
     /**
      * Finds memory segment of given size among deallocated pieces of memory
      * and allocates a memory there
@@ -88,14 +125,83 @@ namespace kagome::runtime {
 
     void resize(WasmSize size);
 
+    /**
+     * Takes a deallocated chunk of at least given size out of the free lists
+     * @return pointer to the chunk and its size @or std::nullopt if there is
+     * no such chunk
+     */
+    std::optional<std::pair<WasmPointer, WasmSize>> takeFreeChunk(
+        WasmSize size);
+
+    /**
+     * Drops stale entries from the end of the free list {@param size_class}
+     * @return the last deallocated chunk of the list and its size if any
+     */
+    std::optional<std::pair<WasmPointer, WasmSize>> lastFreeChunk(
+        size_t size_class);
+
+    /**
+     * Removes the last entry of the free list {@param size_class}
+     */
+    void popFreeChunk(size_t size_class);
+
+    /**
+     * Marks a chunk as deallocated and pushes it to its free list
+     */
+    void putFreeChunk(WasmPointer ptr, WasmSize size);
+
+    /**
+     * @return size of the deallocated chunk {@param ptr} if it is in the free
+     * list {@param size_class}, as free lists may keep pointers to chunks which
+     * were merged with their neighbours or allocated since then
+     */
+    std::optional<WasmSize> checkFreeChunk(WasmPointer ptr,
+                                           size_t size_class) const;
+
+    /**
+     * @return size of the deallocated chunk {@param ptr} from its header
+     * @throws std::runtime_error if the header doesn't match the bitmaps
+     */
+    WasmSize freeChunkSize(WasmPointer ptr) const;
+
+    /**
+     * Drops stale entries of the free lists
+     */
+    void rebuildFreeLists();
+
+    /**
+     * @return address of the chunk following the chunk {@param ptr} or
+     * offset_ if it is the last one
+     */
+    WasmPointer nextChunk(WasmPointer ptr) const;
+
+    /**
+     * @return address of the chunk preceding the chunk {@param ptr} if any
+     */
+    std::optional<WasmPointer> prevChunk(WasmPointer ptr) const;
+
+    bool isChunk(WasmPointer ptr) const;
+    bool isFreeChunk(WasmPointer ptr) const;
+
    private:
     MemoryHandle memory_;
 
-    // map containing addresses of allocated MemoryImpl chunks
-    std::unordered_map<WasmPointer, WasmSize> allocated_;
+    // the lowest address which can be allocated
+    WasmPointer heap_base_;
+
+    // bits set for the beginnings of both allocated and deallocated chunks
+    Bitmap chunks_;
+    // bits set for the beginnings of deallocated chunks
+    Bitmap free_chunks_;
+
+    // addresses of deallocated chunks by the size class
+    std::array<std::vector<WasmPointer>, kSizeClassesNum> free_lists_;
+    size_t free_lists_entries_num_ = 0;
+    // bits set for the size classes, which free lists are not empty
+    uint32_t nonempty_classes_ = 0;
 
-    // map containing addresses to the deallocated MemoryImpl chunks
-    std::map<WasmPointer, WasmSize> deallocated_;
+    size_t allocated_chunks_num_ = 0;
+    size_t deallocated_chunks_num_ = 0;
 
     // Offset on the tail of the last allocated MemoryImpl chunk
     size_t offset_;
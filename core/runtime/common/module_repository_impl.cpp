@@ -21,7 +21,8 @@ namespace kagome::runtime {
       std::shared_ptr<RuntimeUpgradeTracker> runtime_upgrade_tracker,
       std::shared_ptr<const ModuleFactory> module_factory,
       std::shared_ptr<SingleModuleCache> last_compiled_module)
-      : runtime_upgrade_tracker_{std::move(runtime_upgrade_tracker)},
+      : runtime_instances_pool_{std::make_shared<RuntimeInstancesPool>()},
+        runtime_upgrade_tracker_{std::move(runtime_upgrade_tracker)},
         module_factory_{std::move(module_factory)},
         last_compiled_module_{std::move(last_compiled_module)},
         logger_{log::createLogger("Module Repository", "runtime")} {
@@ -43,11 +44,13 @@ namespace kagome::runtime {
       // Add compiled module if any
       if (auto module = last_compiled_module_->try_extract();
           module.has_value()) {
-        BOOST_VERIFY(runtime_instances_pool_.putModule(state, module.value()));
+        BOOST_VERIFY(
+            runtime_instances_pool_->putModule(state, module.value()));
       }
 
       // Compile new module if required
-      if (auto opt_module = runtime_instances_pool_.getModule(state);
+      awaitPrecompilation(state);
+      if (auto opt_module = runtime_instances_pool_->getModule(state);
           !opt_module.has_value()) {
         SL_DEBUG(
             logger_, "Runtime module cache miss for state {}", state.toHex());
@@ -60,17 +63,106 @@ namespace kagome::runtime {
         }
         OUTCOME_TRY(new_module, module_factory_->make(code.value()));
         BOOST_VERIFY(
-            runtime_instances_pool_.putModule(state, std::move(new_module)));
+            runtime_instances_pool_->putModule(state, std::move(new_module)));
       }
     }
 
     // Try acquire instance (instantiate if needed)
-    OUTCOME_TRY(runtime_instance, runtime_instances_pool_.tryAcquire(state));
+    OUTCOME_TRY(runtime_instance, runtime_instances_pool_->tryAcquire(state));
     KAGOME_PROFILE_END(module_retrieval)
 
     return runtime_instance;
   }
 
+  void ModuleRepositoryImpl::precompileAt(
+      std::shared_ptr<const RuntimeCodeProvider> code_provider,
+      const storage::trie::RootHash &state) {
+    std::lock_guard guard{precompilations_mutex_};
+    // forget the finished compilations, their modules are in the pool already
+    for (auto it = precompilations_.begin(); it != precompilations_.end();) {
+      if (it->second.wait_for(std::chrono::seconds::zero())
+          == std::future_status::ready) {
+        it = precompilations_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+    if (precompilations_.count(state) != 0
+        or runtime_instances_pool_->getModule(state).has_value()) {
+      return;
+    }
+
+    // code providers are not thread-safe, so the code is fetched here and
+    // the task owns its copy
+    auto code_res = code_provider->getCodeAt(state);
+    if (not code_res.has_value()) {
+      SL_WARN(logger_,
+              "Failed to get the runtime code at state {}: {}",
+              state.toHex(),
+              code_res.error().message());
+      return;
+    }
+    common::Buffer code{code_res.value()};
+
+    SL_INFO(logger_,
+            "Start compilation of the runtime at state {} in background",
+            state.toHex());
+    // the task keeps the pool and the factory alive on its own, but it does
+    // not outlive the repository: the last future of std::async is kept in
+    // precompilations_, so the destruction of the repository blocks until
+    // the compilation is finished
+    precompilations_.emplace(
+        state,
+        std::async(std::launch::async,
+                   [pool = runtime_instances_pool_,
+                    module_factory = module_factory_,
+                    code = std::move(code),
+                    state,
+                    logger = logger_]() -> outcome::result<void> {
+                     auto module_res = module_factory->make(code);
+                     if (not module_res.has_value()) {
+                       SL_WARN(logger,
+                               "Compilation of the runtime at state {} in "
+                               "background failed: {}",
+                               state.toHex(),
+                               module_res.error().message());
+                       return module_res.as_failure();
+                     }
+                     // could have been compiled on demand meanwhile
+                     if (not pool->getModule(state).has_value()) {
+                       BOOST_VERIFY(pool->putModule(
+                           state, std::move(module_res.value())));
+                     }
+                     SL_INFO(logger,
+                             "Runtime at state {} is compiled in background",
+                             state.toHex());
+                     return outcome::success();
+                   })
+            .share());
+  }
+
+  void ModuleRepositoryImpl::awaitPrecompilation(
+      const storage::trie::RootHash &state) {
+    Precompilation precompilation;
+    {
+      std::lock_guard guard{precompilations_mutex_};
+      auto it = precompilations_.find(state);
+      if (it == precompilations_.end()) {
+        return;
+      }
+      precompilation = it->second;
+    }
+    if (precompilation.wait_for(std::chrono::seconds::zero())
+        != std::future_status::ready) {
+      SL_DEBUG(logger_,
+               "Waiting for the background compilation of the runtime at "
+               "state {}",
+               state.toHex());
+    }
+    // a failed compilation is reported by the task, and is retried on demand
+    std::ignore = precompilation.get();
+  }
+
   outcome::result<std::shared_ptr<ModuleInstance>>
   RuntimeInstancesPool::tryAcquire(
       const RuntimeInstancesPool::RootHash &state) {
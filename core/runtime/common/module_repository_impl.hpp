@@ -8,6 +8,8 @@
 
 #include "runtime/module_repository.hpp"
 
+#include <future>
+#include <map>
 #include <thread>
 #include <unordered_map>
 
@@ -157,8 +159,21 @@ namespace kagome::runtime {
         const primitives::BlockInfo &block,
         const primitives::BlockHeader &header) override;
 
+    void precompileAt(std::shared_ptr<const RuntimeCodeProvider> code_provider,
+                      const storage::trie::RootHash &state) override;
+
    private:
-    RuntimeInstancesPool runtime_instances_pool_;
+    using Precompilation = std::shared_future<outcome::result<void>>;
+
+    /**
+     * Waits for the background compilation of the module for \arg state, if
+     * there is one
+     */
+    void awaitPrecompilation(const storage::trie::RootHash &state);
+
+    std::shared_ptr<RuntimeInstancesPool> runtime_instances_pool_;
+    std::mutex precompilations_mutex_;
+    std::map<storage::trie::RootHash, Precompilation> precompilations_;
     std::shared_ptr<RuntimeUpgradeTracker> runtime_upgrade_tracker_;
     std::shared_ptr<const ModuleFactory> module_factory_;
     std::shared_ptr<SingleModuleCache> last_compiled_module_;
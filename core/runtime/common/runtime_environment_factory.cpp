@@ -55,6 +55,19 @@ namespace kagome::runtime {
     BOOST_ASSERT(parent_factory_.lock() != nullptr);
   }
 
+  RuntimeEnvironmentFactory::RuntimeEnvironmentTemplate::
+      RuntimeEnvironmentTemplate(
+          std::weak_ptr<const RuntimeEnvironmentFactory> parent_factory,
+          const primitives::BlockInfo &blockchain_state,
+          std::shared_ptr<storage::trie::PersistentTrieBatch> batch)
+      : blockchain_state_{blockchain_state},
+        batch_{std::move(batch)},
+        parent_factory_{std::move(parent_factory)},
+        persistent_{true} {
+    BOOST_ASSERT(parent_factory_.lock() != nullptr);
+    BOOST_ASSERT(batch_ != nullptr);
+  }
+
   RuntimeEnvironmentFactory::RuntimeEnvironmentTemplate &
   RuntimeEnvironmentFactory::RuntimeEnvironmentTemplate::persistent() {
     persistent_ = true;
@@ -86,7 +99,9 @@ namespace kagome::runtime {
                     header_res.value()));
 
     const auto &env = instance->getEnvironment();
-    if (persistent_) {
+    if (batch_ != nullptr) {
+      env.storage_provider->setToPersistent(batch_);
+    } else if (persistent_) {
       if (auto res = env.storage_provider->setToPersistentAt(storage_state_);
           !res) {
         parent_factory->logger_->error(
@@ -147,10 +162,16 @@ namespace kagome::runtime {
       memory.storeBuffer(offset, segment);
     });
 
-    SL_DEBUG(parent_factory->logger_,
-             "Runtime environment at {}, state: {:l}",
-             blockchain_state_,
-             storage_state_);
+    if (batch_ != nullptr) {
+      SL_DEBUG(parent_factory->logger_,
+               "Runtime environment at {}, state: uncommitted batch",
+               blockchain_state_);
+    } else {
+      SL_DEBUG(parent_factory->logger_,
+               "Runtime environment at {}, state: {:l}",
+               blockchain_state_,
+               storage_state_);
+    }
 
     auto runtime_env = std::make_unique<RuntimeEnvironment>(
         instance, env.memory_provider, env.storage_provider, blockchain_state_);
@@ -179,6 +200,14 @@ namespace kagome::runtime {
         weak_from_this(), blockchain_state, storage_state);
   }
 
+  std::unique_ptr<RuntimeEnvironmentFactory::RuntimeEnvironmentTemplate>
+  RuntimeEnvironmentFactory::start(
+      const primitives::BlockInfo &blockchain_state,
+      std::shared_ptr<storage::trie::PersistentTrieBatch> batch) const {
+    return std::make_unique<RuntimeEnvironmentTemplate>(
+        weak_from_this(), blockchain_state, std::move(batch));
+  }
+
   outcome::result<
       std::unique_ptr<RuntimeEnvironmentFactory::RuntimeEnvironmentTemplate>>
   RuntimeEnvironmentFactory::start(
@@ -10,7 +10,9 @@
 #include "blockchain/block_tree.hpp"
 #include "log/profiling_logger.hpp"
 #include "runtime/common/storage_code_provider.hpp"
+#include "runtime/module_repository.hpp"
 #include "storage/predefined_keys.hpp"
+#include "storage/trie/trie_state_pruner.hpp"
 
 namespace kagome::runtime {
   template <class Stream,
@@ -33,7 +35,8 @@ namespace kagome::runtime {
       std::shared_ptr<storage::BufferStorage> storage,
       std::shared_ptr<const primitives::CodeSubstituteBlockIds>
           code_substitutes,
-      std::shared_ptr<blockchain::BlockStorage> block_storage) {
+      std::shared_ptr<blockchain::BlockStorage> block_storage,
+      std::shared_ptr<storage::trie::TrieStatePruner> state_pruner) {
     BOOST_ASSERT(header_repo);
     BOOST_ASSERT(storage);
     BOOST_ASSERT(code_substitutes);
@@ -54,7 +57,8 @@ namespace kagome::runtime {
                                       std::move(storage),
                                       std::move(code_substitutes),
                                       std::move(saved_data),
-                                      std::move(block_storage))};
+                                      std::move(block_storage),
+                                      std::move(state_pruner))};
   }
 
   RuntimeUpgradeTrackerImpl::RuntimeUpgradeTrackerImpl(
@@ -63,12 +67,14 @@ namespace kagome::runtime {
       std::shared_ptr<const primitives::CodeSubstituteBlockIds>
           code_substitutes,
       std::vector<RuntimeUpgradeData> &&saved_data,
-      std::shared_ptr<blockchain::BlockStorage> block_storage)
+      std::shared_ptr<blockchain::BlockStorage> block_storage,
+      std::shared_ptr<storage::trie::TrieStatePruner> state_pruner)
       : runtime_upgrades_{std::move(saved_data)},
         header_repo_{std::move(header_repo)},
         storage_{std::move(storage)},
         known_code_substitutes_{std::move(code_substitutes)},
         block_storage_{std::move(block_storage)},
+        state_pruner_{std::move(state_pruner)},
         logger_{log::createLogger("StorageCodeProvider", "runtime")} {}
 
   bool RuntimeUpgradeTrackerImpl::hasCodeSubstitute(
@@ -225,13 +231,30 @@ namespace kagome::runtime {
                   event_params)
                   .get();
           SL_INFO(logger_, "Runtime upgrade at block {}", block_hash.toHex());
-          (void)push(block_hash);
+          auto state_res = push(block_hash);
+          if (state_res.has_value() and module_repo_ != nullptr) {
+            module_repo_->precompileAt(code_provider_, state_res.value());
+          }
         });
   }
 
+  void RuntimeUpgradeTrackerImpl::setModuleRepository(
+      std::shared_ptr<ModuleRepository> module_repo,
+      std::shared_ptr<const RuntimeCodeProvider> code_provider) {
+    module_repo_ = std::move(module_repo);
+    code_provider_ = std::move(code_provider);
+    BOOST_ASSERT(module_repo_ != nullptr);
+    BOOST_ASSERT(code_provider_ != nullptr);
+  }
+
   outcome::result<storage::trie::RootHash> RuntimeUpgradeTrackerImpl::push(
       const primitives::BlockHash &hash) {
     OUTCOME_TRY(header, header_repo_->getBlockHeader(hash));
+    // the runtime code is loaded from the state for all the blocks up to the
+    // next upgrade, so the state has to outlive its block
+    if (state_pruner_ != nullptr) {
+      OUTCOME_TRY(state_pruner_->pinState(header.state_root));
+    }
     runtime_upgrades_.emplace_back(primitives::BlockInfo{header.number, hash},
                                    std::move(header.state_root));
     std::sort(runtime_upgrades_.begin(),
@@ -23,20 +23,30 @@ namespace kagome::blockchain {
   class BlockStorage;
 }  // namespace kagome::blockchain
 
+namespace kagome::storage::trie {
+  class TrieStatePruner;
+}  // namespace kagome::storage::trie
+
 namespace kagome::runtime {
 
+  class ModuleRepository;
+  class RuntimeCodeProvider;
+
   class RuntimeUpgradeTrackerImpl final : public RuntimeUpgradeTracker {
    public:
     /**
      * Performs a storage read to fetch saved upgrade states on initialization,
      * which may fail, thus construction only from a factory method
+     * @param state_pruner pins the states the runtime code is loaded from, so
+     * that they are never pruned, unless their blocks are discarded
      */
     static outcome::result<std::unique_ptr<RuntimeUpgradeTrackerImpl>> create(
         std::shared_ptr<const blockchain::BlockHeaderRepository> header_repo,
         std::shared_ptr<storage::BufferStorage> storage,
         std::shared_ptr<const primitives::CodeSubstituteBlockIds>
             code_substitutes,
-        std::shared_ptr<blockchain::BlockStorage> block_storage);
+        std::shared_ptr<blockchain::BlockStorage> block_storage,
+        std::shared_ptr<storage::trie::TrieStatePruner> state_pruner = nullptr);
 
     struct RuntimeUpgradeData {
       RuntimeUpgradeData() = default;
@@ -63,6 +73,15 @@ namespace kagome::runtime {
             chain_sub_engine,
         std::shared_ptr<const blockchain::BlockTree> block_tree);
 
+    /**
+     * Makes the tracker start the compilation of the new runtime in the
+     * background, as soon as a block which upgrades it is added, using
+     * \param module_repo and \param code_provider
+     */
+    void setModuleRepository(
+        std::shared_ptr<ModuleRepository> module_repo,
+        std::shared_ptr<const RuntimeCodeProvider> code_provider);
+
     outcome::result<storage::trie::RootHash> getLastCodeUpdateState(
         const primitives::BlockInfo &block) override;
 
@@ -76,7 +95,8 @@ namespace kagome::runtime {
         std::shared_ptr<const primitives::CodeSubstituteBlockIds>
             code_substitutes,
         std::vector<RuntimeUpgradeData> &&saved_data,
-        std::shared_ptr<blockchain::BlockStorage> block_storage);
+        std::shared_ptr<blockchain::BlockStorage> block_storage,
+        std::shared_ptr<storage::trie::TrieStatePruner> state_pruner);
 
     outcome::result<bool> isStateInChain(const primitives::BlockInfo &state,
                         const primitives::BlockInfo &chain_end) const noexcept;
@@ -101,11 +121,14 @@ namespace kagome::runtime {
     std::shared_ptr<primitives::events::ChainEventSubscriber>
         chain_subscription_;
     std::shared_ptr<const blockchain::BlockTree> block_tree_;
+    std::shared_ptr<ModuleRepository> module_repo_;
+    std::shared_ptr<const RuntimeCodeProvider> code_provider_;
     std::shared_ptr<const blockchain::BlockHeaderRepository> header_repo_;
     std::shared_ptr<storage::BufferStorage> storage_;
     std::shared_ptr<const primitives::CodeSubstituteBlockIds>
         known_code_substitutes_;
     std::shared_ptr<blockchain::BlockStorage> block_storage_;
+    std::shared_ptr<storage::trie::TrieStatePruner> state_pruner_;
     log::Logger logger_;
   };
 
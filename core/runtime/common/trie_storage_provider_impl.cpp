@@ -56,6 +56,14 @@ namespace kagome::runtime {
     return outcome::success();
   }
 
+  void TrieStorageProviderImpl::setToPersistent(
+      std::shared_ptr<PersistentBatch> batch) {
+    BOOST_ASSERT(batch != nullptr);
+    SL_DEBUG(logger_, "Setting storage provider to existing persistent batch");
+    persistent_batch_ = std::move(batch);
+    current_batch_ = persistent_batch_;
+  }
+
   std::shared_ptr<TrieStorageProviderImpl::Batch>
   TrieStorageProviderImpl::getCurrentBatch() const {
     return current_batch_;
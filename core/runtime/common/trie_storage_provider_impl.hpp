@@ -37,6 +37,8 @@ namespace kagome::runtime {
     outcome::result<void> setToPersistentAt(
         const common::Hash256 &state_root) override;
 
+    void setToPersistent(std::shared_ptr<PersistentBatch> batch) override;
+
     std::shared_ptr<Batch> getCurrentBatch() const override;
     std::optional<std::shared_ptr<PersistentBatch>> tryGetPersistentBatch()
         const override;
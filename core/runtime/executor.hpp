@@ -35,6 +35,16 @@ namespace kagome::runtime {
    public:
     using Buffer = common::Buffer;
 
+    /// What happens to the storage changes made by a call on a batch
+    enum class BatchChanges {
+      /// added to the batch
+      KEEP,
+      /// added to the batch only if the call succeeded
+      KEEP_IF_SUCCEEDED,
+      /// discarded, the batch stays intact
+      DISCARD,
+    };
+
     Executor(std::shared_ptr<RuntimeEnvironmentFactory> env_factory)
         : env_factory_{std::move(env_factory)},
           logger_{log::createLogger("Executor", "runtime")} {
@@ -117,6 +127,40 @@ namespace kagome::runtime {
       return res.error();
     }
 
+    /**
+     * Call a runtime method on top of the changes accumulated in \param batch,
+     * which is not committed by the call, so that several calls may be made
+     * on the same state before it is committed once (e. g. when a block is
+     * built)
+     * The call will be done with the runtime code from \param block_info state
+     * @param changes - what happens to the storage changes made by the call
+     */
+    template <typename Result, typename... Args>
+    outcome::result<Result> callOnBatch(
+        primitives::BlockInfo const &block_info,
+        std::shared_ptr<storage::trie::PersistentTrieBatch> batch,
+        BatchChanges changes,
+        std::string_view name,
+        Args &&...args) {
+      OUTCOME_TRY(env,
+                  env_factory_->start(block_info, std::move(batch))->make());
+      if (changes == BatchChanges::KEEP) {
+        return callInternal<Result>(*env, name, std::forward<Args>(args)...);
+      }
+      auto &storage = *env->storage_provider;
+      // the batch is changed only by the outermost transaction commit, so a
+      // rollback leaves it intact even if the failed call has left some
+      // nested transactions unfinished
+      OUTCOME_TRY(storage.startTransaction());
+      auto res = callInternal<Result>(*env, name, std::forward<Args>(args)...);
+      if (res and changes == BatchChanges::KEEP_IF_SUCCEEDED) {
+        OUTCOME_TRY(storage.commitTransaction());
+      } else {
+        OUTCOME_TRY(storage.rollbackTransaction());
+      }
+      return res;
+    }
+
     /**
      * Call a runtime method in an ephemeral environment, e. g. the storage
      * changes, made by this call, will NOT persist in the node's Trie storage
@@ -97,6 +97,18 @@ namespace kagome::runtime {
      * @return string with data
      */
     virtual std::string loadStr(WasmPointer addr, WasmSize n) const = 0;
+    /**
+     * View bytes of the memory without copying them, where the memory allows
+     * @param addr address in memory to view bytes at
+     * @param n number of bytes
+     * @return span pointing straight into the memory, which stays valid until
+     * the memory is resized, i.e. must not be used across allocations. A
+     * memory which does not expose its storage returns a span to a copy of
+     * the bytes instead, which is valid until several more views are taken
+     * @note out of bounds access traps the current runtime call
+     */
+    virtual gsl::span<const uint8_t> view(WasmPointer addr,
+                                          WasmSize n) const = 0;
 
     /**
      * Store integers at given address of the wasm memory
@@ -13,6 +13,7 @@
 #include "host_api/host_api.hpp"
 #include "outcome/outcome.hpp"
 #include "primitives/block_data.hpp"
+#include "storage/trie/types.hpp"
 
 namespace kagome::runtime {
 
@@ -43,6 +44,18 @@ namespace kagome::runtime {
         std::shared_ptr<const RuntimeCodeProvider> code_provider,
         const primitives::BlockInfo &block,
         const primitives::BlockHeader &header) = 0;
+
+    /**
+     * @brief Starts compilation of the runtime at the \arg state in the
+     * background, so that the module is ready by the time an instance of it
+     * is requested
+     * @param code_provider the code provider used to extract the runtime code
+     * @param state the state (as of a block which upgrades the runtime) to
+     * extract the runtime code at
+     */
+    virtual void precompileAt(
+        std::shared_ptr<const RuntimeCodeProvider> code_provider,
+        const storage::trie::RootHash &state) = 0;
   };
 
 }  // namespace kagome::runtime
@@ -15,7 +15,7 @@
 #include "primitives/check_inherents_result.hpp"
 #include "primitives/extrinsic.hpp"
 #include "primitives/inherent_data.hpp"
-#include "runtime/persistent_result.hpp"
+#include "storage/trie/trie_batches.hpp"
 
 namespace kagome::runtime {
   /**
@@ -26,28 +26,31 @@ namespace kagome::runtime {
     virtual ~BlockBuilder() = default;
 
     /**
-     * Apply the given extrinsic.
+     * Apply the given extrinsic on top of the block being built, which state
+     * is accumulated in {@param batch}. The storage changes are added to the
+     * batch only if the call succeeded
      */
-    virtual outcome::result<PersistentResult<primitives::ApplyExtrinsicResult>>
-    apply_extrinsic(const primitives::BlockInfo &block,
-                    storage::trie::RootHash const &storage_hash,
-                    const primitives::Extrinsic &extrinsic) = 0;
+    virtual outcome::result<primitives::ApplyExtrinsicResult> apply_extrinsic(
+        const primitives::BlockInfo &block,
+        const std::shared_ptr<storage::trie::PersistentTrieBatch> &batch,
+        const primitives::Extrinsic &extrinsic) = 0;
 
     /**
-     * Finish the current block.
+     * Finish the current block, which state is accumulated in {@param batch}.
      */
     virtual outcome::result<primitives::BlockHeader> finalize_block(
         const primitives::BlockInfo &block,
-        storage::trie::RootHash const &storage_hash) = 0;
+        const std::shared_ptr<storage::trie::PersistentTrieBatch> &batch) = 0;
 
     /**
      * Generate inherent extrinsics. The inherent data will vary from chain to
-     * chain.
+     * chain. {@param batch} is left intact
      */
     virtual outcome::result<std::vector<primitives::Extrinsic>>
-    inherent_extrinsics(const primitives::BlockInfo &block,
-                        storage::trie::RootHash const &storage_hash,
-                        const primitives::InherentData &data) = 0;
+    inherent_extrinsics(
+        const primitives::BlockInfo &block,
+        const std::shared_ptr<storage::trie::PersistentTrieBatch> &batch,
+        const primitives::InherentData &data) = 0;
 
     /**
      * Check that the inherents are valid. The inherent data will vary from
@@ -17,6 +17,7 @@
 #include "primitives/common.hpp"
 #include "primitives/transaction_validity.hpp"
 #include "primitives/version.hpp"
+#include "storage/trie/trie_batches.hpp"
 
 namespace kagome::runtime {
   class RuntimeCodeProvider;
@@ -52,9 +53,12 @@ namespace kagome::runtime {
     /**
      * @brief Initialize a block with the given header.
      * @param header header used for block initialization
+     * @param batch persistent batch at the parent's state, which accumulates
+     * the state of the block being built
      */
-    virtual outcome::result<storage::trie::RootHash> initialize_block(
-        const primitives::BlockHeader &header) = 0;
+    virtual outcome::result<void> initialize_block(
+        const primitives::BlockHeader &header,
+        const std::shared_ptr<storage::trie::PersistentTrieBatch> &batch) = 0;
 
     /**
      * Get current authorities
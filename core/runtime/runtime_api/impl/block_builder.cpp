@@ -14,30 +14,42 @@ namespace kagome::runtime {
     BOOST_ASSERT(executor_);
   }
 
-  outcome::result<PersistentResult<primitives::ApplyExtrinsicResult>>
-  BlockBuilderImpl::apply_extrinsic(const primitives::BlockInfo &block,
-                                    storage::trie::RootHash const &storage_hash,
-                                    const primitives::Extrinsic &extrinsic) {
-    return executor_->persistentCallAt<primitives::ApplyExtrinsicResult>(
-        block, storage_hash, "BlockBuilder_apply_extrinsic", extrinsic);
+  outcome::result<primitives::ApplyExtrinsicResult>
+  BlockBuilderImpl::apply_extrinsic(
+      const primitives::BlockInfo &block,
+      const std::shared_ptr<storage::trie::PersistentTrieBatch> &batch,
+      const primitives::Extrinsic &extrinsic) {
+    return executor_->callOnBatch<primitives::ApplyExtrinsicResult>(
+        block,
+        batch,
+        Executor::BatchChanges::KEEP_IF_SUCCEEDED,
+        "BlockBuilder_apply_extrinsic",
+        extrinsic);
   }
 
   outcome::result<primitives::BlockHeader> BlockBuilderImpl::finalize_block(
       const primitives::BlockInfo &block,
-      storage::trie::RootHash const &storage_hash) {
-    const auto res = executor_->persistentCallAt<primitives::BlockHeader>(
-        block, storage_hash, "BlockBuilder_finalize_block");
-    if (res) return res.value().result;
-    return res.error();
+      const std::shared_ptr<storage::trie::PersistentTrieBatch> &batch) {
+    // not run in a transaction, as the storage root is computed by the runtime
+    // on the persistent batch itself
+    return executor_->callOnBatch<primitives::BlockHeader>(
+        block,
+        batch,
+        Executor::BatchChanges::KEEP,
+        "BlockBuilder_finalize_block");
   }
 
   outcome::result<std::vector<primitives::Extrinsic>>
   BlockBuilderImpl::inherent_extrinsics(
       const primitives::BlockInfo &block,
-      storage::trie::RootHash const &storage_hash,
+      const std::shared_ptr<storage::trie::PersistentTrieBatch> &batch,
       const primitives::InherentData &data) {
-    return executor_->callAt<std::vector<primitives::Extrinsic>>(
-        block, storage_hash, "BlockBuilder_inherent_extrinsics", data);
+    return executor_->callOnBatch<std::vector<primitives::Extrinsic>>(
+        block,
+        batch,
+        Executor::BatchChanges::DISCARD,
+        "BlockBuilder_inherent_extrinsics",
+        data);
   }
 
   outcome::result<primitives::CheckInherentsResult>
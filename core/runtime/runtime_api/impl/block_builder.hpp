@@ -16,18 +16,19 @@ namespace kagome::runtime {
    public:
     explicit BlockBuilderImpl(std::shared_ptr<Executor> executor);
 
-    outcome::result<PersistentResult<primitives::ApplyExtrinsicResult>> apply_extrinsic(
+    outcome::result<primitives::ApplyExtrinsicResult> apply_extrinsic(
         const primitives::BlockInfo &block,
-        storage::trie::RootHash const &storage_hash,
+        const std::shared_ptr<storage::trie::PersistentTrieBatch> &batch,
         const primitives::Extrinsic &extrinsic) override;
 
     outcome::result<primitives::BlockHeader> finalize_block(
         const primitives::BlockInfo &block,
-        storage::trie::RootHash const &storage_hash) override;
+        const std::shared_ptr<storage::trie::PersistentTrieBatch> &batch)
+        override;
 
     outcome::result<std::vector<primitives::Extrinsic>> inherent_extrinsics(
         const primitives::BlockInfo &block,
-        storage::trie::RootHash const &storage_hash,
+        const std::shared_ptr<storage::trie::PersistentTrieBatch> &batch,
         const primitives::InherentData &data) override;
 
     outcome::result<primitives::CheckInherentsResult> check_inherents(
@@ -43,17 +43,18 @@ namespace kagome::runtime {
     return outcome::success();
   }
 
-  outcome::result<storage::trie::RootHash> CoreImpl::initialize_block(
-      const primitives::BlockHeader &header) {
+  outcome::result<void> CoreImpl::initialize_block(
+      const primitives::BlockHeader &header,
+      const std::shared_ptr<storage::trie::PersistentTrieBatch> &batch) {
     OUTCOME_TRY(changes_tracker_->onBlockExecutionStart(
         header.parent_hash,
         header.number - 1));  // parent's number
-    const auto res = executor_->persistentCallAt<void>(
-        header.parent_hash, "Core_initialize_block", header);
-    if (res.has_value()) {
-      return res.value().new_storage_root;
-    }
-    return res.error();
+    return executor_->callOnBatch<void>(
+        {header.number - 1, header.parent_hash},
+        batch,
+        Executor::BatchChanges::KEEP,
+        "Core_initialize_block",
+        header);
   }
 
   outcome::result<std::vector<primitives::AuthorityId>> CoreImpl::authorities(
@@ -32,8 +32,10 @@ namespace kagome::runtime {
     outcome::result<void> execute_block(
         const primitives::Block &block) override;
 
-    outcome::result<storage::trie::RootHash> initialize_block(
-        const primitives::BlockHeader &header) override;
+    outcome::result<void> initialize_block(
+        const primitives::BlockHeader &header,
+        const std::shared_ptr<storage::trie::PersistentTrieBatch> &batch)
+        override;
 
     outcome::result<std::vector<primitives::AuthorityId>> authorities(
         const primitives::BlockHash &block_hash) override;
@@ -5,9 +5,22 @@
 
 #include "runtime/runtime_api/impl/offchain_worker_api.hpp"
 
+#include <chrono>
+#include <tuple>
+
+#include <boost/asio/post.hpp>
+
 #include "application/app_configuration.hpp"
+#include "offchain/offchain_worker.hpp"
 #include "offchain/offchain_worker_factory.hpp"
 
+namespace {
+  constexpr const char *kOffchainWorkerQueueDepth =
+      "kagome_offchain_worker_queue_depth";
+  constexpr const char *kOffchainWorkerRunTime =
+      "kagome_offchain_worker_run_time";
+}  // namespace
+
 namespace kagome::runtime {
 
   OffchainWorkerApiImpl::OffchainWorkerApiImpl(
@@ -16,9 +29,44 @@ namespace kagome::runtime {
       std::shared_ptr<Executor> executor)
       : app_config_(app_config),
         ocw_factory_(std::move(ocw_factory)),
-        executor_(std::move(executor)) {
+        executor_(std::move(executor)),
+        work_guard_{workers_context_.get_executor()},
+        logger_{log::createLogger("OffchainWorkerApi", "offchain")} {
     BOOST_ASSERT(ocw_factory_);
     BOOST_ASSERT(executor_);
+
+    // Register metrics
+    metrics_registry_->registerGaugeFamily(
+        kOffchainWorkerQueueDepth,
+        "Number of offchain workers waiting for a free thread");
+    metric_queue_depth_ =
+        metrics_registry_->registerGaugeMetric(kOffchainWorkerQueueDepth);
+    metric_queue_depth_->set(0);
+    metrics_registry_->registerHistogramFamily(
+        kOffchainWorkerRunTime, "Time taken to run an offchain worker");
+    metric_run_time_ = metrics_registry_->registerHistogramMetric(
+        kOffchainWorkerRunTime,
+        {0.005, 0.01, 0.025, 0.05, 0.1, 0.25, 0.5, 1, 2.5, 5, 10, 30});
+
+    for (size_t i = 0; i < kWorkers; ++i) {
+      workers_.emplace_back([this] { workers_context_.run(); });
+    }
+  }
+
+  OffchainWorkerApiImpl::~OffchainWorkerApiImpl() {
+    {
+      std::lock_guard lock{queue_mutex_};
+      stopping_ = true;
+      queued_.reset();
+      for (auto &worker : running_) {
+        worker->stop();
+      }
+    }
+    work_guard_.reset();
+    workers_context_.stop();
+    for (auto &worker : workers_) {
+      worker.join();
+    }
   }
 
   outcome::result<void> OffchainWorkerApiImpl::offchain_worker(
@@ -39,11 +87,51 @@ namespace kagome::runtime {
       }
     }
 
-    auto worker = ocw_factory_->make(executor_, header);
+    {
+      std::lock_guard lock{queue_mutex_};
+      if (queued_.has_value()) {
+        SL_DEBUG(logger_,
+                 "Offchain worker for block #{} is outdated and not run",
+                 queued_->number);
+      }
+      queued_.emplace(header);
+      metric_queue_depth_->set(1);
+    }
+    boost::asio::post(workers_context_, [this] { runQueued(); });
+    return outcome::success();
+  }
+
+  void OffchainWorkerApiImpl::runQueued() {
+    std::optional<primitives::BlockHeader> header;
+    {
+      std::lock_guard lock{queue_mutex_};
+      // the worker has been replaced and taken by another thread
+      if (not queued_.has_value()) {
+        return;
+      }
+      header.swap(queued_);
+      metric_queue_depth_->set(0);
+    }
+
+    auto worker = ocw_factory_->make(executor_, header.value());
+    {
+      std::lock_guard lock{queue_mutex_};
+      if (stopping_) {
+        return;
+      }
+      running_.insert(worker);
+    }
 
-    auto res = worker->run();
+    auto start = std::chrono::steady_clock::now();
+    // errors are reported by the worker itself
+    std::ignore = worker->run();
+    auto duration_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                           std::chrono::steady_clock::now() - start)
+                           .count();
+    metric_run_time_->observe(static_cast<double>(duration_ms) / 1000);
 
-    return res;
+    std::lock_guard lock{queue_mutex_};
+    running_.erase(worker);
   }
 
 }  // namespace kagome::runtime
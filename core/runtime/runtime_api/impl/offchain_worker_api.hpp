@@ -8,10 +8,22 @@
 
 #include "runtime/runtime_api/offchain_worker_api.hpp"
 
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <unordered_set>
+
+#include <boost/asio/executor_work_guard.hpp>
+#include <boost/asio/io_context.hpp>
+
+#include "log/logger.hpp"
+#include "metrics/metrics.hpp"
+
 namespace kagome::application {
   class AppConfiguration;
 }
 namespace kagome::offchain {
+  class OffchainWorker;
   class OffchainWorkerFactory;
 }
 
@@ -19,23 +31,60 @@ namespace kagome::runtime {
 
   class Executor;
 
+  /**
+   * Runs offchain workers of the best blocks on a fixed number of threads.
+   * A worker waits for a free thread in a queue, where it is replaced by the
+   * worker of a newer best block, so only the newest one is run. On
+   * destruction the running workers are stopped, so their sleeping and HTTP
+   * requests do not delay the shutdown
+   */
   class OffchainWorkerApiImpl final
       : public OffchainWorkerApi,
         std::enable_shared_from_this<OffchainWorkerApiImpl> {
    public:
+    /// Number of the threads running offchain workers
+    static constexpr size_t kWorkers = 2;
+
     OffchainWorkerApiImpl(
         const application::AppConfiguration &app_config,
         std::shared_ptr<offchain::OffchainWorkerFactory> ocw_factory,
         std::shared_ptr<Executor> executor);
 
+    ~OffchainWorkerApiImpl() override;
+
     outcome::result<void> offchain_worker(
         const primitives::BlockHash &block,
         const primitives::BlockHeader &header) override;
 
    private:
+    /**
+     * Runs the queued worker if it has not been taken by another thread, runs
+     * on a worker thread
+     */
+    void runQueued();
+
     const application::AppConfiguration &app_config_;
     std::shared_ptr<offchain::OffchainWorkerFactory> ocw_factory_;
     std::shared_ptr<Executor> executor_;
+
+    std::mutex queue_mutex_;
+    // header of the best block, which worker waits for a free thread
+    std::optional<primitives::BlockHeader> queued_;
+    // workers being run, they are stopped on destruction
+    std::unordered_set<std::shared_ptr<offchain::OffchainWorker>> running_;
+    bool stopping_ = false;
+
+    boost::asio::io_context workers_context_;
+    boost::asio::executor_work_guard<boost::asio::io_context::executor_type>
+        work_guard_;
+    std::vector<std::thread> workers_;
+
+    // Metrics
+    metrics::RegistryPtr metrics_registry_ = metrics::createRegistry();
+    metrics::Gauge *metric_queue_depth_;
+    metrics::Histogram *metric_run_time_;
+
+    log::Logger logger_;
   };
 
 }  // namespace kagome::runtime
@@ -32,4 +32,30 @@ namespace kagome::runtime {
         hash, "TaggedTransactionQueue_validate_transaction", source, ext, hash);
   }
 
+  outcome::result<TaggedTransactionQueue::ValidityResults>
+  TaggedTransactionQueueImpl::validate_transactions(
+      primitives::TransactionSource source,
+      gsl::span<const primitives::Extrinsic> exts) {
+    BOOST_ASSERT(block_tree_);
+    // the best block and its state are resolved once for the whole batch
+    auto block = block_tree_->deepestLeaf();
+    OUTCOME_TRY(header, block_tree_->getBlockHeader(block.hash));
+    SL_TRACE(logger_,
+             "Validate {} transactions called at {}",
+             exts.size(),
+             block.hash.toHex());
+    ValidityResults results;
+    results.reserve(exts.size());
+    for (auto &ext : exts) {
+      results.emplace_back(executor_->callAt<primitives::TransactionValidity>(
+          block,
+          header.state_root,
+          "TaggedTransactionQueue_validate_transaction",
+          source,
+          ext,
+          block.hash));
+    }
+    return results;
+  }
+
 }  // namespace kagome::runtime
@@ -28,6 +28,10 @@ namespace kagome::runtime {
         primitives::TransactionSource source,
         const primitives::Extrinsic &ext) override;
 
+    outcome::result<ValidityResults> validate_transactions(
+        primitives::TransactionSource source,
+        gsl::span<const primitives::Extrinsic> exts) override;
+
    private:
     std::shared_ptr<Executor> executor_;
     std::shared_ptr<blockchain::BlockTree> block_tree_;
@@ -6,6 +6,8 @@
 #ifndef KAGOME_TAGGED_TRANSACTION_QUEUE_HPP
 #define KAGOME_TAGGED_TRANSACTION_QUEUE_HPP
 
+#include <gsl/span>
+
 #include "primitives/common.hpp"
 #include "primitives/extrinsic.hpp"
 #include "primitives/transaction_validity.hpp"
@@ -17,6 +19,9 @@ namespace kagome::runtime {
    */
   class TaggedTransactionQueue {
    public:
+    using ValidityResults =
+        std::vector<outcome::result<primitives::TransactionValidity>>;
+
     virtual ~TaggedTransactionQueue() = default;
 
     /**
@@ -28,6 +33,15 @@ namespace kagome::runtime {
     virtual outcome::result<primitives::TransactionValidity>
     validate_transaction(primitives::TransactionSource source,
                         const primitives::Extrinsic &ext) = 0;
+
+    /**
+     * Validates each of \param exts on the same state of the best block
+     * @return validity of each extrinsic in the order of \param exts or an
+     * error if the state to validate them at is not available
+     */
+    virtual outcome::result<ValidityResults> validate_transactions(
+        primitives::TransactionSource source,
+        gsl::span<const primitives::Extrinsic> exts) = 0;
   };
 
 }  // namespace kagome::runtime
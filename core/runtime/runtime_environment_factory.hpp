@@ -68,6 +68,17 @@ namespace kagome::runtime {
         const primitives::BlockInfo &blockchain_state,
         const storage::trie::RootHash &storage_state) const;
 
+    /**
+     * @param blockchain_state - the block to take the runtime code from
+     * @param batch - persistent batch to run on, which keeps the changes made
+     * by the previous calls on it uncommitted, e. g. during block authoring
+     * @return a RuntimeEnvironmentTemplate which can be used to configure and
+     * produce a persistent RuntimeEnvironment
+     */
+    [[nodiscard]] virtual std::unique_ptr<RuntimeEnvironmentTemplate> start(
+        const primitives::BlockInfo &blockchain_state,
+        std::shared_ptr<storage::trie::PersistentTrieBatch> batch) const;
+
     /**
      * @brief returns a handle to make a RuntimeEnvironment at the state of the
      * provided block
@@ -103,6 +114,11 @@ namespace kagome::runtime {
         const primitives::BlockInfo &blockchain_state,
         const storage::trie::RootHash &storage_state);
 
+    RuntimeEnvironmentTemplate(
+        std::weak_ptr<const RuntimeEnvironmentFactory> parent_factory_,
+        const primitives::BlockInfo &blockchain_state,
+        std::shared_ptr<storage::trie::PersistentTrieBatch> batch);
+
     virtual ~RuntimeEnvironmentTemplate() = default;
 
     [[nodiscard]] virtual RuntimeEnvironmentTemplate &persistent();
@@ -119,6 +135,9 @@ namespace kagome::runtime {
     // storage state associated with the block
     storage::trie::RootHash storage_state_;
 
+    // batch with uncommitted changes to use instead of the storage state
+    std::shared_ptr<storage::trie::PersistentTrieBatch> batch_;
+
     std::weak_ptr<const RuntimeEnvironmentFactory> parent_factory_;
     bool persistent_{false};
   };
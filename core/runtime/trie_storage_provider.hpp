@@ -45,6 +45,14 @@ namespace kagome::runtime {
     virtual outcome::result<void> setToPersistentAt(
         const common::Hash256 &state_root) = 0;
 
+    /**
+     * Sets the current batch to {@param batch}, so that the changes
+     * accumulated in it are visible to the runtime and the new ones are added
+     * to them, e. g. to make several runtime calls on the same uncommitted
+     * state
+     */
+    virtual void setToPersistent(std::shared_ptr<PersistentBatch> batch) = 0;
+
     /**
      * @returns current batch, if any was set (@see setToEphemeral,
      * setToPersistent), null otherwise
@@ -0,0 +1,219 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "runtime/wavm/compiled_module_cache.hpp"
+
+#include <algorithm>
+#include <ctime>
+#include <fstream>
+#include <iterator>
+#include <string_view>
+
+#include "common/buffer.hpp"
+#include "crypto/hasher.hpp"
+
+namespace kagome::runtime::wavm {
+
+  namespace fs = boost::filesystem;
+
+  namespace {
+    constexpr std::string_view kMagic = "KWOC";
+    constexpr std::string_view kExtension = ".wavm";
+    constexpr size_t kHeaderSize =
+        kMagic.size() + common::Hash256::size() + common::Hash256::size();
+  }  // namespace
+
+  std::string CompiledModuleCache::compilerVersion() {
+    return std::string{"WAVM "} + KAGOME_WAVM_VERSION + ", LLVM "
+         + KAGOME_LLVM_VERSION;
+  }
+
+  CompiledModuleCache::CompiledModuleCache(
+      std::shared_ptr<crypto::Hasher> hasher,
+      boost::filesystem::path cache_dir,
+      size_t size_limit,
+      std::string_view compiler_version)
+      : hasher_{std::move(hasher)},
+        cache_dir_{std::move(cache_dir)},
+        size_limit_{size_limit},
+        logger_{log::createLogger("CompiledModuleCache", "wavm")} {
+    BOOST_ASSERT(hasher_ != nullptr);
+    build_id_ = hasher_->blake2b_256(
+        common::Buffer{}.putUint32(kFormatVersion).put(compiler_version));
+    boost::system::error_code ec;
+    fs::create_directories(cache_dir_, ec);
+    if (ec) {
+      logger_->warn("Failed to create runtime cache directory {}: {}",
+                    cache_dir_.native(),
+                    ec.message());
+    }
+  }
+
+  fs::path CompiledModuleCache::entryPath(
+      gsl::span<const uint8_t> code) const {
+    auto code_hash = hasher_->blake2b_256(code);
+    return cache_dir_ / (code_hash.toHex() + std::string{kExtension});
+  }
+
+  std::optional<std::vector<uint8_t>> CompiledModuleCache::get(
+      gsl::span<const uint8_t> code) {
+    auto path = entryPath(code);
+    std::lock_guard lock{mutex_};
+
+    std::ifstream file{path.native(), std::ios::in | std::ios::binary};
+    if (!file.is_open()) {
+      SL_DEBUG(logger_, "No cached object code at {}", path.native());
+      return std::nullopt;
+    }
+    std::vector<uint8_t> content{std::istreambuf_iterator<char>{file},
+                                 std::istreambuf_iterator<char>{}};
+    file.close();
+
+    auto invalidate = [&](std::string_view reason) {
+      logger_->warn("Removing {} cached object code at {}",
+                    reason,
+                    path.native());
+      boost::system::error_code ec;
+      fs::remove(path, ec);
+      return std::nullopt;
+    };
+
+    if (content.size() < kHeaderSize
+        or not std::equal(kMagic.begin(), kMagic.end(), content.begin())) {
+      return invalidate("malformed");
+    }
+    if (not std::equal(build_id_.begin(),
+                       build_id_.end(),
+                       content.begin() + kMagic.size())) {
+      return invalidate("outdated");
+    }
+    gsl::span<const uint8_t> checksum{
+        content.data() + kMagic.size() + build_id_.size(),
+        common::Hash256::size()};
+    gsl::span<const uint8_t> object_code{content.data() + kHeaderSize,
+                                         content.size() - kHeaderSize};
+    auto actual_checksum = hasher_->blake2b_256(object_code);
+    if (not std::equal(
+            actual_checksum.begin(), actual_checksum.end(), checksum.begin())) {
+      return invalidate("corrupted");
+    }
+
+    // track the recency of usage for eviction
+    boost::system::error_code ec;
+    fs::last_write_time(path, std::time(nullptr), ec);
+
+    SL_DEBUG(logger_, "Loaded cached object code from {}", path.native());
+    return std::vector<uint8_t>(object_code.begin(), object_code.end());
+  }
+
+  void CompiledModuleCache::put(gsl::span<const uint8_t> code,
+                                gsl::span<const uint8_t> object_code) {
+    if (kHeaderSize + object_code.size() > size_limit_) {
+      SL_DEBUG(logger_,
+               "Object code of {} bytes exceeds the runtime cache size limit",
+               object_code.size());
+      return;
+    }
+    auto path = entryPath(code);
+    auto checksum = hasher_->blake2b_256(object_code);
+    std::lock_guard lock{mutex_};
+
+    // write to a temporary file first, so that an interrupted write does not
+    // leave a truncated entry behind
+    auto tmp_path = path;
+    tmp_path += ".tmp";
+    {
+      std::ofstream file{tmp_path.native(),
+                         std::ios::out | std::ios::trunc | std::ios::binary};
+      if (!file.is_open()) {
+        logger_->warn("Failed to open {} to cache object code",
+                      tmp_path.native());
+        return;
+      }
+      file.write(kMagic.data(), kMagic.size());
+      file.write(reinterpret_cast<const char *>(build_id_.data()),
+                 build_id_.size());
+      file.write(reinterpret_cast<const char *>(checksum.data()),
+                 checksum.size());
+      file.write(reinterpret_cast<const char *>(object_code.data()),
+                 object_code.size());
+      if (!file.good()) {
+        logger_->warn("Failed to write cached object code to {}",
+                      tmp_path.native());
+        file.close();
+        boost::system::error_code ec;
+        fs::remove(tmp_path, ec);
+        return;
+      }
+    }
+    boost::system::error_code ec;
+    fs::rename(tmp_path, path, ec);
+    if (ec) {
+      logger_->warn("Failed to store cached object code at {}: {}",
+                    path.native(),
+                    ec.message());
+      fs::remove(tmp_path, ec);
+      return;
+    }
+    SL_DEBUG(logger_,
+             "Cached {} bytes of object code at {}",
+             object_code.size(),
+             path.native());
+
+    evict(path);
+  }
+
+  void CompiledModuleCache::evict(const fs::path &keep) {
+    struct Entry {
+      fs::path path;
+      std::time_t last_used;
+      uintmax_t size;
+    };
+    boost::system::error_code ec;
+    std::vector<Entry> entries;
+    uintmax_t total_size = fs::file_size(keep, ec);
+
+    fs::directory_iterator it{cache_dir_, ec}, end{};
+    if (ec) {
+      logger_->warn("Failed to scan runtime cache directory {}: {}",
+                    cache_dir_.native(),
+                    ec.message());
+      return;
+    }
+    for (; it != end; it.increment(ec)) {
+      if (ec) {
+        break;
+      }
+      auto &path = it->path();
+      if (path == keep or path.extension() != kExtension.data()
+          or not fs::is_regular_file(path, ec)) {
+        continue;
+      }
+      auto size = fs::file_size(path, ec);
+      auto last_used = fs::last_write_time(path, ec);
+      if (ec) {
+        continue;
+      }
+      entries.push_back({path, last_used, size});
+      total_size += size;
+    }
+
+    std::sort(entries.begin(), entries.end(), [](auto &lhs, auto &rhs) {
+      return lhs.last_used < rhs.last_used;
+    });
+    for (auto &entry : entries) {
+      if (total_size <= size_limit_) {
+        break;
+      }
+      if (fs::remove(entry.path, ec)) {
+        SL_DEBUG(logger_,
+                 "Evicted cached object code at {}",
+                 entry.path.native());
+        total_size -= entry.size;
+      }
+    }
+  }
+
+}  // namespace kagome::runtime::wavm
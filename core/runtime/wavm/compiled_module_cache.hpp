@@ -0,0 +1,93 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_CORE_RUNTIME_WAVM_COMPILED_MODULE_CACHE_HPP
+#define KAGOME_CORE_RUNTIME_WAVM_COMPILED_MODULE_CACHE_HPP
+
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+#include <gsl/span>
+
+#include "common/blob.hpp"
+#include "log/logger.hpp"
+
+namespace kagome::crypto {
+  class Hasher;
+}
+
+namespace kagome::runtime::wavm {
+
+  /**
+   * On-disk cache of the object code WAVM compiles runtime modules to, keyed
+   * by the hash of the runtime code. Lets the node skip the compilation of
+   * the runtime it has already compiled before, e.g. on restart.
+   * Each entry is a file in the cache directory, which holds a header with
+   * the build id and the checksum of the object code, followed by the object
+   * code itself. The build id is the hash of the cache format version and of
+   * the versions of WAVM and LLVM the node is built with, so the object code
+   * of another build is never loaded. Entries of other builds and corrupted
+   * ones are treated as missing and removed. When the total size of the
+   * entries exceeds the limit, the least recently used ones are removed.
+   * Failures to access the filesystem are logged and are never fatal, as the
+   * runtime may always be compiled from scratch.
+   */
+  class CompiledModuleCache final {
+   public:
+    /**
+     * Version of the format of the cache entries. Must be bumped whenever the
+     * way the runtime is compiled changes. Updates of WAVM and LLVM are
+     * detected by compilerVersion()
+     */
+    static constexpr uint32_t kFormatVersion = 2;
+
+    /**
+     * @returns versions of WAVM and LLVM the node is built with
+     */
+    static std::string compilerVersion();
+
+    /**
+     * @param compiler_version versions of the compilers producing the object
+     * code, normally compilerVersion()
+     */
+    CompiledModuleCache(std::shared_ptr<crypto::Hasher> hasher,
+                        boost::filesystem::path cache_dir,
+                        size_t size_limit,
+                        std::string_view compiler_version);
+
+    /**
+     * @returns object code previously compiled from the runtime {@param code},
+     * or std::nullopt if there is no valid cache entry for it
+     */
+    std::optional<std::vector<uint8_t>> get(gsl::span<const uint8_t> code);
+
+    /**
+     * Stores {@param object_code} compiled from the runtime {@param code},
+     * evicting the least recently used entries if the size limit is exceeded
+     */
+    void put(gsl::span<const uint8_t> code,
+             gsl::span<const uint8_t> object_code);
+
+   private:
+    boost::filesystem::path entryPath(gsl::span<const uint8_t> code) const;
+    /// removes the least recently used entries other than {@param keep} while
+    /// the cache size exceeds the limit
+    void evict(const boost::filesystem::path &keep);
+
+    std::shared_ptr<crypto::Hasher> hasher_;
+    boost::filesystem::path cache_dir_;
+    size_t size_limit_;
+    common::Hash256 build_id_;
+    std::mutex mutex_;
+    log::Logger logger_;
+  };
+
+}  // namespace kagome::runtime::wavm
+
+#endif  // KAGOME_CORE_RUNTIME_WAVM_COMPILED_MODULE_CACHE_HPP
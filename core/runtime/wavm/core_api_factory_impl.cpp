@@ -54,6 +54,11 @@ namespace kagome::runtime::wavm {
       return instance_;
     }
 
+    void precompileAt(std::shared_ptr<const RuntimeCodeProvider>,
+                      const storage::trie::RootHash &) override {
+      // the only module is compiled on the first request
+    }
+
    private:
     std::shared_ptr<runtime::ModuleInstance> instance_;
     std::shared_ptr<const InstanceEnvironmentFactory> instance_env_factory_;
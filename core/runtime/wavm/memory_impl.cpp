@@ -24,7 +24,11 @@ namespace kagome::runtime::wavm {
                    std::make_unique<MemoryAllocator>(
                        MemoryAllocator::MemoryHandle{
                            [this](auto size) { return resize(size); },
-                           [this]() { return size(); }},
+                           [this]() { return size(); },
+                           [this](auto addr) { return load32u(addr); },
+                           [this](auto addr, auto value) {
+                             store32(addr, value);
+                           }},
                        kInitialMemorySize,
                        heap_base)} {}
 
@@ -69,22 +73,24 @@ namespace kagome::runtime::wavm {
 
   common::Buffer MemoryImpl::loadN(kagome::runtime::WasmPointer addr,
                                    kagome::runtime::WasmSize n) const {
-    common::Buffer res;
-    auto byte_array = loadArray<uint8_t>(addr, n);
-    return common::Buffer{byte_array, byte_array + n};
+    auto bytes = view(addr, n);
+    return common::Buffer{bytes};
   }
 
   std::string MemoryImpl::loadStr(kagome::runtime::WasmPointer addr,
                                   kagome::runtime::WasmSize n) const {
-    std::string res;
-    res.reserve(n);
-    for (auto i = addr; i < addr + n; i++) {
-      res.push_back(load<uint8_t>(i));
-    }
+    auto bytes = view(addr, n);
+    std::string res{bytes.begin(), bytes.end()};
     SL_TRACE_FUNC_CALL(logger_, res, this, addr, n);
     return res;
   }
 
+  gsl::span<const uint8_t> MemoryImpl::view(WasmPointer addr,
+                                            WasmSize n) const {
+    // WAVM traps the current call if the bytes are out of the memory bounds
+    return gsl::make_span(loadArray<uint8_t>(addr, n), n);
+  }
+
   void MemoryImpl::store8(WasmPointer addr, int8_t value) {
     store<int8_t>(addr, value);
   }
@@ -65,6 +65,9 @@ namespace kagome::runtime::wavm {
 
     std::string loadStr(WasmPointer addr, WasmSize n) const override;
 
+    gsl::span<const uint8_t> view(WasmPointer addr,
+                                  WasmSize n) const override;
+
     template <typename T, typename = std::enable_if_t<std::is_integral_v<T>>>
     void store(WasmPointer addr, T value) {
       SL_TRACE_VOID_FUNC_CALL(logger_, this, addr, value);
@@ -78,7 +81,7 @@ namespace kagome::runtime::wavm {
     void storeArray(WasmPointer addr, gsl::span<T> array) {
       SL_TRACE_VOID_FUNC_CALL(logger_, this, addr, array);
       std::memcpy(WAVM::Runtime::memoryArrayPtr<uint8_t>(
-                      memory_, addr, sizeof(array.size_bytes())),
+                      memory_, addr, array.size_bytes()),
                   array.data(),
                   array.size_bytes());
     }
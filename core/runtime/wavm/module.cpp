@@ -10,6 +10,7 @@
 #include <boost/assert.hpp>
 
 #include "runtime/wavm/compartment_wrapper.hpp"
+#include "runtime/wavm/compiled_module_cache.hpp"
 #include "runtime/wavm/instance_environment_factory.hpp"
 #include "runtime/wavm/intrinsics/intrinsic_module.hpp"
 #include "runtime/wavm/intrinsics/intrinsic_resolver_impl.hpp"
@@ -21,22 +22,37 @@ namespace kagome::runtime::wavm {
       std::shared_ptr<CompartmentWrapper> compartment,
       std::shared_ptr<const IntrinsicModule> intrinsic_module,
       std::shared_ptr<const InstanceEnvironmentFactory> env_factory,
-      gsl::span<const uint8_t> code) {
+      gsl::span<const uint8_t> code,
+      const std::shared_ptr<CompiledModuleCache> &module_cache) {
     std::shared_ptr<WAVM::Runtime::Module> module = nullptr;
     WAVM::WASM::LoadError loadError;
     WAVM::IR::FeatureSpec featureSpec;
+    WAVM::IR::Module ir_module{featureSpec};
 
     log::Logger logger = log::createLogger("WAVM Module", "wavm");
-    logger->info(
-        "Compiling WebAssembly module for Runtime (going to take a few dozens "
-        "of seconds)");
-    if (!WAVM::Runtime::loadBinaryModule(
-            code.data(), code.size(), module, featureSpec, &loadError)) {
+    if (!WAVM::WASM::loadBinaryModule(
+            code.data(), code.size(), ir_module, &loadError)) {
       logger->critical("Error loading WAVM binary module: {}",
                        loadError.message);
       return nullptr;
     }
 
+    if (module_cache) {
+      if (auto object_code = module_cache->get(code)) {
+        logger->info("Loading precompiled WebAssembly module for Runtime");
+        module = WAVM::Runtime::loadPrecompiledModule(ir_module, *object_code);
+      }
+    }
+    if (module == nullptr) {
+      logger->info(
+          "Compiling WebAssembly module for Runtime (going to take a few "
+          "dozens of seconds)");
+      module = WAVM::Runtime::compileModule(ir_module);
+      if (module_cache) {
+        module_cache->put(code, WAVM::Runtime::getObjectCode(module));
+      }
+    }
+
     return std::unique_ptr<ModuleImpl>(
         new ModuleImpl{std::move(compartment),
                        std::move(intrinsic_module),
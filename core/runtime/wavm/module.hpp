@@ -25,14 +25,21 @@ namespace kagome::runtime::wavm {
   class InstanceEnvironmentFactory;
   class CompartmentWrapper;
   class IntrinsicModule;
+  class CompiledModuleCache;
 
   class ModuleImpl final : public runtime::Module {
    public:
+    /**
+     * Compiles the runtime {@param code}. If {@param module_cache} is
+     * provided, the object code is loaded from it when it has been compiled
+     * before, and is stored into it otherwise
+     */
     static std::unique_ptr<ModuleImpl> compileFrom(
         std::shared_ptr<CompartmentWrapper> compartment,
         std::shared_ptr<const IntrinsicModule> intrinsic_module,
         std::shared_ptr<const InstanceEnvironmentFactory> env_factory,
-        gsl::span<const uint8_t> code);
+        gsl::span<const uint8_t> code,
+        const std::shared_ptr<CompiledModuleCache> &module_cache = nullptr);
 
     outcome::result<std::shared_ptr<kagome::runtime::ModuleInstance>>
     instantiate() const override;
@@ -12,10 +12,12 @@ namespace kagome::runtime::wavm {
   ModuleFactoryImpl::ModuleFactoryImpl(
       std::shared_ptr<CompartmentWrapper> compartment,
       std::shared_ptr<const InstanceEnvironmentFactory> env_factory,
-      std::shared_ptr<const IntrinsicModule> intrinsic_module)
+      std::shared_ptr<const IntrinsicModule> intrinsic_module,
+      std::shared_ptr<CompiledModuleCache> module_cache)
       : compartment_{std::move(compartment)},
         env_factory_{std::move(env_factory)},
-        intrinsic_module_{std::move(intrinsic_module)} {
+        intrinsic_module_{std::move(intrinsic_module)},
+        module_cache_{std::move(module_cache)} {
     BOOST_ASSERT(compartment_ != nullptr);
     BOOST_ASSERT(env_factory_ != nullptr);
     BOOST_ASSERT(intrinsic_module_ != nullptr);
@@ -24,7 +26,7 @@ namespace kagome::runtime::wavm {
   outcome::result<std::unique_ptr<Module>> ModuleFactoryImpl::make(
       gsl::span<const uint8_t> code) const {
     return ModuleImpl::compileFrom(
-        compartment_, intrinsic_module_, env_factory_, code);
+        compartment_, intrinsic_module_, env_factory_, code, module_cache_);
   }
 
 }  // namespace kagome::runtime::wavm
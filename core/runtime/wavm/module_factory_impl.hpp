@@ -15,13 +15,15 @@ namespace kagome::runtime::wavm {
   class CompartmentWrapper;
   class InstanceEnvironmentFactory;
   class IntrinsicModule;
+  class CompiledModuleCache;
 
   class ModuleFactoryImpl final : public ModuleFactory {
    public:
     ModuleFactoryImpl(
         std::shared_ptr<CompartmentWrapper> compartment,
         std::shared_ptr<const InstanceEnvironmentFactory> env_factory,
-        std::shared_ptr<const IntrinsicModule> intrinsic_module);
+        std::shared_ptr<const IntrinsicModule> intrinsic_module,
+        std::shared_ptr<CompiledModuleCache> module_cache = nullptr);
 
     outcome::result<std::unique_ptr<Module>> make(
         gsl::span<const uint8_t> code) const override;
@@ -30,6 +32,7 @@ namespace kagome::runtime::wavm {
     std::shared_ptr<CompartmentWrapper> compartment_;
     std::shared_ptr<const InstanceEnvironmentFactory> env_factory_;
     std::shared_ptr<const IntrinsicModule> intrinsic_module_;
+    std::shared_ptr<CompiledModuleCache> module_cache_;
   };
 
 }  // namespace kagome::runtime::wavm
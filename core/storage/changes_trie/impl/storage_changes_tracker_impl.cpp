@@ -22,13 +22,10 @@ namespace kagome::storage::changes_trie {
   StorageChangesTrackerImpl::StorageChangesTrackerImpl(
       std::shared_ptr<storage::trie::PolkadotTrieFactory> trie_factory,
       std::shared_ptr<storage::trie::Codec> codec,
-      primitives::events::StorageSubscriptionEnginePtr
-          storage_subscription_engine,
       primitives::events::ChainSubscriptionEnginePtr chain_subscription_engine)
       : trie_factory_(std::move(trie_factory)),
         codec_(std::move(codec)),
         parent_number_{std::numeric_limits<primitives::BlockNumber>::max()},
-        storage_subscription_engine_(std::move(storage_subscription_engine)),
         chain_subscription_engine_(std::move(chain_subscription_engine)),
         logger_{log::createLogger("Storage Changes Tracker", "changes_trie")} {
     BOOST_ASSERT(trie_factory_ != nullptr);
@@ -54,14 +51,6 @@ namespace kagome::storage::changes_trie {
       chain_subscription_engine_->notify(
           primitives::events::ChainEventType::kNewRuntime, hash);
     }
-    for (auto &pair : actual_val_) {
-      SL_TRACE(logger_,
-               "Key: 0x{}; Value 0x{};",
-               pair.first.toHex(),
-               pair.second.toHex());
-      storage_subscription_engine_->notify(
-          pair.first, pair.second, parent_hash_);
-    }
   }
 
   void StorageChangesTrackerImpl::onClearPrefix(
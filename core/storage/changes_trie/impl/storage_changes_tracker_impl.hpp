@@ -20,8 +20,6 @@ namespace kagome::storage::changes_trie {
     StorageChangesTrackerImpl(
         std::shared_ptr<storage::trie::PolkadotTrieFactory> trie_factory,
         std::shared_ptr<storage::trie::Codec> codec,
-        primitives::events::StorageSubscriptionEnginePtr
-            storage_subscription_engine,
         primitives::events::ChainSubscriptionEnginePtr
             chain_subscription_engine);
 
@@ -63,8 +61,6 @@ namespace kagome::storage::changes_trie {
 
     primitives::BlockHash parent_hash_;
     primitives::BlockNumber parent_number_;
-    primitives::events::StorageSubscriptionEnginePtr
-        storage_subscription_engine_;
     primitives::events::ChainSubscriptionEnginePtr chain_subscription_engine_;
     log::Logger logger_;
   };
@@ -7,6 +7,7 @@
 
 #include <boost/filesystem.hpp>
 #include <iostream>
+#include <sstream>
 #include <utility>
 
 #include "filesystem/common.hpp"
@@ -19,7 +20,10 @@ namespace kagome::storage {
   namespace fs = boost::filesystem;
 
   outcome::result<std::unique_ptr<LevelDB>> LevelDB::create(
-      const filesystem::path &path, leveldb::Options options) {
+      const filesystem::path &path,
+      leveldb::Options options,
+      size_t block_cache_size,
+      int bloom_filter_bits) {
     if (!filesystem::createDirectoryRecursive(path))
       return DatabaseError::DB_PATH_NOT_CREATED;
 
@@ -42,9 +46,22 @@ namespace kagome::storage {
       return DatabaseError::IO_ERROR;
     }
 
+    std::unique_ptr<leveldb::Cache> block_cache;
+    if (block_cache_size > 0) {
+      block_cache.reset(leveldb::NewLRUCache(block_cache_size));
+      options.block_cache = block_cache.get();
+    }
+    std::unique_ptr<const leveldb::FilterPolicy> filter_policy;
+    if (bloom_filter_bits > 0) {
+      filter_policy.reset(leveldb::NewBloomFilterPolicy(bloom_filter_bits));
+      options.filter_policy = filter_policy.get();
+    }
+
     auto status = leveldb::DB::Open(options, path.native(), &db);
     if (status.ok()) {
       std::unique_ptr<LevelDB> l{new LevelDB{}};
+      l->block_cache_ = std::move(block_cache);
+      l->filter_policy_ = std::move(filter_policy);
       l->db_ = std::unique_ptr<leveldb::DB>(db);
       l->logger_ = std::move(log);
       return l;
@@ -179,4 +196,43 @@ namespace kagome::storage {
     return usage_bytes;
   }
 
+  std::optional<std::string> LevelDB::getProperty(
+      const std::string &name) const {
+    std::string value;
+    if (db_ and db_->GetProperty(name, &value)) {
+      return value;
+    }
+    return std::nullopt;
+  }
+
+  size_t LevelDB::getBlockCacheUsage() const {
+    if (block_cache_) {
+      return block_cache_->TotalCharge();
+    }
+    return 0;
+  }
+
+  std::vector<LevelDB::LevelStats> LevelDB::getLevelStats() const {
+    std::vector<LevelStats> levels;
+    auto stats = getProperty("leveldb.stats");
+    if (not stats.has_value()) {
+      return levels;
+    }
+    std::istringstream stream{stats.value()};
+    std::string line;
+    // the rows of the table follow the three lines of its header
+    for (auto i = 0; i < 3 and std::getline(stream, line); ++i) {
+    }
+    while (std::getline(stream, line)) {
+      std::istringstream row{line};
+      LevelStats level;
+      if (row >> level.level >> level.files >> level.size_mb
+          >> level.compaction_time_sec >> level.compaction_read_mb
+          >> level.compaction_write_mb) {
+        levels.push_back(level);
+      }
+    }
+    return levels;
+  }
+
 }  // namespace kagome::storage
@@ -6,7 +6,9 @@
 #ifndef KAGOME_LEVELDB_HPP
 #define KAGOME_LEVELDB_HPP
 
+#include <leveldb/cache.h>
 #include <leveldb/db.h>
+#include <leveldb/filter_policy.h>
 #include <leveldb/write_batch.h>
 #include <boost/filesystem/path.hpp>
 
@@ -23,17 +25,36 @@ namespace kagome::storage {
    public:
     class Batch;
 
+    /**
+     * Compaction statistics of a level of the database, as reported by the
+     * "leveldb.stats" property
+     */
+    struct LevelStats {
+      int level = 0;
+      int files = 0;
+      double size_mb = 0;
+      double compaction_time_sec = 0;
+      double compaction_read_mb = 0;
+      double compaction_write_mb = 0;
+    };
+
     ~LevelDB() override = default;
 
     /**
      * @brief Factory method to create an instance of LevelDB class.
      * @param path filesystem path where database is going to be
      * @param options leveldb options, such as caching, logging, etc.
+     * @param block_cache_size capacity of the cache of uncompressed blocks in
+     * bytes, the leveldb default one is used if zero
+     * @param bloom_filter_bits bits per key of the bloom filter, which saves
+     * disk reads for absent keys, no filter is used if zero
      * @return instance of LevelDB
      */
     static outcome::result<std::unique_ptr<LevelDB>> create(
         const boost::filesystem::path &path,
-        leveldb::Options options = leveldb::Options());
+        leveldb::Options options = leveldb::Options(),
+        size_t block_cache_size = 0,
+        int bloom_filter_bits = 0);
 
     /**
      * @brief Set read options, which are used in @see LevelDB#get
@@ -72,9 +93,29 @@ namespace kagome::storage {
 
     size_t size() const override;
 
+    /**
+     * @return value of the leveldb property with {@param name}, or
+     * std::nullopt if there is no such property
+     */
+    std::optional<std::string> getProperty(const std::string &name) const;
+
+    /**
+     * @return memory charged to the block cache, in bytes, or zero if the
+     * leveldb default cache is used
+     */
+    size_t getBlockCacheUsage() const;
+
+    /**
+     * @return statistics of the levels which have files or compactions
+     */
+    std::vector<LevelStats> getLevelStats() const;
+
    private:
     LevelDB() = default;
 
+    // the cache and the filter policy must outlive the database
+    std::unique_ptr<leveldb::Cache> block_cache_;
+    std::unique_ptr<const leveldb::FilterPolicy> filter_policy_;
     std::unique_ptr<leveldb::DB> db_;
     leveldb::ReadOptions ro_;
     leveldb::WriteOptions wo_;
@@ -0,0 +1,43 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "storage/leveldb/leveldb_spaces.hpp"
+
+namespace kagome::storage {
+
+  outcome::result<std::shared_ptr<LevelDBSpaces>> LevelDBSpaces::create(
+      const boost::filesystem::path &path,
+      const std::map<Space, SpaceOptions> &options) {
+    auto default_it = options.find(Space::kDefault);
+    BOOST_ASSERT(default_it != options.end());
+
+    std::shared_ptr<LevelDBSpaces> spaces{new LevelDBSpaces{}};
+    for (size_t i = 0; i < spaces->databases_.size(); ++i) {
+      auto space = static_cast<Space>(i);
+      auto it = options.find(space);
+      auto &space_options =
+          it != options.end() ? it->second : default_it->second;
+      auto space_path =
+          space == Space::kDefault ? path : path / spaceName(space);
+      OUTCOME_TRY(db,
+                  LevelDB::create(space_path,
+                                  space_options.options,
+                                  space_options.block_cache_size,
+                                  space_options.bloom_filter_bits));
+      spaces->databases_[i] = std::move(db);
+    }
+    return spaces;
+  }
+
+  std::shared_ptr<BufferStorage> LevelDBSpaces::getSpace(Space space) {
+    return getDatabase(space);
+  }
+
+  std::shared_ptr<LevelDB> LevelDBSpaces::getDatabase(Space space) const {
+    BOOST_ASSERT(space < Space::kTotal);
+    return databases_.at(static_cast<size_t>(space));
+  }
+
+}  // namespace kagome::storage
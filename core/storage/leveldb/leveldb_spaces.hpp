@@ -0,0 +1,58 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_STORAGE_LEVELDB_LEVELDB_SPACES_HPP
+#define KAGOME_STORAGE_LEVELDB_LEVELDB_SPACES_HPP
+
+#include "storage/spaced_storage.hpp"
+
+#include <array>
+#include <map>
+
+#include "storage/leveldb/leveldb.hpp"
+
+namespace kagome::storage {
+
+  /**
+   * Spaced storage, which keeps each of the spaces in a separate LevelDB
+   * instance, as LevelDB does not support column families
+   */
+  class LevelDBSpaces final : public SpacedStorage {
+   public:
+    /// Options of the database of a space, @see LevelDB::create
+    struct SpaceOptions {
+      leveldb::Options options;
+      size_t block_cache_size = 0;
+      int bloom_filter_bits = 0;
+    };
+
+    /**
+     * Opens the databases of the spaces. The database of the default space is
+     * located at {@param path}, the other ones are in its subdirectories named
+     * after the spaces
+     * @param options of the databases of the spaces, the ones of the default
+     * space are used for the spaces missing in it
+     */
+    static outcome::result<std::shared_ptr<LevelDBSpaces>> create(
+        const boost::filesystem::path &path,
+        const std::map<Space, SpaceOptions> &options);
+
+    std::shared_ptr<BufferStorage> getSpace(Space space) override;
+
+    /**
+     * @return database of {@param space}
+     */
+    std::shared_ptr<LevelDB> getDatabase(Space space) const;
+
+   private:
+    LevelDBSpaces() = default;
+
+    std::array<std::shared_ptr<LevelDB>, static_cast<size_t>(Space::kTotal)>
+        databases_;
+  };
+
+}  // namespace kagome::storage
+
+#endif  // KAGOME_STORAGE_LEVELDB_LEVELDB_SPACES_HPP
@@ -26,6 +26,12 @@ namespace kagome::storage {
   inline const common::Buffer kSchedulerTreeLookupKey =
       ":kagome:authorities:scheduler_tree"_buf;
 
+  inline const common::Buffer kStatePruningEnabledKey =
+      ":kagome:state_pruning:enabled"_buf;
+
+  inline const common::Buffer kStatePruningPinnedStatesKey =
+      ":kagome:state_pruning:pinned_states"_buf;
+
   inline const common::Buffer kOffchainWorkerStoragePrefix = ":kagome:ocw"_buf;
 
   inline const common::Buffer kChildStorageDefaultPrefix =
@@ -0,0 +1,32 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_STORAGE_SPACED_STORAGE_HPP
+#define KAGOME_STORAGE_SPACED_STORAGE_HPP
+
+#include <memory>
+
+#include "storage/buffer_map_types.hpp"
+#include "storage/spaces.hpp"
+
+namespace kagome::storage {
+
+  /**
+   * Storage, which consists of physically separated key spaces, each of them
+   * having its own options, such as caching and compaction
+   */
+  class SpacedStorage {
+   public:
+    virtual ~SpacedStorage() = default;
+
+    /**
+     * @return storage of {@param space}
+     */
+    virtual std::shared_ptr<BufferStorage> getSpace(Space space) = 0;
+  };
+
+}  // namespace kagome::storage
+
+#endif  // KAGOME_STORAGE_SPACED_STORAGE_HPP
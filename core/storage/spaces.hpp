@@ -0,0 +1,44 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_STORAGE_SPACES_HPP
+#define KAGOME_STORAGE_SPACES_HPP
+
+#include <cstdint>
+#include <string>
+
+namespace kagome::storage {
+
+  /**
+   * Physically separated key spaces of the node storage, so that the data with
+   * different access patterns do not share files and compactions
+   */
+  enum class Space : uint8_t {
+    // block headers, bodies, justifications, lookup keys and the rest
+    kDefault = 0,
+    // trie nodes and their reference counters, accessed randomly
+    kTrieNode,
+
+    kTotal
+  };
+
+  /**
+   * @return name of {@param space}, e.g. to name its files
+   */
+  inline std::string spaceName(Space space) {
+    switch (space) {
+      case Space::kDefault:
+        return "default";
+      case Space::kTrieNode:
+        return "trie_node";
+      case Space::kTotal:
+        break;
+    }
+    return "unknown";
+  }
+
+}  // namespace kagome::storage
+
+#endif  // KAGOME_STORAGE_SPACES_HPP
@@ -8,7 +8,7 @@
 
 #include "common/blob.hpp"
 #include "common/buffer.hpp"
-#include "storage/trie/node.hpp"
+#include "storage/trie/polkadot_trie/trie_node.hpp"
 
 namespace kagome::storage::trie {
 
@@ -33,7 +33,7 @@ namespace kagome::storage::trie {
      * @param encoded_data a buffer containing encoded representation of a node
      * @return a node in the trie
      */
-    virtual outcome::result<std::shared_ptr<Node>> decodeNode(
+    virtual outcome::result<std::shared_ptr<TrieNode>> decodeNode(
         gsl::span<const uint8_t> encoded_data) const = 0;
 
     /**
@@ -73,6 +73,12 @@ namespace kagome::storage::trie {
     return std::move(root);
   }
 
+  outcome::result<RootHash> PersistentTrieBatchImpl::hash() {
+    OUTCOME_TRY(root, serializer_->calculateRoot(*trie_));
+    SL_TRACE_FUNC_CALL(logger_, root);
+    return std::move(root);
+  }
+
   std::unique_ptr<TopperTrieBatch> PersistentTrieBatchImpl::batchOnTop() {
     return std::make_unique<TopperTrieBatchImpl>(shared_from_this());
   }
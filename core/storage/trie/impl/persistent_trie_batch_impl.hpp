@@ -31,6 +31,7 @@ namespace kagome::storage::trie {
     ~PersistentTrieBatchImpl() override = default;
 
     outcome::result<RootHash> commit() override;
+    outcome::result<RootHash> hash() override;
     std::unique_ptr<TopperTrieBatch> batchOnTop() override;
 
     outcome::result<BufferConstRef> get(const BufferView &key) const override;
@@ -0,0 +1,300 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "storage/trie/impl/trie_diff_impl.hpp"
+
+#include <algorithm>
+
+#include "storage/trie/polkadot_trie/polkadot_trie.hpp"
+#include "storage/trie/serialization/trie_serializer.hpp"
+
+namespace {
+  using namespace kagome::storage::trie;
+  using kagome::common::Buffer;
+  using ConstNodePtr = PolkadotTrie::ConstNodePtr;
+
+  /**
+   * A point inside of a node, which partial key is consumed up to the offset.
+   * Tries of two states may split the same key path into nodes differently,
+   * so the walk advances over the partial keys nibble by nibble
+   */
+  struct Position {
+    ConstNodePtr node;
+    size_t offset = 0;
+
+    NibblesView remainingKey() const {
+      return node->key_nibbles.subspan(offset);
+    }
+  };
+
+  /**
+   * @returns the merkle value of a child of a stored node without loading the
+   * child from the storage, nullptr if it is unknown
+   */
+  const Buffer *merkleValue(const std::shared_ptr<OpaqueTrieNode> &node) {
+    if (auto dummy = nodeCast<DummyNode>(node.get()); dummy != nullptr) {
+      return &dummy->db_key;
+    }
+    if (auto trie_node = nodeCast<TrieNode>(node.get());
+        trie_node != nullptr and trie_node->getMerkleValue().has_value()) {
+      return &trie_node->getMerkleValue().value();
+    }
+    return nullptr;
+  }
+
+  std::shared_ptr<OpaqueTrieNode> opaqueChild(const TrieNode &node,
+                                              uint8_t idx) {
+    if (auto branch = nodeCast<BranchNode>(&node); branch != nullptr) {
+      return branch->children.at(idx);
+    }
+    return nullptr;
+  }
+
+  class DiffWalker {
+   public:
+    DiffWalker(const PolkadotTrie &from,
+               const PolkadotTrie &to,
+               const std::optional<std::set<Buffer>> &filter,
+               const TrieDiff::OnChange &on_change)
+        : from_{from}, to_{to}, filter_{filter}, on_change_{on_change} {}
+
+    outcome::result<void> walk() {
+      return compare({from_.getRoot()}, {to_.getRoot()});
+    }
+
+   private:
+    /**
+     * Restores the length of the current path when leaving a subtree
+     */
+    struct PathGuard {
+      explicit PathGuard(KeyNibbles &path) : path_{path}, size_{path.size()} {}
+      ~PathGuard() {
+        path_.resize(size_);
+      }
+
+     private:
+      KeyNibbles &path_;
+      size_t size_;
+    };
+
+    /**
+     * @returns true if some of the reported keys start with the current path
+     */
+    bool isRelevant() const {
+      if (not filter_.has_value()) {
+        return true;
+      }
+      auto it = filter_->lower_bound(path_);
+      return it != filter_->end() and it->size() >= path_.size()
+             and std::equal(path_.begin(), path_.end(), it->begin());
+    }
+
+    outcome::result<void> report(const std::optional<Buffer> &value) {
+      if (filter_.has_value() and filter_->find(path_) == filter_->end()) {
+        return outcome::success();
+      }
+      std::optional<kagome::common::BufferView> view;
+      if (value.has_value()) {
+        view.emplace(value.value());
+      }
+      return on_change_(path_.toByteBuffer(), view);
+    }
+
+    outcome::result<ConstNodePtr> child(const PolkadotTrie &trie,
+                                        const TrieNode &node,
+                                        uint8_t idx) const {
+      if (opaqueChild(node, idx) == nullptr) {
+        return nullptr;
+      }
+      return trie.retrieveChild(nodeCast<BranchNode>(node), idx);
+    }
+
+    /**
+     * Compares the subtrees at the current path of the old and the new state
+     */
+    outcome::result<void> compare(Position from, Position to) {
+      if (from.node == nullptr and to.node == nullptr) {
+        return outcome::success();
+      }
+      if (from.node == nullptr) {
+        return enumerate(to_, to, true);
+      }
+      if (to.node == nullptr) {
+        return enumerate(from_, from, false);
+      }
+      auto from_key = from.remainingKey();
+      auto to_key = to.remainingKey();
+      auto common = std::mismatch(from_key.begin(),
+                                  from_key.end(),
+                                  to_key.begin(),
+                                  to_key.end())
+                        .first
+                    - from_key.begin();
+      if (common < from_key.size() and common < to_key.size()) {
+        // the subtrees have no keys in common
+        if (from_key[common] < to_key[common]) {
+          OUTCOME_TRY(enumerate(from_, from, false));
+          return enumerate(to_, to, true);
+        }
+        OUTCOME_TRY(enumerate(to_, to, true));
+        return enumerate(from_, from, false);
+      }
+
+      PathGuard guard{path_};
+      path_.put(from_key.subspan(0, common));
+      if (not isRelevant()) {
+        return outcome::success();
+      }
+      from.offset += common;
+      to.offset += common;
+      from_key = from.remainingKey();
+      to_key = to.remainingKey();
+
+      if (from_key.empty() and to_key.empty()) {
+        if (from.node->value != to.node->value) {
+          OUTCOME_TRY(report(to.node->value));
+        }
+        for (uint8_t idx = 0; idx < BranchNode::kMaxChildren; ++idx) {
+          auto from_child = opaqueChild(*from.node, idx);
+          auto to_child = opaqueChild(*to.node, idx);
+          if (from_child == nullptr and to_child == nullptr) {
+            continue;
+          }
+          auto from_merkle = merkleValue(from_child);
+          auto to_merkle = merkleValue(to_child);
+          if (from_merkle != nullptr and to_merkle != nullptr
+              and *from_merkle == *to_merkle) {
+            // the subtree is shared by the states
+            continue;
+          }
+          PathGuard child_guard{path_};
+          path_.putUint8(idx);
+          if (not isRelevant()) {
+            continue;
+          }
+          OUTCOME_TRY(from_node, child(from_, *from.node, idx));
+          OUTCOME_TRY(to_node, child(to_, *to.node, idx));
+          OUTCOME_TRY(compare({from_node}, {to_node}));
+        }
+        return outcome::success();
+      }
+
+      // one of the nodes ends at the current path, while the other one goes on
+      // as its child
+      bool from_ends = from_key.empty();
+      auto &ended_trie = from_ends ? from_ : to_;
+      auto &ended = from_ends ? from : to;
+      auto &going_on = from_ends ? to : from;
+      auto going_on_idx = going_on.remainingKey()[0];
+      if (ended.node->value.has_value()) {
+        OUTCOME_TRY(report(from_ends ? std::nullopt : ended.node->value));
+      }
+      for (uint8_t idx = 0; idx < BranchNode::kMaxChildren; ++idx) {
+        if (opaqueChild(*ended.node, idx) == nullptr and idx != going_on_idx) {
+          continue;
+        }
+        PathGuard child_guard{path_};
+        path_.putUint8(idx);
+        if (not isRelevant()) {
+          continue;
+        }
+        OUTCOME_TRY(ended_child, child(ended_trie, *ended.node, idx));
+        if (idx != going_on_idx) {
+          OUTCOME_TRY(enumerate(ended_trie, {ended_child}, not from_ends));
+          continue;
+        }
+        Position next{going_on.node, going_on.offset + 1};
+        if (from_ends) {
+          OUTCOME_TRY(compare({ended_child}, next));
+        } else {
+          OUTCOME_TRY(compare(next, {ended_child}));
+        }
+      }
+      return outcome::success();
+    }
+
+    /**
+     * Reports all the entries of a subtree present in only one of the states
+     * @param added true if the subtree is in the new state, false if it is in
+     * the old one
+     */
+    outcome::result<void> enumerate(const PolkadotTrie &trie,
+                                    Position position,
+                                    bool added) {
+      if (position.node == nullptr) {
+        return outcome::success();
+      }
+      PathGuard guard{path_};
+      path_.put(position.remainingKey());
+      if (not isRelevant()) {
+        return outcome::success();
+      }
+      if (position.node->value.has_value()) {
+        OUTCOME_TRY(report(added ? position.node->value : std::nullopt));
+      }
+      for (uint8_t idx = 0; idx < BranchNode::kMaxChildren; ++idx) {
+        if (opaqueChild(*position.node, idx) == nullptr) {
+          continue;
+        }
+        PathGuard child_guard{path_};
+        path_.putUint8(idx);
+        if (not isRelevant()) {
+          continue;
+        }
+        OUTCOME_TRY(node, child(trie, *position.node, idx));
+        OUTCOME_TRY(enumerate(trie, {node}, added));
+      }
+      return outcome::success();
+    }
+
+    const PolkadotTrie &from_;
+    const PolkadotTrie &to_;
+    const std::optional<std::set<Buffer>> &filter_;
+    const TrieDiff::OnChange &on_change_;
+
+    // nibbles of the key at the current point of the walk
+    KeyNibbles path_;
+  };
+}  // namespace
+
+namespace kagome::storage::trie {
+
+  TrieDiffImpl::TrieDiffImpl(std::shared_ptr<TrieSerializer> serializer)
+      : serializer_{std::move(serializer)} {
+    BOOST_ASSERT(serializer_ != nullptr);
+  }
+
+  outcome::result<void> TrieDiffImpl::diff(const RootHash &from,
+                                           const RootHash &to,
+                                           const OnChange &on_change) const {
+    return compareStates(from, to, std::nullopt, on_change);
+  }
+
+  outcome::result<void> TrieDiffImpl::diff(
+      const RootHash &from,
+      const RootHash &to,
+      gsl::span<const common::Buffer> keys,
+      const OnChange &on_change) const {
+    std::set<common::Buffer> filter;
+    for (auto &key : keys) {
+      filter.emplace(KeyNibbles::fromByteBuffer(key));
+    }
+    return compareStates(from, to, std::move(filter), on_change);
+  }
+
+  outcome::result<void> TrieDiffImpl::compareStates(
+      const RootHash &from,
+      const RootHash &to,
+      std::optional<std::set<common::Buffer>> filter,
+      const OnChange &on_change) const {
+    if (from == to) {
+      return outcome::success();
+    }
+    OUTCOME_TRY(from_trie, serializer_->retrieveTrie(common::Buffer{from}));
+    OUTCOME_TRY(to_trie, serializer_->retrieveTrie(common::Buffer{to}));
+    return DiffWalker{*from_trie, *to_trie, filter, on_change}.walk();
+  }
+
+}  // namespace kagome::storage::trie
@@ -0,0 +1,47 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_STORAGE_TRIE_IMPL_TRIE_DIFF_IMPL
+#define KAGOME_STORAGE_TRIE_IMPL_TRIE_DIFF_IMPL
+
+#include "storage/trie/trie_diff.hpp"
+
+#include <set>
+
+namespace kagome::storage::trie {
+  class TrieSerializer;
+}
+
+namespace kagome::storage::trie {
+
+  class TrieDiffImpl final : public TrieDiff {
+   public:
+    explicit TrieDiffImpl(std::shared_ptr<TrieSerializer> serializer);
+
+    outcome::result<void> diff(const RootHash &from,
+                               const RootHash &to,
+                               const OnChange &on_change) const override;
+
+    outcome::result<void> diff(const RootHash &from,
+                               const RootHash &to,
+                               gsl::span<const common::Buffer> keys,
+                               const OnChange &on_change) const override;
+
+   private:
+    /**
+     * @param filter nibbles of the keys to report, std::nullopt to report all
+     */
+    outcome::result<void> compareStates(
+        const RootHash &from,
+        const RootHash &to,
+        std::optional<std::set<common::Buffer>> filter,
+        const OnChange &on_change) const;
+
+    std::shared_ptr<TrieSerializer> serializer_;
+  };
+
+}  // namespace kagome::storage::trie
+
+#endif  // KAGOME_STORAGE_TRIE_IMPL_TRIE_DIFF_IMPL
@@ -0,0 +1,357 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "storage/trie/impl/trie_state_pruner_impl.hpp"
+
+#include <algorithm>
+
+#include "scale/scale.hpp"
+#include "storage/predefined_keys.hpp"
+#include "storage/trie/codec.hpp"
+#include "storage/trie/polkadot_trie/trie_node.hpp"
+#include "storage/trie/trie_storage_backend.hpp"
+
+namespace {
+  constexpr auto prunedTrieNodesMetricName = "kagome_state_pruned_trie_nodes";
+}
+
+OUTCOME_CPP_DEFINE_CATEGORY(kagome::storage::trie,
+                            TrieStatePrunerImpl::Error,
+                            e) {
+  using E = kagome::storage::trie::TrieStatePrunerImpl::Error;
+  switch (e) {
+    case E::MISSING_REFCOUNT:
+      return "Trie node stored with the state pruning enabled has no reference "
+             "counter";
+  }
+  return "Unknown error";
+}
+
+namespace kagome::storage::trie {
+
+  outcome::result<std::shared_ptr<TrieStatePrunerImpl>>
+  TrieStatePrunerImpl::create(std::shared_ptr<Codec> codec,
+                              std::shared_ptr<TrieStorageBackend> node_storage,
+                              std::shared_ptr<BufferStorage> refcount_storage,
+                              std::shared_ptr<BufferStorage> storage,
+                              uint32_t pruning_depth) {
+    BOOST_ASSERT(node_storage != nullptr);
+    BOOST_ASSERT(storage != nullptr);
+
+    // the marker tells whether the pruning has been enabled since the node
+    // storage was empty, it is kept until the pruning is disabled
+    bool all_nodes_counted = false;
+    OUTCOME_TRY(marker, storage->tryLoad(kStatePruningEnabledKey));
+    if (marker.has_value()) {
+      OUTCOME_TRY(decoded, scale::decode<bool>(marker.value()));
+      all_nodes_counted = decoded;
+    } else {
+      all_nodes_counted = node_storage->empty();
+      OUTCOME_TRY(encoded, scale::encode(all_nodes_counted));
+      OUTCOME_TRY(storage->put(kStatePruningEnabledKey,
+                               common::Buffer{std::move(encoded)}));
+    }
+
+    std::vector<RootHash> pinned_states;
+    OUTCOME_TRY(pinned, storage->tryLoad(kStatePruningPinnedStatesKey));
+    if (pinned.has_value()) {
+      OUTCOME_TRY(decoded,
+                  scale::decode<std::vector<RootHash>>(pinned.value()));
+      pinned_states = std::move(decoded);
+    }
+
+    return std::shared_ptr<TrieStatePrunerImpl>{
+        new TrieStatePrunerImpl(std::move(codec),
+                                std::move(node_storage),
+                                std::move(refcount_storage),
+                                std::move(storage),
+                                pruning_depth,
+                                all_nodes_counted,
+                                std::move(pinned_states))};
+  }
+
+  TrieStatePrunerImpl::TrieStatePrunerImpl(
+      std::shared_ptr<Codec> codec,
+      std::shared_ptr<TrieStorageBackend> node_storage,
+      std::shared_ptr<BufferStorage> refcount_storage,
+      std::shared_ptr<BufferStorage> storage,
+      uint32_t pruning_depth,
+      bool all_nodes_counted,
+      std::vector<RootHash> pinned_states)
+      : codec_{std::move(codec)},
+        node_storage_{std::move(node_storage)},
+        refcount_storage_{std::move(refcount_storage)},
+        storage_{std::move(storage)},
+        pruning_depth_{pruning_depth},
+        all_nodes_counted_{all_nodes_counted},
+        empty_root_{codec_->hash256(common::Buffer{0})},
+        child_storage_prefix_{
+            KeyNibbles::fromByteBuffer(kChildStorageDefaultPrefix)},
+        pinned_states_{std::move(pinned_states)},
+        logger_{log::createLogger("TrieStatePruner", "storage")} {
+    BOOST_ASSERT(codec_ != nullptr);
+    BOOST_ASSERT(node_storage_ != nullptr);
+    BOOST_ASSERT(refcount_storage_ != nullptr);
+    BOOST_ASSERT(storage_ != nullptr);
+
+    registry_->registerCounterFamily(
+        prunedTrieNodesMetricName,
+        "Number of trie nodes removed from the storage by the state pruning");
+    metric_pruned_nodes_ =
+        registry_->registerCounterMetric(prunedTrieNodesMetricName);
+    SL_DEBUG(logger_,
+             "State pruning is enabled with depth {}{}",
+             pruning_depth_,
+             all_nodes_counted_ ? "" : ", nodes stored before are kept");
+  }
+
+  uint32_t TrieStatePrunerImpl::pruningDepth() const {
+    return pruning_depth_;
+  }
+
+  outcome::result<void> TrieStatePrunerImpl::addNodes(
+      const RootHash &root, const StoredNodes &new_nodes) {
+    std::lock_guard lock{mutex_};
+    RefCounts updates;
+    common::Buffer root_key{root};
+    OUTCOME_TRY(root_count, getRefCount(root_key, updates));
+    if (root_count.has_value()) {
+      // the same state has been stored already
+      return outcome::success();
+    }
+    auto root_it = new_nodes.find(root_key);
+    if (root_it == new_nodes.end()) {
+      return onMissingRefCount(root_key);
+    }
+    // the root is referenced only by the blocks and the pins of the state,
+    // or by the parent states if it is a child trie
+    updates[root_key] = 0;
+    OUTCOME_TRY(referenced, getReferences(root_it->second, KeyNibbles{}));
+    while (not referenced.empty()) {
+      auto [key, path] = std::move(referenced.back());
+      referenced.pop_back();
+      OUTCOME_TRY(count, getRefCount(key, updates));
+      if (count.has_value()) {
+        updates[key] = count.value() + 1;
+        continue;
+      }
+      auto it = new_nodes.find(key);
+      if (it == new_nodes.end()) {
+        OUTCOME_TRY(onMissingRefCount(key));
+        continue;
+      }
+      // a new node references its children
+      OUTCOME_TRY(children, getReferences(it->second, path));
+      updates[key] = 1;
+      std::move(children.begin(),
+                children.end(),
+                std::back_inserter(referenced));
+    }
+    return commitRefCounts(updates);
+  }
+
+  outcome::result<void> TrieStatePrunerImpl::addState(const RootHash &root) {
+    std::lock_guard lock{mutex_};
+    return referenceState(root);
+  }
+
+  outcome::result<void> TrieStatePrunerImpl::pinState(const RootHash &root) {
+    std::lock_guard lock{mutex_};
+    if (std::find(pinned_states_.begin(), pinned_states_.end(), root)
+        != pinned_states_.end()) {
+      return outcome::success();
+    }
+    OUTCOME_TRY(referenceState(root));
+    pinned_states_.emplace_back(root);
+    OUTCOME_TRY(savePinnedStates());
+    SL_DEBUG(logger_, "Pinned state {}", root.toHex());
+    return outcome::success();
+  }
+
+  outcome::result<void> TrieStatePrunerImpl::unpinState(const RootHash &root) {
+    std::lock_guard lock{mutex_};
+    auto it = std::find(pinned_states_.begin(), pinned_states_.end(), root);
+    if (it == pinned_states_.end()) {
+      return outcome::success();
+    }
+    // the pin is dropped before its reference, so that an interrupted unpin
+    // may only leave the state unpruned
+    pinned_states_.erase(it);
+    OUTCOME_TRY(savePinnedStates());
+    SL_DEBUG(logger_, "Unpinned state {}", root.toHex());
+    return dereferenceState(root);
+  }
+
+  outcome::result<void> TrieStatePrunerImpl::pruneState(const RootHash &root) {
+    std::lock_guard lock{mutex_};
+    return dereferenceState(root);
+  }
+
+  outcome::result<void> TrieStatePrunerImpl::dereferenceState(
+      const RootHash &root) {
+    if (root == empty_root_) {
+      return outcome::success();
+    }
+    RefCounts updates;
+    common::Buffer root_key{root};
+    OUTCOME_TRY(root_count, getRefCount(root_key, updates));
+    if (root_count.value_or(0) == 0) {
+      // the state is not referenced by any block, e.g. the blocks with it have
+      // been added by their headers only
+      return outcome::success();
+    }
+    std::vector<common::Buffer> removed;
+    std::vector<Reference> dereferenced;
+    dereferenced.push_back({std::move(root_key), KeyNibbles{}});
+    while (not dereferenced.empty()) {
+      auto [key, path] = std::move(dereferenced.back());
+      dereferenced.pop_back();
+      OUTCOME_TRY(count, getRefCount(key, updates));
+      if (not count.has_value()) {
+        OUTCOME_TRY(onMissingRefCount(key));
+        continue;
+      }
+      if (count.value() > 1) {
+        updates[key] = count.value() - 1;
+        continue;
+      }
+      // the last reference is dropped, so the node is removed and does not
+      // reference its children anymore
+      OUTCOME_TRY(enc, node_storage_->load(key));
+      OUTCOME_TRY(children, getReferences(enc, path));
+      updates[key] = std::nullopt;
+      std::move(children.begin(),
+                children.end(),
+                std::back_inserter(dereferenced));
+      removed.emplace_back(std::move(key));
+    }
+    OUTCOME_TRY(commitRefCounts(updates));
+
+    auto batch = node_storage_->batch();
+    for (auto &key : removed) {
+      OUTCOME_TRY(batch->remove(key));
+    }
+    OUTCOME_TRY(batch->commit());
+    metric_pruned_nodes_->inc(removed.size());
+    SL_DEBUG(logger_,
+             "Pruned state {}, {} trie nodes removed",
+             root.toHex(),
+             removed.size());
+    return outcome::success();
+  }
+
+  outcome::result<void> TrieStatePrunerImpl::referenceState(
+      const RootHash &root) {
+    if (root == empty_root_) {
+      return outcome::success();
+    }
+    RefCounts updates;
+    common::Buffer key{root};
+    OUTCOME_TRY(count, getRefCount(key, updates));
+    if (not count.has_value()) {
+      return onMissingRefCount(key);
+    }
+    updates[key] = count.value() + 1;
+    return commitRefCounts(updates);
+  }
+
+  outcome::result<void> TrieStatePrunerImpl::savePinnedStates() {
+    OUTCOME_TRY(encoded, scale::encode(pinned_states_));
+    return storage_->put(kStatePruningPinnedStatesKey,
+                         common::Buffer{std::move(encoded)});
+  }
+
+  outcome::result<void> TrieStatePrunerImpl::onMissingRefCount(
+      const common::Buffer &key) const {
+    if (all_nodes_counted_) {
+      SL_ERROR(logger_, "Trie node {} has no reference counter", key.toHex());
+      return Error::MISSING_REFCOUNT;
+    }
+    // the node was stored before the pruning was enabled
+    return outcome::success();
+  }
+
+  outcome::result<std::optional<uint32_t>> TrieStatePrunerImpl::getRefCount(
+      const common::Buffer &key, const RefCounts &updates) const {
+    if (auto it = updates.find(key); it != updates.end()) {
+      return it->second;
+    }
+    OUTCOME_TRY(enc, refcount_storage_->tryLoad(key));
+    if (not enc.has_value()) {
+      return std::nullopt;
+    }
+    OUTCOME_TRY(count, scale::decode<uint32_t>(enc.value()));
+    return count;
+  }
+
+  outcome::result<void> TrieStatePrunerImpl::commitRefCounts(
+      const RefCounts &updates) {
+    auto batch = refcount_storage_->batch();
+    for (auto &[key, count] : updates) {
+      if (not count.has_value()) {
+        OUTCOME_TRY(batch->remove(key));
+      } else {
+        OUTCOME_TRY(enc, scale::encode(count.value()));
+        OUTCOME_TRY(batch->put(key, common::Buffer{std::move(enc)}));
+      }
+    }
+    return batch->commit();
+  }
+
+  outcome::result<std::vector<TrieStatePrunerImpl::Reference>>
+  TrieStatePrunerImpl::getReferences(
+      const common::Buffer &enc, const std::optional<KeyNibbles> &path) const {
+    OUTCOME_TRY(node, codec_->decodeNode(enc));
+    std::optional<KeyNibbles> node_path;
+    if (path.has_value()) {
+      node_path = *path;
+      node_path->put(node->key_nibbles);
+      if (not mayReferenceChildTries(*node_path)) {
+        node_path.reset();
+      }
+    }
+    std::vector<Reference> references;
+    // the value of a key under the child storage prefix is the root of a
+    // child trie, which is stored with the same pruner. The nodes containing
+    // hashes store the hashes of the values instead, which are never roots
+    const auto stores_value = node->kind() == TrieNode::Kind::Leaf
+                           or node->kind() == TrieNode::Kind::Branch;
+    if (node_path.has_value()
+        and node_path->size() > child_storage_prefix_.size() and stores_value
+        and node->value.has_value() and node->value->size() == RootHash::size()
+        and *node->value != common::Buffer{empty_root_}) {
+      references.push_back({*node->value, std::nullopt});
+    }
+    if (auto branch = nodeCast<BranchNode>(node); branch != nullptr) {
+      for (uint8_t i = 0; i < branch->children.size(); ++i) {
+        auto dummy = nodeCast<DummyNode>(branch->children[i]);
+        if (dummy == nullptr) {
+          continue;
+        }
+        std::optional<KeyNibbles> child_path;
+        if (node_path.has_value()) {
+          child_path = *node_path;
+          child_path->putUint8(i);
+          if (not mayReferenceChildTries(*child_path)) {
+            child_path.reset();
+          }
+        }
+        references.push_back(
+            {std::move(dummy->db_key), std::move(child_path)});
+      }
+    }
+    return references;
+  }
+
+  bool TrieStatePrunerImpl::mayReferenceChildTries(
+      const KeyNibbles &path) const {
+    // either the path leads to the prefix or it is under the prefix
+    auto length = std::min(path.size(), child_storage_prefix_.size());
+    return std::equal(path.begin(),
+                      path.begin() + length,
+                      child_storage_prefix_.begin());
+  }
+
+}  // namespace kagome::storage::trie
@@ -0,0 +1,157 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_STORAGE_TRIE_IMPL_TRIE_STATE_PRUNER_IMPL
+#define KAGOME_STORAGE_TRIE_IMPL_TRIE_STATE_PRUNER_IMPL
+
+#include "storage/trie/trie_state_pruner.hpp"
+
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include "log/logger.hpp"
+#include "metrics/metrics.hpp"
+#include "storage/buffer_map_types.hpp"
+#include "storage/trie/polkadot_trie/trie_node.hpp"
+
+namespace kagome::storage::trie {
+  class Codec;
+  class TrieStorageBackend;
+}  // namespace kagome::storage::trie
+
+namespace kagome::storage::trie {
+
+  /**
+   * Keeps the reference counters of the nodes in a separate key space of the
+   * storage. Counters are committed before the nodes are removed, so that an
+   * interrupted pruning may only leave unreferenced nodes behind
+   */
+  class TrieStatePrunerImpl final : public TrieStatePruner {
+   public:
+    enum class Error { MISSING_REFCOUNT = 1 };
+
+    /**
+     * Reads the pruning marker and the pinned states from {@param storage},
+     * which may fail, thus construction only from a factory method. If the
+     * pruning is enabled on an empty node storage for the first time, every
+     * node is counted, so a node without a counter is reported as an error
+     * @param node_storage storage of the trie nodes
+     * @param refcount_storage storage of the node reference counters
+     * @param storage storage of the pruning marker and the pinned states
+     * @param pruning_depth number of the latest finalized blocks, which states
+     * are kept
+     */
+    static outcome::result<std::shared_ptr<TrieStatePrunerImpl>> create(
+        std::shared_ptr<Codec> codec,
+        std::shared_ptr<TrieStorageBackend> node_storage,
+        std::shared_ptr<BufferStorage> refcount_storage,
+        std::shared_ptr<BufferStorage> storage,
+        uint32_t pruning_depth);
+
+    uint32_t pruningDepth() const override;
+
+    outcome::result<void> addNodes(const RootHash &root,
+                                   const StoredNodes &new_nodes) override;
+
+    outcome::result<void> addState(const RootHash &root) override;
+
+    outcome::result<void> pinState(const RootHash &root) override;
+
+    outcome::result<void> unpinState(const RootHash &root) override;
+
+    outcome::result<void> pruneState(const RootHash &root) override;
+
+   private:
+    /// Updated counters by node keys, std::nullopt means the counter is removed
+    using RefCounts =
+        std::unordered_map<common::Buffer, std::optional<uint32_t>>;
+
+    /**
+     * A node referenced by another one, either as a child or as the root of
+     * a child trie
+     */
+    struct Reference {
+      common::Buffer key;
+      // nibbles of the path to the node, kept only while its subtrie may
+      // contain roots of the child tries
+      std::optional<KeyNibbles> path;
+    };
+
+    TrieStatePrunerImpl(std::shared_ptr<Codec> codec,
+                        std::shared_ptr<TrieStorageBackend> node_storage,
+                        std::shared_ptr<BufferStorage> refcount_storage,
+                        std::shared_ptr<BufferStorage> storage,
+                        uint32_t pruning_depth,
+                        bool all_nodes_counted,
+                        std::vector<RootHash> pinned_states);
+
+    /**
+     * @returns the reference counter of a node, taking the not yet committed
+     * {@param updates} into account, or std::nullopt if it has none
+     */
+    outcome::result<std::optional<uint32_t>> getRefCount(
+        const common::Buffer &key, const RefCounts &updates) const;
+
+    outcome::result<void> commitRefCounts(const RefCounts &updates);
+
+    /**
+     * Handles a node with {@param key} which has no reference counter, that is
+     * only expected for the nodes stored before the pruning was enabled
+     */
+    outcome::result<void> onMissingRefCount(const common::Buffer &key) const;
+
+    /// Increments the counter of the root of a stored state
+    outcome::result<void> referenceState(const RootHash &root);
+
+    /**
+     * Decrements the counter of the root of a stored state, removing the
+     * nodes which are not referenced anymore
+     */
+    outcome::result<void> dereferenceState(const RootHash &root);
+
+    outcome::result<void> savePinnedStates();
+
+    /**
+     * @returns the nodes referenced by the node with {@param enc} at
+     * {@param path}: its children and, if its value is stored under the child
+     * storage prefix, the root of the child trie
+     */
+    outcome::result<std::vector<Reference>> getReferences(
+        const common::Buffer &enc, const std::optional<KeyNibbles> &path) const;
+
+    /**
+     * @returns whether the node at {@param path} or its descendants may store
+     * the roots of the child tries
+     */
+    bool mayReferenceChildTries(const KeyNibbles &path) const;
+
+    std::shared_ptr<Codec> codec_;
+    std::shared_ptr<TrieStorageBackend> node_storage_;
+    std::shared_ptr<BufferStorage> refcount_storage_;
+    std::shared_ptr<BufferStorage> storage_;
+    const uint32_t pruning_depth_;
+    // the pruning was enabled when the node storage was empty
+    const bool all_nodes_counted_;
+    // the empty state is never stored, so it is neither counted
+    const RootHash empty_root_;
+    const KeyNibbles child_storage_prefix_;
+
+    // guards the read-modify-write of the counters and the pinned states
+    std::mutex mutex_;
+    std::vector<RootHash> pinned_states_;
+
+    log::Logger logger_;
+
+    // metrics
+    metrics::RegistryPtr registry_ = metrics::createRegistry();
+    metrics::Counter *metric_pruned_nodes_;
+  };
+
+}  // namespace kagome::storage::trie
+
+OUTCOME_HPP_DECLARE_ERROR(kagome::storage::trie, TrieStatePrunerImpl::Error)
+
+#endif  // KAGOME_STORAGE_TRIE_IMPL_TRIE_STATE_PRUNER_IMPL
@@ -34,7 +34,7 @@ namespace kagome::storage::trie {
   [[nodiscard]] outcome::result<void>
   PolkadotTrieCursorImpl::SearchState::visitChild(uint8_t index,
                                                   const TrieNode &child) {
-    auto *current_as_branch = dynamic_cast<const BranchNode *>(current_);
+    auto *current_as_branch = nodeCast<BranchNode>(current_);
     if (current_as_branch == nullptr) return Error::INVALID_NODE_TYPE;
     path_.emplace_back(*current_as_branch, index);
     current_ = &child;
@@ -108,7 +108,7 @@ namespace kagome::storage::trie {
       auto type = current->getTrieType();
       if (type == NodeType::BranchEmptyValue
           or type == NodeType::BranchWithValue) {
-        auto &branch = dynamic_cast<const BranchNode &>(*current);
+        auto &branch = nodeCast<BranchNode>(*current);
         // find the rightmost child
         for (int8_t i = BranchNode::kMaxChildren - 1; i >= 0; i--) {
           if (branch.children.at(i) != nullptr) {
@@ -176,7 +176,7 @@ namespace kagome::storage::trie {
         case NodeType::BranchEmptyValue:
         case NodeType::BranchWithValue: {
           auto mismatch_pos = sought_nibbles_mismatch - sought_nibbles.begin();
-          auto &branch = dynamic_cast<const BranchNode &>(current);
+          auto &branch = nodeCast<BranchNode>(current);
           SAFE_CALL(child,
                     visitChildWithMinIdx(branch, sought_nibbles[mismatch_pos]))
           if (child) {
@@ -287,7 +287,7 @@ namespace kagome::storage::trie {
     BOOST_ASSERT(std::holds_alternative<SearchState>(state_));
     auto &search_state = std::get<SearchState>(state_);
     for (uint8_t i = min_idx; i < BranchNode::kMaxChildren; i++) {
-      auto &branch = dynamic_cast<const BranchNode &>(parent);
+      auto &branch = nodeCast<BranchNode>(parent);
       if (branch.children.at(i)) {
         OUTCOME_TRY(child, trie_->retrieveChild(branch, i));
         BOOST_ASSERT(child != nullptr);
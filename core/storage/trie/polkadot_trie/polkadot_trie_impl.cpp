@@ -88,6 +88,21 @@ namespace {
     return it - first.begin();
   }
 
+  /**
+   * Replaces the child of a branch with the provided node (which is possibly
+   * the same node after some modifications) and marks the branch dirty if the
+   * child has been changed
+   */
+  void updateChild(BranchNode &branch,
+                   uint8_t idx,
+                   const PolkadotTrie::NodePtr &child) {
+    auto &current = branch.children.at(idx);
+    if (current != child or (child != nullptr and child->isDirty())) {
+      current = child;
+      branch.setDirty();
+    }
+  }
+
   /**
    * Fixes node type, merge nodes after children removal
    * 1. if node has no children left, but has value, then turn to leaf.
@@ -101,7 +116,7 @@ namespace {
       PolkadotTrie::NodePtr &parent,
       OpaqueNodeStorage &node_storage) {
     if (!parent->isBranch()) return outcome::success();
-    auto &branch = dynamic_cast<BranchNode &>(*parent);
+    auto &branch = nodeCast<BranchNode>(*parent);
     auto bitmap = branch.childrenBitmap();
     if (bitmap == 0) {
       if (parent->value) {
@@ -125,13 +140,14 @@ namespace {
                  "handleDeletion: turn a branch with single leaf child into "
                  "its child");
       } else if (child->isBranch()) {
-        branch.children = dynamic_cast<BranchNode &>(*child).children;
+        branch.children = nodeCast<BranchNode>(*child).children;
         parent->value = child->value;
         SL_TRACE(logger,
                  "handleDeletion: turn a branch with single branch child into "
                  "its child");
       }
       parent->key_nibbles.putUint8(idx).putBuffer(child->key_nibbles);
+      parent->setDirty();
     }
     return outcome::success();
   }
@@ -153,10 +169,13 @@ namespace {
              sought_key);
 
     if (node->isBranch()) {
-      auto &branch = dynamic_cast<BranchNode &>(*node);
+      auto &branch = nodeCast<BranchNode>(*node);
       if (node->key_nibbles == sought_key) {
         SL_TRACE(logger, "deleteNode: deleting value in branch; stop");
-        node->value = std::nullopt;
+        if (node->value) {
+          node->value = std::nullopt;
+          node->setDirty();
+        }
       } else {
         auto length = getCommonPrefixLength(node->key_nibbles, sought_key);
         OUTCOME_TRY(child, node_storage.getChild(branch, sought_key[length]));
@@ -164,7 +183,7 @@ namespace {
             logger, "deleteNode: go to child {:x}", (int)sought_key[length]);
         OUTCOME_TRY(deleteNode(
             logger, child, sought_key.subspan(length + 1), node_storage));
-        branch.children[sought_key[length]] = child;
+        updateChild(branch, sought_key[length], child);
       }
       OUTCOME_TRY(handleDeletion(logger, node, node_storage));
     } else if (node->key_nibbles == sought_key) {
@@ -212,7 +231,7 @@ namespace {
               prefix.begin(), prefix.end(), parent->key_nibbles.begin())) {
         // remove all children one by one according to limit
         if (parent->isBranch()) {
-          auto &branch = dynamic_cast<BranchNode &>(*parent);
+          auto &branch = nodeCast<BranchNode>(*parent);
           for (uint8_t child_idx = 0; child_idx < branch.kMaxChildren;
                child_idx++) {
             if (branch.children[child_idx] != nullptr) {
@@ -225,7 +244,7 @@ namespace {
                                      count,
                                      callback,
                                      node_storage));
-              branch.children[child_idx] = child_node;
+              updateChild(branch, child_idx, child_node);
             }
           }
         }
@@ -259,7 +278,7 @@ namespace {
 
     if (parent->isBranch()) {
       const auto length = parent->key_nibbles.size();
-      auto &branch = dynamic_cast<BranchNode &>(*parent);
+      auto &branch = nodeCast<BranchNode>(*parent);
       auto &child = branch.children.at(prefix[length]);
       if (child != nullptr) {
         OUTCOME_TRY(child_node, node_storage.getChild(branch, prefix[length]));
@@ -271,7 +290,7 @@ namespace {
                                count,
                                callback,
                                node_storage));
-        branch.children[prefix[length]] = child_node;
+        updateChild(branch, prefix[length], child_node);
         OUTCOME_TRY(handleDeletion(logger, parent, node_storage));
       }
     }
@@ -343,6 +362,7 @@ namespace kagome::storage::trie {
     // just update the node key and return it as the new root
     if (parent == nullptr) {
       node->key_nibbles = key_nibbles;
+      node->setDirty();
       return node;
     }
 
@@ -351,7 +371,7 @@ namespace kagome::storage::trie {
     switch (node_type) {
       case T::BranchEmptyValue:
       case T::BranchWithValue: {
-        auto parent_as_branch = std::dynamic_pointer_cast<BranchNode>(parent);
+        auto parent_as_branch = nodeCast<BranchNode>(parent);
         return updateBranch(parent_as_branch, key_nibbles, node);
       }
 
@@ -378,6 +398,7 @@ namespace kagome::storage::trie {
           if (static_cast<std::ptrdiff_t>(parent->key_nibbles.size())
               > key_nibbles.size()) {
             parent->key_nibbles = parent->key_nibbles.subbuffer(length + 1);
+            parent->setDirty();
             br->children.at(parentKey[length]) = parent;
           }
 
@@ -395,6 +416,7 @@ namespace kagome::storage::trie {
           // otherwise, make the leaf a child of the branch and update its
           // partial key
           parent->key_nibbles = parent->key_nibbles.subbuffer(length + 1);
+          parent->setDirty();
           br->children.at(parentKey[length]) = parent;
           br->children.at(key_nibbles[length]) = node;
         }
@@ -424,6 +446,9 @@ namespace kagome::storage::trie {
     auto length = getCommonPrefixLength(key_nibbles, parent->key_nibbles);
 
     if (length == parent->key_nibbles.size()) {
+      // the parent is on the path of the inserted node, so it is modified
+      // anyway
+      parent->setDirty();
       // just set the value in the parent to the node value
       if (key_nibbles == parent->key_nibbles) {
         parent->value = node->value;
@@ -507,8 +532,7 @@ namespace kagome::storage::trie {
         if (nibbles.size() < static_cast<long>(current->key_nibbles.size())) {
           return nullptr;
         }
-        auto parent_as_branch =
-            std::dynamic_pointer_cast<const BranchNode>(current);
+        auto parent_as_branch = nodeCast<const BranchNode>(current);
         auto length = getCommonPrefixLength(current->key_nibbles, nibbles);
         OUTCOME_TRY(n, retrieveChild(*parent_as_branch, nibbles[length]));
         return getNode(n, nibbles.subspan(length + 1));
@@ -566,8 +590,7 @@ namespace kagome::storage::trie {
                     < static_cast<ssize_t>(parent->key_nibbles.size())) {
           return outcome::success();
         }
-        auto parent_as_branch =
-            std::dynamic_pointer_cast<const BranchNode>(parent);
+        auto parent_as_branch = nodeCast<const BranchNode>(parent);
         OUTCOME_TRY(child,
                     retrieveChild(*parent_as_branch, path[common_length]));
         OUTCOME_TRY(callback(*parent_as_branch, path[common_length]));
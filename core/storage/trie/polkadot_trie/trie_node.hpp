@@ -6,7 +6,10 @@
 #ifndef KAGOME_STORAGE_TRIE_POLKADOT_NODE
 #define KAGOME_STORAGE_TRIE_POLKADOT_NODE
 
+#include <memory>
 #include <optional>
+#include <type_traits>
+#include <typeinfo>
 
 #include <fmt/format.h>
 
@@ -88,12 +91,45 @@ namespace kagome::storage::trie {
    * 5.3 The Trie structure in the Polkadot Host specification
    */
 
-  struct OpaqueTrieNode : public Node {};
+  struct OpaqueTrieNode : public Node {
+    /**
+     * The class of a node, which is checked by nodeCast instead of RTTI, as
+     * nodes are cast on every step of a trie traversal.
+     * Unlike TrieNode::Type, doesn't depend on the contents of a node
+     */
+    enum class Kind : uint8_t {
+      Dummy,
+      Leaf,
+      Branch,
+      LeafContainingHashes,
+      BranchContainingHashes,
+    };
+
+    Kind kind() const noexcept {
+      return kind_;
+    }
+
+   protected:
+    explicit OpaqueTrieNode(Kind kind) noexcept : kind_{kind} {}
+
+    Kind kind_;
+    // the flag of TrieNode, which is kept here to share the padding after
+    // the kind, so that neither of them enlarges a trie node
+    bool dirty_ = true;
+  };
 
   struct TrieNode : public OpaqueTrieNode {
-    TrieNode() = default;
-    TrieNode(KeyNibbles key_nibbles, std::optional<common::Buffer> value)
-        : key_nibbles{std::move(key_nibbles)}, value{std::move(value)} {}
+    explicit TrieNode(Kind kind) noexcept : OpaqueTrieNode{kind} {}
+    TrieNode(Kind kind,
+             KeyNibbles key_nibbles,
+             std::optional<common::Buffer> value)
+        : OpaqueTrieNode{kind},
+          key_nibbles{std::move(key_nibbles)},
+          value{std::move(value)} {}
+
+    static constexpr bool hasKind(Kind kind) noexcept {
+      return kind != Kind::Dummy;
+    }
 
     ~TrieNode() override = default;
 
@@ -119,17 +155,67 @@ namespace kagome::storage::trie {
              or type == Type::BranchContainingHashes;
     }
 
+    /**
+     * @returns true if the node was created or modified in memory and its
+     * current state has not been written to the storage yet
+     */
+    bool isDirty() const noexcept {
+      return dirty_;
+    }
+
+    /**
+     * Marks the node as modified. Must be called on any change of the node
+     * (and, consequently, of each of its ancestors), as its merkle value is no
+     * longer valid after that
+     */
+    void setDirty() noexcept {
+      dirty_ = true;
+      merkle_value_.reset();
+    }
+
+    /**
+     * Marks the node as matching its version in the storage
+     * @param merkle_value the merkle value of the stored node
+     */
+    void setClean(common::Buffer merkle_value) noexcept {
+      dirty_ = false;
+      merkle_value_ = std::move(merkle_value);
+    }
+
+    /**
+     * Caches the merkle value of the node, so that it is not recalculated
+     * until the node is modified
+     */
+    void setMerkleValue(common::Buffer merkle_value) noexcept {
+      merkle_value_ = std::move(merkle_value);
+    }
+
+    /**
+     * @returns the merkle value of the node if it is known, which is always
+     * the case for a clean node
+     */
+    const std::optional<common::Buffer> &getMerkleValue() const noexcept {
+      return merkle_value_;
+    }
+
     KeyNibbles key_nibbles;
     std::optional<common::Buffer> value;
+
+   private:
+    std::optional<common::Buffer> merkle_value_;
   };
 
   struct BranchNode : public TrieNode {
     static constexpr uint8_t kMaxChildren = 16;
 
-    BranchNode() = default;
+    BranchNode() noexcept : TrieNode{Kind::Branch} {}
     explicit BranchNode(KeyNibbles key_nibbles,
                         std::optional<common::Buffer> value = std::nullopt)
-        : TrieNode{std::move(key_nibbles), std::move(value)} {}
+        : TrieNode{Kind::Branch, std::move(key_nibbles), std::move(value)} {}
+
+    static constexpr bool hasKind(Kind kind) noexcept {
+      return kind == Kind::Branch;
+    }
 
     ~BranchNode() override = default;
 
@@ -145,9 +231,13 @@ namespace kagome::storage::trie {
   };
 
   struct LeafNode : public TrieNode {
-    LeafNode() = default;
+    LeafNode() noexcept : TrieNode{Kind::Leaf} {}
     LeafNode(KeyNibbles key_nibbles, std::optional<common::Buffer> value)
-        : TrieNode{std::move(key_nibbles), std::move(value)} {}
+        : TrieNode{Kind::Leaf, std::move(key_nibbles), std::move(value)} {}
+
+    static constexpr bool hasKind(Kind kind) noexcept {
+      return kind == Kind::Leaf;
+    }
 
     ~LeafNode() override = default;
 
@@ -157,11 +247,18 @@ namespace kagome::storage::trie {
   struct BranchContainingHashesNode : public TrieNode {
     static constexpr uint8_t kMaxChildren = 16;
 
-    BranchContainingHashesNode() = default;
+    BranchContainingHashesNode() noexcept
+        : TrieNode{Kind::BranchContainingHashes} {}
     explicit BranchContainingHashesNode(
         KeyNibbles key_nibbles,
         std::optional<common::Buffer> value = std::nullopt)
-        : TrieNode{std::move(key_nibbles), std::move(value)} {}
+        : TrieNode{Kind::BranchContainingHashes,
+                   std::move(key_nibbles),
+                   std::move(value)} {}
+
+    static constexpr bool hasKind(Kind kind) noexcept {
+      return kind == Kind::BranchContainingHashes;
+    }
 
     ~BranchContainingHashesNode() override = default;
 
@@ -177,10 +274,17 @@ namespace kagome::storage::trie {
   };
 
   struct LeafContainingHashesNode : public TrieNode {
-    LeafContainingHashesNode() = default;
+    LeafContainingHashesNode() noexcept
+        : TrieNode{Kind::LeafContainingHashes} {}
     LeafContainingHashesNode(KeyNibbles key_nibbles,
                              std::optional<common::Buffer> value)
-        : TrieNode{std::move(key_nibbles), std::move(value)} {}
+        : TrieNode{Kind::LeafContainingHashes,
+                   std::move(key_nibbles),
+                   std::move(value)} {}
+
+    static constexpr bool hasKind(Kind kind) noexcept {
+      return kind == Kind::LeafContainingHashes;
+    }
 
     ~LeafContainingHashesNode() override = default;
 
@@ -197,7 +301,12 @@ namespace kagome::storage::trie {
      * @param key a storage key, which is a hash of an encoded node according to
      * PolkaDot specification
      */
-    explicit DummyNode(common::Buffer key) : db_key{std::move(key)} {}
+    explicit DummyNode(common::Buffer key)
+        : OpaqueTrieNode{Kind::Dummy}, db_key{std::move(key)} {}
+
+    static constexpr bool hasKind(Kind kind) noexcept {
+      return kind == Kind::Dummy;
+    }
 
     int getType() const override {
       // Special only because a node has to have a type. Actually this is not
@@ -209,6 +318,53 @@ namespace kagome::storage::trie {
     common::Buffer db_key;
   };
 
+  /**
+   * Checked downcast of trie nodes, a replacement of dynamic_cast
+   * @returns \arg node as T, or nullptr if it is not a T
+   */
+  template <typename T>
+  T *nodeCast(OpaqueTrieNode *node) noexcept {
+    return node != nullptr and T::hasKind(node->kind()) ? static_cast<T *>(node)
+                                                         : nullptr;
+  }
+
+  template <typename T>
+  const T *nodeCast(const OpaqueTrieNode *node) noexcept {
+    return node != nullptr and T::hasKind(node->kind())
+               ? static_cast<const T *>(node)
+               : nullptr;
+  }
+
+  /**
+   * @returns \arg node as T
+   * @throws std::bad_cast if it is not a T, as dynamic_cast does
+   */
+  template <typename T>
+  T &nodeCast(OpaqueTrieNode &node) {
+    if (not T::hasKind(node.kind())) {
+      throw std::bad_cast{};
+    }
+    return static_cast<T &>(node);
+  }
+
+  template <typename T>
+  const T &nodeCast(const OpaqueTrieNode &node) {
+    if (not T::hasKind(node.kind())) {
+      throw std::bad_cast{};
+    }
+    return static_cast<const T &>(node);
+  }
+
+  /**
+   * @returns \arg node as T, or nullptr if it is not a T
+   */
+  template <typename T, typename N>
+  std::shared_ptr<T> nodeCast(const std::shared_ptr<N> &node) noexcept {
+    return node != nullptr and std::remove_const_t<T>::hasKind(node->kind())
+               ? std::static_pointer_cast<T>(node)
+               : nullptr;
+  }
+
 }  // namespace kagome::storage::trie
 
 template <>
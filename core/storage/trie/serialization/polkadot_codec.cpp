@@ -63,19 +63,21 @@ namespace kagome::storage::trie {
 
   outcome::result<common::Buffer> PolkadotCodec::encodeNode(
       const Node &node) const {
+    // all the nodes are trie nodes, their classes are checked by nodeCast
+    auto &trie_node = static_cast<const OpaqueTrieNode &>(node);
     switch (static_cast<TrieNode::Type>(node.getType())) {
       case TrieNode::Type::Leaf:
-        return encodeLeaf(dynamic_cast<const LeafNode &>(node));
+        return encodeLeaf(nodeCast<LeafNode>(trie_node));
 
       case TrieNode::Type::BranchEmptyValue:
       case TrieNode::Type::BranchWithValue:
-        return encodeBranch(dynamic_cast<const BranchNode &>(node));
+        return encodeBranch(nodeCast<BranchNode>(trie_node));
 
       case TrieNode::Type::LeafContainingHashes:
-        return encodeLeaf(dynamic_cast<const LeafNode &>(node));
+        return encodeLeaf(nodeCast<LeafNode>(trie_node));
 
       case TrieNode::Type::BranchContainingHashes:
-        return encodeBranch(dynamic_cast<const BranchNode &>(node));
+        return encodeBranch(nodeCast<BranchNode>(trie_node));
 
       case TrieNode::Type::Empty:
         return std::errc::invalid_argument;
@@ -179,14 +181,20 @@ namespace kagome::storage::trie {
     // encode each child
     for (auto &child : node.children) {
       if (child) {
-        if (auto dummy = std::dynamic_pointer_cast<DummyNode>(child);
-            dummy != nullptr) {
+        if (auto dummy = nodeCast<DummyNode>(child); dummy != nullptr) {
           auto merkle_value = dummy->db_key;
           OUTCOME_TRY(scale_enc, scale::encode(std::move(merkle_value)));
           encoding.put(scale_enc);
         } else {
-          OUTCOME_TRY(enc, encodeNode(*child));
-          OUTCOME_TRY(scale_enc, scale::encode(merkleValue(enc)));
+          // the merkle value is cached in the child and is only recalculated
+          // after the child (or any of its descendants) is modified
+          auto &trie_child = nodeCast<TrieNode>(*child);
+          if (not trie_child.getMerkleValue().has_value()) {
+            OUTCOME_TRY(enc, encodeNode(trie_child));
+            trie_child.setMerkleValue(merkleValue(enc));
+          }
+          OUTCOME_TRY(scale_enc,
+                      scale::encode(trie_child.getMerkleValue().value()));
           encoding.put(scale_enc);
         }
       }
@@ -210,7 +218,7 @@ namespace kagome::storage::trie {
     return outcome::success(std::move(encoding));
   }
 
-  outcome::result<std::shared_ptr<Node>> PolkadotCodec::decodeNode(
+  outcome::result<std::shared_ptr<TrieNode>> PolkadotCodec::decodeNode(
       gsl::span<const uint8_t> encoded_data) const {
     BufferStream stream{encoded_data};
     // decode the header with the node type and the partial key length
@@ -323,7 +331,7 @@ namespace kagome::storage::trie {
     return partial_key_nibbles;
   }
 
-  outcome::result<std::shared_ptr<Node>> PolkadotCodec::decodeBranch(
+  outcome::result<std::shared_ptr<TrieNode>> PolkadotCodec::decodeBranch(
       TrieNode::Type type,
       const KeyNibbles &partial_key,
       BufferStream &stream) const {
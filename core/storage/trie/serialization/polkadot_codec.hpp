@@ -33,7 +33,7 @@ namespace kagome::storage::trie {
 
     outcome::result<Buffer> encodeNode(const Node &node) const override;
 
-    outcome::result<std::shared_ptr<Node>> decodeNode(
+    outcome::result<std::shared_ptr<TrieNode>> decodeNode(
         gsl::span<const uint8_t> encoded_data) const override;
 
     common::Buffer merkleValue(const BufferView &buf) const override;
@@ -56,7 +56,7 @@ namespace kagome::storage::trie {
     outcome::result<KeyNibbles> decodePartialKey(size_t nibbles_num,
                                              BufferStream &stream) const;
 
-    outcome::result<std::shared_ptr<Node>> decodeBranch(
+    outcome::result<std::shared_ptr<TrieNode>> decodeBranch(
         TrieNode::Type type,
         const KeyNibbles &partial_key,
         BufferStream &stream) const;
@@ -0,0 +1,41 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_STORAGE_TRIE_SERIALIZATION_TRIE_NODE_CACHE
+#define KAGOME_STORAGE_TRIE_SERIALIZATION_TRIE_NODE_CACHE
+
+#include "common/buffer.hpp"
+#include "storage/trie/polkadot_trie/trie_node.hpp"
+
+namespace kagome::storage::trie {
+
+  /**
+   * Cache of decoded trie nodes, keyed by their merkle values (the keys they
+   * are stored with). Shared between all tries retrieved from the storage, so
+   * that the nodes used by consecutive blocks and state queries (notably ones
+   * near the root) are not loaded and decoded over and over.
+   */
+  class TrieNodeCache {
+   public:
+    virtual ~TrieNodeCache() = default;
+
+    /**
+     * @returns a copy of the cached node, which is safe to be modified by the
+     * caller, or nullptr if no node is cached under {@param merkle_value}
+     */
+    virtual std::shared_ptr<TrieNode> get(
+        const common::Buffer &merkle_value) = 0;
+
+    /**
+     * Caches a copy of the clean {@param node} stored under {@param
+     * merkle_value}
+     */
+    virtual void put(const common::Buffer &merkle_value,
+                     const TrieNode &node) = 0;
+  };
+
+}  // namespace kagome::storage::trie
+
+#endif  // KAGOME_STORAGE_TRIE_SERIALIZATION_TRIE_NODE_CACHE
@@ -0,0 +1,126 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "storage/trie/serialization/trie_node_cache_impl.hpp"
+
+namespace {
+  constexpr auto trieNodeCacheHitsMetricName = "kagome_trie_node_cache_hits";
+  constexpr auto trieNodeCacheMissesMetricName =
+      "kagome_trie_node_cache_misses";
+  constexpr auto trieNodeCacheSizeMetricName = "kagome_trie_node_cache_size";
+}  // namespace
+
+namespace kagome::storage::trie {
+
+  namespace {
+    /**
+     * Copies a decoded node. Children of a decoded branch are dummy nodes,
+     * which are never modified, so they are safe to be shared between the
+     * copies
+     * @returns nullptr if the node is not of a type produced by the codec
+     */
+    std::shared_ptr<TrieNode> copyNode(const TrieNode &node) {
+      if (auto branch = nodeCast<BranchNode>(&node); branch != nullptr) {
+        return std::make_shared<BranchNode>(*branch);
+      }
+      if (auto leaf = nodeCast<LeafNode>(&node); leaf != nullptr) {
+        return std::make_shared<LeafNode>(*leaf);
+      }
+      return nullptr;
+    }
+
+    /**
+     * Estimates the amount of memory occupied by a decoded node
+     */
+    size_t estimateSize(const TrieNode &node) {
+      size_t size = sizeof(BranchNode) + node.key_nibbles.size();
+      if (node.value) {
+        size += node.value->size();
+      }
+      if (auto &merkle_value = node.getMerkleValue()) {
+        size += merkle_value->size();
+      }
+      if (auto branch = nodeCast<BranchNode>(&node); branch != nullptr) {
+        for (auto &child : branch->children) {
+          if (auto dummy = nodeCast<DummyNode>(child)) {
+            size += sizeof(DummyNode) + dummy->db_key.size();
+          }
+        }
+      }
+      return size;
+    }
+  }  // namespace
+
+  TrieNodeCacheImpl::TrieNodeCacheImpl(size_t max_size)
+      : max_size_{max_size} {
+    BOOST_ASSERT(max_size_ > 0);
+
+    registry_->registerCounterFamily(trieNodeCacheHitsMetricName,
+                                     "Number of trie nodes found in the cache");
+    metric_hits_ =
+        registry_->registerCounterMetric(trieNodeCacheHitsMetricName);
+    registry_->registerCounterFamily(
+        trieNodeCacheMissesMetricName,
+        "Number of trie nodes not found in the cache and loaded from the DB");
+    metric_misses_ =
+        registry_->registerCounterMetric(trieNodeCacheMissesMetricName);
+    registry_->registerGaugeFamily(
+        trieNodeCacheSizeMetricName,
+        "Estimated memory occupied by the trie node cache, in bytes");
+    metric_size_ = registry_->registerGaugeMetric(trieNodeCacheSizeMetricName);
+  }
+
+  std::shared_ptr<TrieNode> TrieNodeCacheImpl::get(
+      const common::Buffer &merkle_value) {
+    std::shared_ptr<const TrieNode> node;
+    {
+      std::lock_guard lock{mutex_};
+      auto it = index_.find(merkle_value);
+      if (it == index_.end()) {
+        metric_misses_->inc();
+        return nullptr;
+      }
+      entries_.splice(entries_.begin(), entries_, it->second);
+      node = it->second->node;
+    }
+    metric_hits_->inc();
+    // cached nodes are immutable, the caller gets its own copy
+    return copyNode(*node);
+  }
+
+  void TrieNodeCacheImpl::put(const common::Buffer &merkle_value,
+                          const TrieNode &node) {
+    BOOST_ASSERT(not node.isDirty());
+    std::shared_ptr<const TrieNode> copy = copyNode(node);
+    if (copy == nullptr) {
+      return;
+    }
+    auto size = estimateSize(node) + merkle_value.size();
+    if (size > max_size_) {
+      return;
+    }
+
+    std::lock_guard lock{mutex_};
+    if (index_.count(merkle_value) != 0) {
+      return;
+    }
+    while (size_ + size > max_size_) {
+      auto &lru = entries_.back();
+      size_ -= lru.size;
+      index_.erase(lru.merkle_value);
+      entries_.pop_back();
+    }
+    entries_.push_front(Entry{merkle_value, std::move(copy), size});
+    index_.emplace(merkle_value, entries_.begin());
+    size_ += size;
+    metric_size_->set(size_);
+  }
+
+  size_t TrieNodeCacheImpl::size() const {
+    std::lock_guard lock{mutex_};
+    return size_;
+  }
+
+}  // namespace kagome::storage::trie
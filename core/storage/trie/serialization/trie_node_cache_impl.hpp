@@ -0,0 +1,67 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_STORAGE_TRIE_SERIALIZATION_TRIE_NODE_CACHE_IMPL
+#define KAGOME_STORAGE_TRIE_SERIALIZATION_TRIE_NODE_CACHE_IMPL
+
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+#include "metrics/metrics.hpp"
+#include "storage/trie/serialization/trie_node_cache.hpp"
+
+namespace kagome::storage::trie {
+
+  /**
+   * Thread-safe LRU cache of decoded trie nodes bounded by the estimated
+   * memory they occupy
+   */
+  class TrieNodeCacheImpl final : public TrieNodeCache {
+   public:
+    /**
+     * @param max_size memory budget of the cache, in bytes
+     */
+    explicit TrieNodeCacheImpl(size_t max_size);
+
+    std::shared_ptr<TrieNode> get(const common::Buffer &merkle_value) override;
+
+    /**
+     * Evicts the least recently used nodes if the memory budget is exceeded
+     */
+    void put(const common::Buffer &merkle_value, const TrieNode &node) override;
+
+    /**
+     * @returns the estimated amount of memory occupied by the cached nodes, in
+     * bytes
+     */
+    size_t size() const;
+
+   private:
+    struct Entry {
+      common::Buffer merkle_value;
+      std::shared_ptr<const TrieNode> node;
+      size_t size;
+    };
+    using EntryList = std::list<Entry>;
+
+    const size_t max_size_;
+
+    mutable std::mutex mutex_;
+    // the most recently used entries are in the front
+    EntryList entries_;
+    std::unordered_map<common::Buffer, EntryList::iterator> index_;
+    size_t size_ = 0;
+
+    // metrics
+    metrics::RegistryPtr registry_ = metrics::createRegistry();
+    metrics::Counter *metric_hits_;
+    metrics::Counter *metric_misses_;
+    metrics::Gauge *metric_size_;
+  };
+
+}  // namespace kagome::storage::trie
+
+#endif  // KAGOME_STORAGE_TRIE_SERIALIZATION_TRIE_NODE_CACHE_IMPL
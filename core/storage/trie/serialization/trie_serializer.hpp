@@ -30,6 +30,13 @@ namespace kagome::storage::trie {
      */
     virtual outcome::result<RootHash> storeTrie(PolkadotTrie &trie) = 0;
 
+    /**
+     * Calculates the root hash of a trie in memory, without writing its
+     * nodes to the storage
+     */
+    virtual outcome::result<RootHash> calculateRoot(
+        const PolkadotTrie &trie) const = 0;
+
     /**
      * Fetches a trie from the storage. A nullptr is returned in case that there
      * is no entry for provided key.
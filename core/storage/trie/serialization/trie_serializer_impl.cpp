@@ -9,17 +9,39 @@
 #include "storage/trie/codec.hpp"
 #include "storage/trie/polkadot_trie/polkadot_trie_factory.hpp"
 #include "storage/trie/polkadot_trie/trie_node.hpp"
+#include "storage/trie/serialization/trie_node_cache.hpp"
 #include "storage/trie/trie_storage_backend.hpp"
 
 namespace kagome::storage::trie {
 
+  namespace {
+    /**
+     * Obtains the merkle value of a node from its encoding and the key it is
+     * stored with, avoiding rehashing of the encoding. A node is stored either
+     * by the hash of its encoding or by the encoding itself if it is shorter
+     * than a hash (which is its merkle value in both cases), except for the
+     * root node, which is always stored by its hash
+     */
+    common::Buffer getMerkleValue(const common::Buffer &enc,
+                                  const common::Buffer &db_key) {
+      if (enc.size() < RootHash::size()) {
+        return enc;
+      }
+      return db_key;
+    }
+  }  // namespace
+
   TrieSerializerImpl::TrieSerializerImpl(
       std::shared_ptr<PolkadotTrieFactory> factory,
       std::shared_ptr<Codec> codec,
-      std::shared_ptr<TrieStorageBackend> backend)
+      std::shared_ptr<TrieStorageBackend> backend,
+      std::shared_ptr<TrieNodeCache> node_cache,
+      std::shared_ptr<TrieStatePruner> state_pruner)
       : trie_factory_{std::move(factory)},
         codec_{std::move(codec)},
-        backend_{std::move(backend)} {
+        backend_{std::move(backend)},
+        node_cache_{std::move(node_cache)},
+        state_pruner_{std::move(state_pruner)} {
     BOOST_ASSERT(trie_factory_ != nullptr);
     BOOST_ASSERT(codec_ != nullptr);
     BOOST_ASSERT(backend_ != nullptr);
@@ -36,6 +58,24 @@ namespace kagome::storage::trie {
     return storeRootNode(*trie.getRoot());
   }
 
+  outcome::result<RootHash> TrieSerializerImpl::calculateRoot(
+      const PolkadotTrie &trie) const {
+    auto root = trie.getRoot();
+    if (root == nullptr) {
+      return getEmptyRootHash();
+    }
+    // the merkle value of a node, which encoding is not shorter than a hash,
+    // is its hash
+    if (auto &merkle_value = root->getMerkleValue();
+        merkle_value.has_value() and merkle_value->size() == RootHash::size()) {
+      return RootHash::fromSpan(merkle_value.value()).value();
+    }
+    // merkle values of the root descendants are cached by the codec, so only
+    // the modified paths are encoded here
+    OUTCOME_TRY(enc, codec_->encodeNode(*root));
+    return codec_->hash256(enc);
+  }
+
   outcome::result<std::shared_ptr<PolkadotTrie>>
   TrieSerializerImpl::retrieveTrie(const common::Buffer &db_key) const {
     PolkadotTrie::NodeRetrieveFunctor f =
@@ -52,7 +92,20 @@ namespace kagome::storage::trie {
   }
 
   outcome::result<RootHash> TrieSerializerImpl::storeRootNode(TrieNode &node) {
+    // a clean root is already in the storage under its hash, unless its
+    // encoding is shorter than a hash, which means it could have been stored
+    // inlined as a child of another node
+    if (not node.isDirty()
+        and node.getMerkleValue()->size() == RootHash::size()) {
+      return RootHash::fromSpan(node.getMerkleValue().value()).value();
+    }
+
     auto batch = backend_->batch();
+    std::optional<TrieStatePruner::StoredNodes> stored;
+    if (state_pruner_ != nullptr) {
+      stored.emplace();
+    }
+    auto stored_ptr = stored.has_value() ? &stored.value() : nullptr;
     using T = TrieNode::Type;
 
     // if node is a branch node, its children must be stored to the storage
@@ -60,20 +113,32 @@ namespace kagome::storage::trie {
     // of its encoded representation required to save it to the storage
     if (node.getTrieType() == T::BranchEmptyValue
         || node.getTrieType() == T::BranchWithValue) {
-      auto &branch = dynamic_cast<BranchNode &>(node);
-      OUTCOME_TRY(storeChildren(branch, *batch));
+      auto &branch = nodeCast<BranchNode>(node);
+      OUTCOME_TRY(storeChildren(branch, *batch, stored_ptr));
     }
 
     OUTCOME_TRY(enc, codec_->encodeNode(node));
     auto key = codec_->hash256(enc);
     OUTCOME_TRY(batch->put(Buffer{key}, enc));
     OUTCOME_TRY(batch->commit());
+    node.setClean(getMerkleValue(enc, Buffer{key}));
+    if (stored.has_value()) {
+      stored->emplace(Buffer{key}, std::move(enc));
+      OUTCOME_TRY(state_pruner_->addNodes(key, stored.value()));
+    }
 
     return key;
   }
 
   outcome::result<common::Buffer> TrieSerializerImpl::storeNode(
-      TrieNode &node, BufferBatch &batch) {
+      TrieNode &node,
+      BufferBatch &batch,
+      TrieStatePruner::StoredNodes *stored) {
+    // the node and its whole subtree are already in the storage
+    if (not node.isDirty()) {
+      return node.getMerkleValue().value();
+    }
+
     using T = TrieNode::Type;
 
     // if node is a branch node, its children must be stored to the storage
@@ -81,20 +146,25 @@ namespace kagome::storage::trie {
     // of its encoded representation required to save it to the storage
     if (node.getTrieType() == T::BranchEmptyValue
         || node.getTrieType() == T::BranchWithValue) {
-      auto &branch = dynamic_cast<BranchNode &>(node);
-      OUTCOME_TRY(storeChildren(branch, batch));
+      auto &branch = nodeCast<BranchNode>(node);
+      OUTCOME_TRY(storeChildren(branch, batch, stored));
     }
     OUTCOME_TRY(enc, codec_->encodeNode(node));
     auto key = Buffer{codec_->merkleValue(enc)};
     OUTCOME_TRY(batch.put(key, enc));
+    if (stored != nullptr) {
+      stored->emplace(key, std::move(enc));
+    }
     return key;
   }
 
-  outcome::result<void> TrieSerializerImpl::storeChildren(BranchNode &branch,
-                                                          BufferBatch &batch) {
+  outcome::result<void> TrieSerializerImpl::storeChildren(
+      BranchNode &branch,
+      BufferBatch &batch,
+      TrieStatePruner::StoredNodes *stored) {
     for (auto &child : branch.children) {
-      if (auto c = std::dynamic_pointer_cast<TrieNode>(child); c != nullptr) {
-        OUTCOME_TRY(hash, storeNode(*c, batch));
+      if (auto c = nodeCast<TrieNode>(child); c != nullptr) {
+        OUTCOME_TRY(hash, storeNode(*c, batch, stored));
         // when a node is written to the storage, it is replaced with a dummy
         // node to avoid memory waste
         child = std::make_shared<DummyNode>(hash);
@@ -105,11 +175,11 @@ namespace kagome::storage::trie {
 
   outcome::result<PolkadotTrie::NodePtr> TrieSerializerImpl::retrieveNode(
       const std::shared_ptr<OpaqueTrieNode> &parent) const {
-    if (auto p = std::dynamic_pointer_cast<DummyNode>(parent); p != nullptr) {
+    if (auto p = nodeCast<DummyNode>(parent); p != nullptr) {
       OUTCOME_TRY(n, retrieveNode(p->db_key));
       return n;
     }
-    return std::dynamic_pointer_cast<TrieNode>(parent);
+    return nodeCast<TrieNode>(parent);
   }
 
   outcome::result<PolkadotTrie::NodePtr> TrieSerializerImpl::retrieveNode(
@@ -117,9 +187,18 @@ namespace kagome::storage::trie {
     if (db_key.empty() or db_key == getEmptyRootHash()) {
       return nullptr;
     }
+    if (node_cache_ != nullptr) {
+      if (auto node = node_cache_->get(db_key); node != nullptr) {
+        return node;
+      }
+    }
     OUTCOME_TRY(enc, backend_->load(db_key));
-    OUTCOME_TRY(n, codec_->decodeNode(enc));
-    return std::dynamic_pointer_cast<TrieNode>(n);
+    OUTCOME_TRY(node, codec_->decodeNode(enc));
+    node->setClean(getMerkleValue(enc, db_key));
+    if (node_cache_ != nullptr) {
+      node_cache_->put(db_key, *node);
+    }
+    return node;
   }
 
 }  // namespace kagome::storage::trie
@@ -9,11 +9,13 @@
 #include "storage/trie/serialization/trie_serializer.hpp"
 
 #include "storage/buffer_map_types.hpp"
+#include "storage/trie/trie_state_pruner.hpp"
 
 namespace kagome::storage::trie {
   class Codec;
   class PolkadotTrieFactory;
   class TrieStorageBackend;
+  class TrieNodeCache;
   struct BranchNode;
   struct TrieNode;
 }  // namespace kagome::storage::trie
@@ -22,15 +24,26 @@ namespace kagome::storage::trie {
 
   class TrieSerializerImpl : public TrieSerializer {
    public:
+    /**
+     * @param node_cache cache of decoded nodes shared between the retrieved
+     * tries, nodes are always loaded from the backend if it is nullptr
+     * @param state_pruner is notified of the nodes of each stored state, the
+     * states are never pruned if it is nullptr
+     */
     TrieSerializerImpl(std::shared_ptr<PolkadotTrieFactory> factory,
                        std::shared_ptr<Codec> codec,
-                       std::shared_ptr<TrieStorageBackend> backend);
+                       std::shared_ptr<TrieStorageBackend> backend,
+                       std::shared_ptr<TrieNodeCache> node_cache = nullptr,
+                       std::shared_ptr<TrieStatePruner> state_pruner = nullptr);
     ~TrieSerializerImpl() override = default;
 
     RootHash getEmptyRootHash() const override;
 
     outcome::result<RootHash> storeTrie(PolkadotTrie &trie) override;
 
+    outcome::result<RootHash> calculateRoot(
+        const PolkadotTrie &trie) const override;
+
     outcome::result<std::shared_ptr<PolkadotTrie>> retrieveTrie(
         const common::Buffer &db_key) const override;
 
@@ -38,12 +51,17 @@ namespace kagome::storage::trie {
     /**
      * Writes a node to a persistent storage, recursively storing its
      * descendants as well. Then replaces the node children to dummy nodes to
-     * avoid memory waste
+     * avoid memory waste. The written nodes are collected to {@param stored}
+     * unless it is nullptr
      */
     outcome::result<RootHash> storeRootNode(TrieNode &node);
-    outcome::result<common::Buffer> storeNode(TrieNode &node,
-                                              BufferBatch &batch);
-    outcome::result<void> storeChildren(BranchNode &branch, BufferBatch &batch);
+    outcome::result<common::Buffer> storeNode(
+        TrieNode &node,
+        BufferBatch &batch,
+        TrieStatePruner::StoredNodes *stored);
+    outcome::result<void> storeChildren(BranchNode &branch,
+                                        BufferBatch &batch,
+                                        TrieStatePruner::StoredNodes *stored);
     /**
      * Fetches a node from the storage. A nullptr is returned in case that there
      * is no entry for provided key. Mind that a branch node will have dummy
@@ -61,6 +79,8 @@ namespace kagome::storage::trie {
     std::shared_ptr<PolkadotTrieFactory> trie_factory_;
     std::shared_ptr<Codec> codec_;
     std::shared_ptr<TrieStorageBackend> backend_;
+    std::shared_ptr<TrieNodeCache> node_cache_;
+    std::shared_ptr<TrieStatePruner> state_pruner_;
   };
 }  // namespace kagome::storage::trie
 
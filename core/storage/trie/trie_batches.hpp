@@ -51,6 +51,12 @@ namespace kagome::storage::trie {
      */
     virtual outcome::result<RootHash> commit() = 0;
 
+    /**
+     * Calculates the root of the state represented by the batch, without
+     * writing anything to the persistent storage
+     */
+    virtual outcome::result<RootHash> hash() = 0;
+
     /**
      * Creates a batch on top of this batch
      */
@@ -0,0 +1,61 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_STORAGE_TRIE_TRIE_DIFF
+#define KAGOME_STORAGE_TRIE_TRIE_DIFF
+
+#include <functional>
+#include <optional>
+
+#include <gsl/span>
+
+#include "common/buffer.hpp"
+#include "outcome/outcome.hpp"
+#include "storage/trie/types.hpp"
+
+namespace kagome::storage::trie {
+
+  /**
+   * Computes the difference between two states by walking their tries
+   * simultaneously. Subtrees with equal merkle values are shared by the states
+   * and are skipped without being loaded from the storage, so the cost is
+   * proportional to the number of changed nodes rather than to the number of
+   * the queried keys.
+   */
+  class TrieDiff {
+   public:
+    /**
+     * Called for each key which value differs in the states, with its value
+     * in the new state or std::nullopt if the key is removed from it.
+     * An error returned by the callback stops the walk and is returned from
+     * the diff
+     */
+    using OnChange = std::function<outcome::result<void>(
+        const common::Buffer &key,
+        const std::optional<common::BufferView> &value)>;
+
+    virtual ~TrieDiff() = default;
+
+    /**
+     * Reports all the keys changed between the states with {@param from} and
+     * {@param to} roots to {@param on_change} in the lexicographical order
+     */
+    virtual outcome::result<void> diff(const RootHash &from,
+                                       const RootHash &to,
+                                       const OnChange &on_change) const = 0;
+
+    /**
+     * Reports only the changes of {@param keys}, the subtrees which contain
+     * none of them are not visited
+     */
+    virtual outcome::result<void> diff(const RootHash &from,
+                                       const RootHash &to,
+                                       gsl::span<const common::Buffer> keys,
+                                       const OnChange &on_change) const = 0;
+  };
+
+}  // namespace kagome::storage::trie
+
+#endif  // KAGOME_STORAGE_TRIE_TRIE_DIFF
@@ -0,0 +1,75 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_STORAGE_TRIE_TRIE_STATE_PRUNER
+#define KAGOME_STORAGE_TRIE_TRIE_STATE_PRUNER
+
+#include <unordered_map>
+
+#include "common/buffer.hpp"
+#include "outcome/outcome.hpp"
+#include "storage/trie/types.hpp"
+
+namespace kagome::storage::trie {
+
+  /**
+   * Keeps reference counters of the trie nodes in the storage and removes the
+   * nodes which are no longer referenced by any of the kept states.
+   * A node is referenced by each of the stored nodes which have it as a child
+   * and by each block or pin of the state it is the root of. The root of a
+   * child trie is referenced by each of the stored nodes which have it as the
+   * value of a key under the child storage prefix. Nodes stored before the
+   * pruning was enabled have no counters and are never removed.
+   */
+  class TrieStatePruner {
+   public:
+    /// Encodings of the nodes written to the storage, by their storage keys
+    using StoredNodes = std::unordered_map<common::Buffer, common::Buffer>;
+
+    virtual ~TrieStatePruner() = default;
+
+    /**
+     * @return number of the latest finalized blocks, which states are kept
+     */
+    virtual uint32_t pruningDepth() const = 0;
+
+    /**
+     * Registers the nodes of the state with {@param root}, which were missing
+     * in the storage and are written as {@param new_nodes}. The state itself
+     * is not referenced until a block is added with it, so storing the same
+     * state several times does not keep it from being pruned
+     */
+    virtual outcome::result<void> addNodes(const RootHash &root,
+                                           const StoredNodes &new_nodes) = 0;
+
+    /**
+     * Registers a reference of a block to its stored state with {@param root},
+     * must be called once per block
+     */
+    virtual outcome::result<void> addState(const RootHash &root) = 0;
+
+    /**
+     * Makes the state with {@param root} never be pruned, e.g. because the
+     * runtime code is loaded from it. Pinning a state again has no effect
+     */
+    virtual outcome::result<void> pinState(const RootHash &root) = 0;
+
+    /**
+     * Drops the pin of the state with {@param root}, e.g. because its block
+     * is discarded, pruning the state unless it is referenced otherwise.
+     * Unpinning a state which is not pinned has no effect
+     */
+    virtual outcome::result<void> unpinState(const RootHash &root) = 0;
+
+    /**
+     * Drops a reference of a block to the state with {@param root}, removing
+     * the nodes which are not referenced anymore from the storage
+     */
+    virtual outcome::result<void> pruneState(const RootHash &root) = 0;
+  };
+
+}  // namespace kagome::storage::trie
+
+#endif  // KAGOME_STORAGE_TRIE_TRIE_STATE_PRUNER
@@ -10,6 +10,7 @@
 #include <memory>
 #include <shared_mutex>
 #include <unordered_map>
+#include <vector>
 
 namespace kagome::subscription {
 
@@ -98,6 +99,16 @@ namespace kagome::subscription {
       return count;
     }
 
+    /// @return keys of the events which have subscribers
+    std::vector<EventKeyType> keys() const {
+      std::shared_lock lock(subscribers_map_cs_);
+      std::vector<EventKeyType> keys;
+      keys.reserve(subscribers_map_.size());
+      for (auto &it : subscribers_map_) keys.push_back(it.first);
+
+      return keys;
+    }
+
     void notify(const EventKeyType &key, const EventParams &... args) {
       std::shared_lock lock(subscribers_map_cs_);
       auto it = subscribers_map_.find(key);
@@ -5,6 +5,8 @@
 
 #include "transaction_pool/impl/transaction_pool_impl.hpp"
 
+#include <tuple>
+
 #include "crypto/hasher.hpp"
 #include "network/transactions_transmitter.hpp"
 #include "primitives/block_id.hpp"
@@ -62,12 +64,11 @@ namespace kagome::transaction_pool {
 
   outcome::result<primitives::Transaction>
   TransactionPoolImpl::constructTransaction(
-      primitives::TransactionSource source,
-      primitives::Extrinsic extrinsic) const {
-    OUTCOME_TRY(res, ttq_->validate_transaction(source, extrinsic));
-
+      primitives::Extrinsic extrinsic,
+      const Transaction::Hash &hash,
+      const primitives::TransactionValidity &validity) const {
     return visit_in_place(
-        res,
+        validity,
         [&](const primitives::TransactionValidityError &e) {
           return visit_in_place(
               e,
@@ -79,10 +80,9 @@ namespace kagome::transaction_pool {
         },
         [&](const primitives::ValidTransaction &v)
             -> outcome::result<primitives::Transaction> {
-          common::Hash256 hash = hasher_->blake2b_256(extrinsic.data);
           size_t length = extrinsic.data.size();
 
-          return primitives::Transaction{extrinsic,
+          return primitives::Transaction{std::move(extrinsic),
                                          length,
                                          hash,
                                          v.priority,
@@ -95,19 +95,88 @@ namespace kagome::transaction_pool {
 
   outcome::result<Transaction::Hash> TransactionPoolImpl::submitExtrinsic(
       primitives::TransactionSource source, primitives::Extrinsic extrinsic) {
-    OUTCOME_TRY(tx, constructTransaction(source, extrinsic));
+    std::vector<primitives::Extrinsic> extrinsics;
+    extrinsics.emplace_back(std::move(extrinsic));
+    auto results = submitExtrinsics(source, std::move(extrinsics));
+    return std::move(results.front());
+  }
 
-    if (tx.should_propagate) {
-      tx_transmitter_->propagateTransactions(gsl::make_span(std::vector{tx}));
+  std::vector<outcome::result<Transaction::Hash>>
+  TransactionPoolImpl::submitExtrinsics(
+      primitives::TransactionSource source,
+      std::vector<primitives::Extrinsic> extrinsics) {
+    std::vector<outcome::result<Transaction::Hash>> results(
+        extrinsics.size(), TransactionPoolError::TX_ALREADY_IMPORTED);
+
+    // duplicates are rejected before they reach the runtime
+    std::vector<size_t> to_validate;
+    std::vector<Transaction::Hash> hashes;
+    std::vector<primitives::Extrinsic> validated;
+    {
+      std::lock_guard lock{mutex_};
+      for (size_t i = 0; i < extrinsics.size(); ++i) {
+        auto hash = hasher_->blake2b_256(extrinsics[i].data);
+        if (imported_txs_.count(hash) != 0
+            or validating_txs_.count(hash) != 0) {
+          continue;
+        }
+        if (validating_txs_.size() >= limits_.max_validating_num) {
+          results[i] = TransactionPoolError::TOO_MANY_VALIDATIONS;
+          continue;
+        }
+        validating_txs_.emplace(hash);
+        to_validate.push_back(i);
+        hashes.push_back(hash);
+        validated.emplace_back(std::move(extrinsics[i]));
+      }
+    }
+    if (to_validate.empty()) {
+      return results;
     }
-    auto hash = tx.hash;
-    // send to pool
-    OUTCOME_TRY(submitOne(std::move(tx)));
 
-    return hash;
+    auto validity_res = ttq_->validate_transactions(source, validated);
+
+    std::vector<Transaction> propagated;
+    {
+      std::lock_guard lock{mutex_};
+      for (size_t j = 0; j < to_validate.size(); ++j) {
+        validating_txs_.erase(hashes[j]);
+        auto &result = results[to_validate[j]];
+        if (validity_res.has_error()) {
+          result = validity_res.as_failure();
+          continue;
+        }
+        auto &validity = validity_res.value()[j];
+        if (validity.has_error()) {
+          result = validity.as_failure();
+          continue;
+        }
+        auto tx_res = constructTransaction(
+            std::move(validated[j]), hashes[j], validity.value());
+        if (tx_res.has_error()) {
+          result = tx_res.as_failure();
+          continue;
+        }
+        auto tx = std::make_shared<Transaction>(std::move(tx_res.value()));
+        if (auto res = submitOne(tx); res.has_error()) {
+          result = res.as_failure();
+          continue;
+        }
+        if (tx->should_propagate) {
+          propagated.push_back(*tx);
+        }
+        result = hashes[j];
+      }
+    }
+
+    if (not propagated.empty()) {
+      tx_transmitter_->propagateTransactions(propagated);
+    }
+    return results;
   }
 
   outcome::result<void> TransactionPoolImpl::submitOne(Transaction &&tx) {
+    std::lock_guard lock{mutex_};
     return submitOne(std::make_shared<Transaction>(std::move(tx)));
   }
 
@@ -116,6 +185,7 @@ namespace kagome::transaction_pool {
     if (auto [_, ok] = imported_txs_.emplace(tx->hash, tx); !ok) {
       return TransactionPoolError::TX_ALREADY_IMPORTED;
     }
+    auto expiring_it = expiring_txs_.emplace(tx->valid_till, tx->hash);
 
     auto processResult = processTransaction(tx);
     if (processResult.has_error()
@@ -125,6 +195,7 @@ namespace kagome::transaction_pool {
                             ExtrinsicLifecycleEvent::Dropped(key.value()));
       }
       imported_txs_.erase(tx->hash);
+      expiring_txs_.erase(expiring_it);
     } else {
       SL_DEBUG(logger_,
                "Extrinsic {} with hash {} was added to the pool",
@@ -200,6 +271,12 @@ namespace kagome::transaction_pool {
 
   outcome::result<Transaction> TransactionPoolImpl::removeOne(
       const Transaction::Hash &tx_hash) {
+    std::lock_guard lock{mutex_};
+    return removeTransaction(tx_hash);
+  }
+
+  outcome::result<Transaction> TransactionPoolImpl::removeTransaction(
+      const Transaction::Hash &tx_hash) {
     auto tx_node = imported_txs_.extract(tx_hash);
     if (tx_node.empty()) {
       SL_TRACE(logger_,
@@ -208,6 +285,13 @@ namespace kagome::transaction_pool {
       return TransactionPoolError::TX_NOT_FOUND;
     }
     auto &tx = tx_node.mapped();
+    auto range = expiring_txs_.equal_range(tx->valid_till);
+    for (auto it = range.first; it != range.second; ++it) {
+      if (it->second == tx_hash) {
+        expiring_txs_.erase(it);
+        break;
+      }
+    }
 
     unsetReady(tx);
     delTransactionAsWaiting(tx);
@@ -243,7 +327,7 @@ namespace kagome::transaction_pool {
       const std::shared_ptr<Transaction> &tx) {
     for (auto &tag : tx->requires) {
       auto range = tx_waits_tag_.equal_range(tag);
-      for (auto i = range.first; i != range.second;) {
+      for (auto i = range.first; i != range.second; ++i) {
         if (i->second.lock() == tx) {
           tx_waits_tag_.erase(i);
           break;
@@ -254,17 +338,31 @@ namespace kagome::transaction_pool {
 
   std::map<Transaction::Hash, std::shared_ptr<Transaction>>
   TransactionPoolImpl::getReadyTransactions() const {
+    std::lock_guard lock{mutex_};
     std::map<Transaction::Hash, std::shared_ptr<Transaction>> ready;
     std::for_each(ready_txs_.begin(), ready_txs_.end(), [&ready](auto it) {
-      if (auto tx = it.second.lock()) {
+      if (auto tx = it.second->second.lock()) {
         ready.emplace(it.first, std::move(tx));
       }
     });
     return ready;
   }
 
-  const std::unordered_map<Transaction::Hash, std::shared_ptr<Transaction>>
-      &TransactionPoolImpl::getPendingTransactions() const {
+  ReadyTransactions TransactionPoolImpl::getReadyQueue() const {
+    std::lock_guard lock{mutex_};
+    std::vector<std::shared_ptr<const Transaction>> ready;
+    ready.reserve(ready_queue_.size());
+    for (auto &[_, weak_tx] : ready_queue_) {
+      if (auto tx = weak_tx.lock()) {
+        ready.emplace_back(std::move(tx));
+      }
+    }
+    return ReadyTransactions{std::move(ready)};
+  }
+
+  std::unordered_map<Transaction::Hash, std::shared_ptr<Transaction>>
+  TransactionPoolImpl::getPendingTransactions() const {
+    std::lock_guard lock{mutex_};
     return imported_txs_;
   }
 
@@ -272,16 +370,20 @@ namespace kagome::transaction_pool {
       const primitives::BlockId &at) {
     OUTCOME_TRY(number, header_repo_->getNumberById(at));
 
+    std::lock_guard lock{mutex_};
     std::vector<Transaction::Hash> remove_to;
 
-    for (auto &[txHash, tx] : imported_txs_) {
-      if (moderator_->banIfStale(number, *tx)) {
-        remove_to.emplace_back(txHash);
+    // only the transactions which validity has ended may be stale
+    for (auto it = expiring_txs_.begin();
+         it != expiring_txs_.end() and it->first <= number;
+         ++it) {
+      if (moderator_->banIfStale(number, *imported_txs_.at(it->second))) {
+        remove_to.emplace_back(it->second);
       }
     }
 
     for (auto &tx_hash : remove_to) {
-      OUTCOME_TRY(tx, removeOne(tx_hash));
+      OUTCOME_TRY(tx, removeTransaction(tx_hash));
       if (auto key = ext_key_repo_->get(tx.hash); key.has_value()) {
         sub_engine_->notify(key.value(),
                             ExtrinsicLifecycleEvent::Dropped(key.value()));
@@ -297,7 +399,7 @@ namespace kagome::transaction_pool {
   bool TransactionPoolImpl::isInReady(
       const std::shared_ptr<const Transaction> &tx) const {
     auto i = ready_txs_.find(tx->hash);
-    return i != ready_txs_.end() && !i->second.expired();
+    return i != ready_txs_.end() && !i->second->second.expired();
   }
 
   bool TransactionPoolImpl::checkForReady(
@@ -310,7 +412,10 @@ namespace kagome::transaction_pool {
   }
 
   void TransactionPoolImpl::setReady(const std::shared_ptr<Transaction> &tx) {
-    if (auto [_, ok] = ready_txs_.emplace(tx->hash, tx); ok) {
+    if (ready_txs_.count(tx->hash) == 0) {
+      auto it = ready_queue_.emplace(
+          ReadyKey{tx->priority, tx->valid_till, next_ready_id_++}, tx);
+      ready_txs_.emplace(tx->hash, it.first);
       if (auto key = ext_key_repo_->get(tx->hash); key.has_value()) {
         sub_engine_->notify(key.value(),
                             ExtrinsicLifecycleEvent::Ready(key.value()));
@@ -361,6 +466,7 @@ namespace kagome::transaction_pool {
 
   void TransactionPoolImpl::unsetReady(const std::shared_ptr<Transaction> &tx) {
     if (auto tx_node = ready_txs_.extract(tx->hash); !tx_node.empty()) {
+      ready_queue_.erase(tx_node.mapped());
       metric_ready_txs_->set(ready_txs_.size());
       rollbackRequiredTags(tx);
       rollbackProvidedTags(tx);
@@ -406,7 +512,14 @@ namespace kagome::transaction_pool {
     }
   }
 
+  bool TransactionPoolImpl::ReadyKey::operator<(const ReadyKey &other) const {
+    // the higher priority goes first
+    return std::tie(other.priority, valid_till, id)
+           < std::tie(priority, other.valid_till, other.id);
+  }
+
   TransactionPoolImpl::Status TransactionPoolImpl::getStatus() const {
+    std::lock_guard lock{mutex_};
     return Status{ready_txs_.size(), imported_txs_.size() - ready_txs_.size()};
   }
 
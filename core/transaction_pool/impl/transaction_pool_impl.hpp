@@ -16,6 +16,9 @@
 #include "transaction_pool/pool_moderator.hpp"
 #include "transaction_pool/transaction_pool.hpp"
 
+#include <mutex>
+#include <unordered_set>
+
 namespace kagome::runtime {
   class TaggedTransactionQueue;
 }
@@ -49,13 +52,17 @@ namespace kagome::transaction_pool {
     TransactionPoolImpl &operator=(TransactionPoolImpl &&) = delete;
     TransactionPoolImpl &operator=(const TransactionPoolImpl &) = delete;
 
-    const std::unordered_map<Transaction::Hash, std::shared_ptr<Transaction>>
-        &getPendingTransactions() const override;
+    std::unordered_map<Transaction::Hash, std::shared_ptr<Transaction>>
+    getPendingTransactions() const override;
 
     outcome::result<Transaction::Hash> submitExtrinsic(
         primitives::TransactionSource source,
         primitives::Extrinsic extrinsic) override;
 
+    std::vector<outcome::result<Transaction::Hash>> submitExtrinsics(
+        primitives::TransactionSource source,
+        std::vector<primitives::Extrinsic> extrinsics) override;
+
     outcome::result<void> submitOne(Transaction &&tx) override;
 
     outcome::result<Transaction> removeOne(
@@ -64,18 +71,35 @@ namespace kagome::transaction_pool {
     std::map<Transaction::Hash, std::shared_ptr<Transaction>>
     getReadyTransactions() const override;
 
+    ReadyTransactions getReadyQueue() const override;
+
     outcome::result<std::vector<Transaction>> removeStale(
         const primitives::BlockId &at) override;
 
     Status getStatus() const override;
 
    private:
+    /// Order of the ready transactions, the best of them goes first
+    struct ReadyKey {
+      Transaction::Priority priority;
+      Transaction::Longevity valid_till;
+      // transactions which became ready earlier go first
+      uint64_t id;
+
+      bool operator<(const ReadyKey &other) const;
+    };
+    using ReadyQueue = std::map<ReadyKey, std::weak_ptr<Transaction>>;
+
     outcome::result<primitives::Transaction> constructTransaction(
-        primitives::TransactionSource source,
-        primitives::Extrinsic extrinsic) const;
+        primitives::Extrinsic extrinsic,
+        const Transaction::Hash &hash,
+        const primitives::TransactionValidity &validity) const;
 
     outcome::result<void> submitOne(const std::shared_ptr<Transaction> &tx);
 
+    outcome::result<Transaction> removeTransaction(
+        const Transaction::Hash &tx_hash);
+
     outcome::result<void> processTransaction(
         const std::shared_ptr<Transaction> &tx);
 
@@ -134,13 +158,26 @@ namespace kagome::transaction_pool {
     /// bans stale and invalid transactions for some amount of time
     std::unique_ptr<PoolModerator> moderator_;
 
+    /// Guards the state of the pool, which is accessed by the network, RPC
+    /// and block production; it is not held while transactions are validated
+    mutable std::mutex mutex_;
+
+    /// Transactions being validated before they are imported
+    std::unordered_set<Transaction::Hash> validating_txs_;
+
     /// All of imported transaction, contained in the pool
     std::unordered_map<Transaction::Hash, std::shared_ptr<Transaction>>
         imported_txs_;
 
+    /// Imported transactions by the block numbers their validity ends at
+    std::multimap<Transaction::Longevity, Transaction::Hash> expiring_txs_;
+
     /// Collection transaction with full-satisfied dependencies
-    std::unordered_map<Transaction::Hash, std::weak_ptr<Transaction>>
-        ready_txs_;
+    ReadyQueue ready_queue_;
+    uint64_t next_ready_id_ = 0;
+
+    /// Positions of the ready transactions in the queue
+    std::unordered_map<Transaction::Hash, ReadyQueue::iterator> ready_txs_;
 
     /// List of ready transaction over limit. It will be process first of all
     std::list<std::weak_ptr<Transaction>> postponed_txs_;
@@ -0,0 +1,79 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "transaction_pool/ready_transactions.hpp"
+
+#include <tuple>
+
+namespace kagome::transaction_pool {
+
+  bool ReadyTransactions::Order::operator<(const Order &other) const {
+    // the higher priority goes first
+    return std::tie(other.priority, valid_till, index)
+           < std::tie(priority, other.valid_till, other.index);
+  }
+
+  ReadyTransactions::ReadyTransactions(
+      std::vector<std::shared_ptr<const Transaction>> txs) {
+    std::set<Transaction::Tag> providable;
+    for (auto &tx : txs) {
+      providable.insert(tx->provides.begin(), tx->provides.end());
+    }
+
+    entries_.reserve(txs.size());
+    for (size_t index = 0; index < txs.size(); ++index) {
+      auto &entry = entries_.emplace_back(Entry{std::move(txs[index])});
+      std::set<Transaction::Tag> required(entry.tx->requires.begin(),
+                                          entry.tx->requires.end());
+      for (auto &tag : required) {
+        if (providable.count(tag) != 0) {
+          dependents_[tag].push_back(index);
+          ++entry.unresolved;
+        }
+      }
+      if (entry.unresolved == 0) {
+        unlock(index);
+      }
+    }
+  }
+
+  std::shared_ptr<const Transaction> ReadyTransactions::next() {
+    if (unlocked_.empty()) {
+      return nullptr;
+    }
+    auto index = unlocked_.begin()->index;
+    unlocked_.erase(unlocked_.begin());
+    ++yielded_;
+    return entries_[index].tx;
+  }
+
+  void ReadyTransactions::markIncluded(const Transaction &tx) {
+    for (auto &tag : tx.provides) {
+      if (not provided_.emplace(tag).second) {
+        continue;
+      }
+      auto it = dependents_.find(tag);
+      if (it == dependents_.end()) {
+        continue;
+      }
+      for (auto index : it->second) {
+        if (--entries_[index].unresolved == 0) {
+          unlock(index);
+        }
+      }
+      dependents_.erase(it);
+    }
+  }
+
+  size_t ReadyTransactions::size() const {
+    return entries_.size() - yielded_;
+  }
+
+  void ReadyTransactions::unlock(size_t index) {
+    auto &tx = *entries_[index].tx;
+    unlocked_.emplace(Order{tx.priority, tx.valid_till, index});
+  }
+
+}  // namespace kagome::transaction_pool
@@ -0,0 +1,81 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_TRANSACTION_POOL_READY_TRANSACTIONS_HPP
+#define KAGOME_TRANSACTION_POOL_READY_TRANSACTIONS_HPP
+
+#include <map>
+#include <memory>
+#include <set>
+#include <vector>
+
+#include "primitives/transaction.hpp"
+
+namespace kagome::transaction_pool {
+
+  using primitives::Transaction;
+
+  /**
+   * Yields ready transactions in the order of their inclusion to a block: the
+   * best by priority (then by the earliest end of validity) of those, which
+   * requirements are provided by the already included transactions.
+   * Transactions which depend on a transaction are unlocked only after it is
+   * reported as included, so block authoring may stop at any moment or skip a
+   * transaction without yielding its invalid dependents
+   */
+  class ReadyTransactions {
+   public:
+    /**
+     * @param txs ready transactions, the earlier of the equally good ones is
+     * yielded first; requirements, which none of them provides, are considered
+     * satisfied
+     */
+    explicit ReadyTransactions(
+        std::vector<std::shared_ptr<const Transaction>> txs = {});
+
+    /**
+     * @returns the best of the unlocked transactions, which were not yielded
+     * yet, or nullptr if there are none
+     */
+    std::shared_ptr<const Transaction> next();
+
+    /**
+     * Provides the tags of {@param tx} yielded by next(), unlocking the
+     * transactions which require them
+     */
+    void markIncluded(const Transaction &tx);
+
+    /**
+     * @returns number of the transactions, which were not yielded yet
+     */
+    size_t size() const;
+
+   private:
+    struct Entry {
+      std::shared_ptr<const Transaction> tx;
+      // number of the required tags, which are not provided yet
+      size_t unresolved = 0;
+    };
+
+    struct Order {
+      Transaction::Priority priority;
+      Transaction::Longevity valid_till;
+      size_t index;
+
+      bool operator<(const Order &other) const;
+    };
+
+    void unlock(size_t index);
+
+    std::vector<Entry> entries_;
+    std::set<Order> unlocked_;
+    std::map<Transaction::Tag, std::vector<size_t>> dependents_;
+    std::set<Transaction::Tag> provided_;
+    size_t yielded_ = 0;
+  };
+
+}  // namespace kagome::transaction_pool
+
+#endif  // KAGOME_TRANSACTION_POOL_READY_TRANSACTIONS_HPP
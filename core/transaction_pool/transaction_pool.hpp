@@ -11,6 +11,7 @@
 #include "primitives/block_id.hpp"
 #include "primitives/transaction.hpp"
 #include "primitives/transaction_validity.hpp"
+#include "transaction_pool/ready_transactions.hpp"
 
 namespace kagome::transaction_pool {
 
@@ -24,11 +25,10 @@ namespace kagome::transaction_pool {
     virtual ~TransactionPool() = default;
 
     /**
-     * @return pending transactions
+     * @return snapshot of the pending transactions
      */
-    virtual const std::unordered_map<Transaction::Hash,
-                                     std::shared_ptr<Transaction>>
-        &getPendingTransactions() const = 0;
+    virtual std::unordered_map<Transaction::Hash, std::shared_ptr<Transaction>>
+    getPendingTransactions() const = 0;
 
     /**
      * Builds and validates transaction for provided extrinsic, and submit
@@ -43,6 +43,17 @@ namespace kagome::transaction_pool {
         primitives::TransactionSource source,
         primitives::Extrinsic extrinsic) = 0;
 
+    /**
+     * Same as submitExtrinsic for a batch of extrinsics. Extrinsics, which
+     * are already in the pool or being validated, are rejected before the
+     * validation, the rest of them are validated together on the same state
+     * @return hash of each successfully submitted transaction or error in the
+     * order of \param extrinsics
+     */
+    virtual std::vector<outcome::result<Transaction::Hash>> submitExtrinsics(
+        primitives::TransactionSource source,
+        std::vector<primitives::Extrinsic> extrinsics) = 0;
+
     /**
      * Import one verified transaction to the pool. If it has unresolved
      * dependencies (requires tags of transactions that are not in the pool
@@ -67,6 +78,12 @@ namespace kagome::transaction_pool {
     virtual std::map<Transaction::Hash, std::shared_ptr<Transaction>>
     getReadyTransactions() const = 0;
 
+    /**
+     * @return transactions ready to be included in the next block, in the
+     * order of their inclusion
+     */
+    virtual ReadyTransactions getReadyQueue() const = 0;
+
     /**
      * Remove from the pool and temporarily ban transactions which longevity is
      * expired
@@ -89,9 +106,12 @@ namespace kagome::transaction_pool {
   struct TransactionPool::Limits {
     static constexpr size_t kDefaultMaxReadyNum = 128;
     static constexpr size_t kDefaultCapacity = 512;
+    static constexpr size_t kDefaultMaxValidatingNum = 256;
 
     size_t max_ready_num = kDefaultMaxReadyNum;
     size_t capacity = kDefaultCapacity;
+    /// submissions are rejected while this many transactions are validated
+    size_t max_validating_num = kDefaultMaxValidatingNum;
   };
 
 }  // namespace kagome::transaction_pool
@@ -14,6 +14,8 @@ OUTCOME_CPP_DEFINE_CATEGORY(kagome::transaction_pool, TransactionPoolError, e) {
       return "Transaction not found in the pool";
     case E::POOL_IS_FULL:
       return "Transaction pool is full";
+    case E::TOO_MANY_VALIDATIONS:
+      return "Too many transactions are being validated, try again later";
   }
   return "Unknown transaction pool error";
 }
@@ -13,6 +13,7 @@ namespace kagome::transaction_pool {
     TX_ALREADY_IMPORTED = 1,
     TX_NOT_FOUND,
     POOL_IS_FULL,
+    TOO_MANY_VALIDATIONS,
   };
 }
 
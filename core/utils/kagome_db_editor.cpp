@@ -20,7 +20,7 @@
 #include "network/impl/extrinsic_observer_impl.hpp"
 #include "runtime/common/runtime_upgrade_tracker_impl.hpp"
 #include "storage/changes_trie/impl/storage_changes_tracker_impl.hpp"
-#include "storage/leveldb/leveldb.hpp"
+#include "storage/leveldb/leveldb_spaces.hpp"
 #include "storage/predefined_keys.hpp"
 #include "storage/trie/impl/trie_storage_backend_impl.hpp"
 #include "storage/trie/impl/trie_storage_impl.hpp"
@@ -196,13 +196,28 @@ int main(int argc, char *argv[]) {
 
   auto prefix = common::Buffer{blockchain::prefix::TRIE_NODE};
   bool need_additional_compaction = false;
+
+  // the database might not be opened by the node since the trie nodes were
+  // moved to a separate space, so the space is created then
+  std::map<storage::Space, storage::LevelDBSpaces::SpaceOptions> spaces_options{
+      {storage::Space::kDefault, {}}, {storage::Space::kTrieNode, {}}};
+  spaces_options[storage::Space::kTrieNode].options.create_if_missing = true;
   {
     auto factory = std::make_shared<PolkadotTrieFactoryImpl>();
 
     std::shared_ptr<storage::LevelDB> storage;
+    std::shared_ptr<storage::LevelDB> trie_node_storage;
     try {
-      storage =
-          storage::LevelDB::create(argv[DB_PATH], leveldb::Options()).value();
+      auto spaces =
+          storage::LevelDBSpaces::create(argv[DB_PATH], spaces_options).value();
+      storage = spaces->getDatabase(storage::Space::kDefault);
+      trie_node_storage = spaces->getDatabase(storage::Space::kTrieNode);
+      // as well as the trie nodes are moved there
+      for (auto key_column : {blockchain::prefix::TRIE_NODE,
+                              blockchain::prefix::TRIE_NODE_REFCOUNT}) {
+        blockchain::moveKeySpace(*storage, *trie_node_storage, key_column)
+            .value();
+      }
     } catch (std::system_error &e) {
       log->error("{}", e.what());
       usage();
@@ -217,9 +232,9 @@ int main(int argc, char *argv[]) {
               injector.template create<sptr<TrieStorageBackend>>());
         }),
         di::bind<TrieStorageBackend>.template to(
-            [&storage, &prefix](const auto &) {
-              auto backend =
-                  std::make_shared<TrieStorageBackendImpl>(storage, prefix);
+            [&trie_node_storage, &prefix](const auto &) {
+              auto backend = std::make_shared<TrieStorageBackendImpl>(
+                  trie_node_storage, prefix);
               return backend;
             }),
         di::bind<storage::changes_trie::ChangesTracker>.template to<storage::changes_trie::StorageChangesTrackerImpl>(),
@@ -357,8 +372,8 @@ int main(int argc, char *argv[]) {
         }
       }
 
-      auto db_cursor = storage->cursor();
-      auto db_batch = storage->batch();
+      auto db_cursor = trie_node_storage->cursor();
+      auto db_batch = trie_node_storage->batch();
       auto res = check(db_cursor->seek(prefix));
       int count = 0;
       {
@@ -370,10 +385,10 @@ int main(int argc, char *argv[]) {
           if (not(count % 10000000)) {
             log->trace("{} keys were processed at the db.", count);
             res2 = check(db_batch->commit());
-            dynamic_cast<storage::LevelDB *>(storage.get())
-                ->compact(prefix, check(db_cursor->key()).value());
-            db_cursor = storage->cursor();
-            db_batch = storage->batch();
+            trie_node_storage->compact(prefix,
+                                       check(db_cursor->key()).value());
+            db_cursor = trie_node_storage->cursor();
+            db_batch = trie_node_storage->batch();
             res = check(db_cursor->seek(prefix));
           }
           res2 = check(db_cursor->next());
@@ -393,8 +408,8 @@ int main(int argc, char *argv[]) {
 
       {
         TicToc t4("Compaction 1.", log);
-        dynamic_cast<storage::LevelDB *>(storage.get())
-            ->compact(common::Buffer(), common::Buffer());
+        storage->compact(common::Buffer(), common::Buffer());
+        trie_node_storage->compact(common::Buffer(), common::Buffer());
       }
 
       need_additional_compaction = true;
@@ -436,9 +451,11 @@ int main(int argc, char *argv[]) {
 
   if (need_additional_compaction) {
     TicToc t5("Compaction 2.", log);
-    auto storage =
-        check(storage::LevelDB::create(argv[1], leveldb::Options())).value();
-    dynamic_cast<storage::LevelDB *>(storage.get())
-        ->compact(common::Buffer(), common::Buffer());
+    auto spaces =
+        check(storage::LevelDBSpaces::create(argv[DB_PATH], spaces_options))
+            .value();
+    for (auto space : {storage::Space::kDefault, storage::Space::kTrieNode}) {
+      spaces->getDatabase(space)->compact(common::Buffer(), common::Buffer());
+    }
   }
 }
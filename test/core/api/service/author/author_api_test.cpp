@@ -486,7 +486,7 @@ TEST_F(AuthorApiTest, PendingExtrinsics) {
   std::vector<Extrinsic> expected_result;
 
   EXPECT_CALL(*transaction_pool, getPendingTransactions())
-      .WillOnce(ReturnRef(trxs));
+      .WillOnce(Return(trxs));
 
   ASSERT_OUTCOME_SUCCESS(actual_result, author_api->pendingExtrinsics());
   ASSERT_EQ(expected_result, actual_result);
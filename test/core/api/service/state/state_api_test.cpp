@@ -16,6 +16,7 @@
 #include "mock/core/runtime/core_mock.hpp"
 #include "mock/core/runtime/metadata_mock.hpp"
 #include "mock/core/storage/trie/trie_batches_mock.hpp"
+#include "mock/core/storage/trie/trie_diff_mock.hpp"
 #include "mock/core/storage/trie/trie_storage_mock.hpp"
 #include "primitives/block_header.hpp"
 #include "testutil/literals.hpp"
@@ -24,6 +25,7 @@
 using kagome::api::ApiServiceMock;
 using kagome::api::StateApiMock;
 using kagome::blockchain::BlockHeaderRepositoryMock;
+using kagome::blockchain::BlockTree;
 using kagome::blockchain::BlockTreeMock;
 using kagome::common::Buffer;
 using kagome::primitives::BlockHash;
@@ -32,6 +34,7 @@ using kagome::primitives::BlockInfo;
 using kagome::runtime::CoreMock;
 using kagome::runtime::MetadataMock;
 using kagome::storage::trie::EphemeralTrieBatchMock;
+using kagome::storage::trie::TrieDiffMock;
 using kagome::storage::trie::TrieStorageMock;
 using testing::_;
 using testing::ElementsAre;
@@ -42,13 +45,18 @@ namespace kagome::api {
   class StateApiTest : public ::testing::Test {
    public:
     void SetUp() override {
-      api_ = std::make_unique<api::StateApiImpl>(
-          block_header_repo_, storage_, block_tree_, runtime_core_, metadata_);
+      api_ = std::make_unique<api::StateApiImpl>(block_header_repo_,
+                                                 storage_,
+                                                 trie_diff_,
+                                                 block_tree_,
+                                                 runtime_core_,
+                                                 metadata_);
     }
 
    protected:
     std::shared_ptr<TrieStorageMock> storage_ =
         std::make_shared<TrieStorageMock>();
+    std::shared_ptr<TrieDiffMock> trie_diff_ = std::make_shared<TrieDiffMock>();
     std::shared_ptr<BlockHeaderRepositoryMock> block_header_repo_ =
         std::make_shared<BlockHeaderRepositoryMock>();
     std::shared_ptr<BlockTreeMock> block_tree_ =
@@ -103,8 +111,14 @@ namespace kagome::api {
       auto runtime_core = std::make_shared<CoreMock>();
       auto metadata = std::make_shared<MetadataMock>();
 
-      api_ = std::make_shared<api::StateApiImpl>(
-          block_header_repo_, storage, block_tree_, runtime_core, metadata);
+      auto trie_diff = std::make_shared<TrieDiffMock>();
+
+      api_ = std::make_shared<api::StateApiImpl>(block_header_repo_,
+                                                 storage,
+                                                 trie_diff,
+                                                 block_tree_,
+                                                 runtime_core,
+                                                 metadata);
 
       EXPECT_CALL(*block_tree_, getLastFinalized())
           .WillOnce(testing::Return(BlockInfo(42, "D"_hash256)));
@@ -341,7 +355,9 @@ namespace kagome::api {
   /**
    * @given that every queried key changed in every queired block
    * @when querying these changes through queryStorage
-   * @then all changes are reported for every block
+   * @then all changes are reported for every block, the values at the first
+   * block are read from its state and the following changes are found by
+   * comparing the states of the consecutive blocks
    */
   TEST_F(StateApiTest, QueryStorageSucceeds) {
     // GIVEN
@@ -350,40 +366,67 @@ namespace kagome::api {
     primitives::BlockHash to{"to"_hash256};
 
     std::vector block_range{from, "block2"_hash256, "block3"_hash256, to};
-    EXPECT_CALL(*block_tree_, getChainByBlocks(from, to))
-        .WillOnce(testing::Return(block_range));
     EXPECT_CALL(*block_header_repo_, getNumberByHash(from))
         .WillOnce(testing::Return(1));
     EXPECT_CALL(*block_header_repo_, getNumberByHash(to))
         .WillOnce(testing::Return(4));
+    std::vector<primitives::BlockHeader> headers;
+    std::optional<primitives::BlockHash> prev_state_root;
     for (auto &block_hash : block_range) {
       primitives::BlockHash state_root;
       auto s = block_hash.toString() + "_etats";
       std::copy_if(s.begin(), s.end(), state_root.begin(), [](auto b) {
         return b != 0;
       });
-      EXPECT_CALL(*block_header_repo_,
-                  getBlockHeader(primitives::BlockId{block_hash}))
-          .WillOnce(testing::Return(
-              primitives::BlockHeader{.state_root = state_root}));
-      EXPECT_CALL(*storage_, getEphemeralBatchAt(state_root))
-          .WillOnce(testing::Invoke([&keys](auto &root) {
-            auto batch =
-                std::make_unique<storage::trie::EphemeralTrieBatchMock>();
-            for (auto &key : keys) {
-              EXPECT_CALL(*batch, tryGet(key.view()))
-                  .WillOnce(testing::Return(common::Buffer(root)));
-            }
-            return batch;
-          }));
+      headers.push_back(primitives::BlockHeader{
+          .number = static_cast<primitives::BlockNumber>(headers.size() + 1),
+          .state_root = state_root});
+      if (not prev_state_root.has_value()) {
+        EXPECT_CALL(*storage_, getEphemeralBatchAt(state_root))
+            .WillOnce(testing::Invoke([&keys](auto &root) {
+              auto batch =
+                  std::make_unique<storage::trie::EphemeralTrieBatchMock>();
+              for (auto &key : keys) {
+                EXPECT_CALL(*batch, tryGet(key.view()))
+                    .WillOnce(testing::Return(common::Buffer(root)));
+              }
+              return batch;
+            }));
+      } else {
+        EXPECT_CALL(*trie_diff_,
+                    diff(prev_state_root.value(), state_root, _, _))
+            .WillOnce(testing::Invoke(
+                [&keys](auto &, auto &root, auto, auto &on_change)
+                    -> outcome::result<void> {
+                  for (auto &key : keys) {
+                    OUTCOME_TRY(on_change(key, common::BufferView{root}));
+                  }
+                  return outcome::success();
+                }));
+      }
+      prev_state_root = state_root;
     }
+    EXPECT_CALL(*block_tree_,
+                forEachBlockInChain(
+                    from, to, BlockTree::GetChainDirection::ASCEND, _))
+        .WillOnce(testing::Invoke([&](auto &, auto &, auto, auto &visitor)
+                                      -> outcome::result<void> {
+          for (size_t i = 0; i < block_range.size(); ++i) {
+            OUTCOME_TRY(visitor({headers[i].number, block_range[i]},
+                                headers[i]));
+          }
+          return outcome::success();
+        }));
+
     // WHEN
     EXPECT_OUTCOME_TRUE(changes, api_->queryStorage(keys, from, to))
 
     // THEN
+    ASSERT_EQ(changes.size(), block_range.size());
     auto current_block = block_range.begin();
     for (auto &block_changes : changes) {
       ASSERT_EQ(*current_block, block_changes.block);
+      ASSERT_EQ(block_changes.changes.size(), keys.size());
       ASSERT_THAT(block_changes.changes,
                   ::testing::Each(::testing::Field(
                       &StateApiImpl::StorageChangeSet::Change::key,
@@ -420,6 +463,40 @@ namespace kagome::api {
     ASSERT_EQ(error, StateApiImpl::Error::MAX_KEY_SET_SIZE_EXCEEDED);
   }
 
+  /**
+   * @given two blocks which states differ by the given number of keys
+   * @when requesting the keys changed between the blocks
+   * @then the keys reported by the diff of the states are returned, unless
+   * there are more of them than allowed
+   */
+  TEST_F(StateApiTest, GetChangedKeys) {
+    primitives::BlockHash from{"from"_hash256}, to{"to"_hash256};
+    auto from_root = "from_state"_hash256;
+    auto to_root = "to_state"_hash256;
+    EXPECT_CALL(*block_header_repo_, getBlockHeader(primitives::BlockId{from}))
+        .WillRepeatedly(
+            Return(primitives::BlockHeader{.state_root = from_root}));
+    EXPECT_CALL(*block_header_repo_, getBlockHeader(primitives::BlockId{to}))
+        .WillRepeatedly(Return(primitives::BlockHeader{.state_root = to_root}));
+    size_t changed_keys = 2;
+    EXPECT_CALL(*trie_diff_, diff(from_root, to_root, _))
+        .WillRepeatedly(testing::Invoke(
+            [&](auto &, auto &, auto &on_change) -> outcome::result<void> {
+              for (size_t i = 0; i < changed_keys; ++i) {
+                OUTCOME_TRY(on_change(Buffer{}.putUint32(i), std::nullopt));
+              }
+              return outcome::success();
+            }));
+
+    EXPECT_OUTCOME_TRUE(keys, api_->getChangedKeys(from, to));
+    ASSERT_THAT(keys,
+                ElementsAre(Buffer{}.putUint32(0), Buffer{}.putUint32(1)));
+
+    changed_keys = StateApiImpl::kMaxChangedKeys + 1;
+    EXPECT_OUTCOME_FALSE(error, api_->getChangedKeys(from, to));
+    ASSERT_EQ(error, StateApiImpl::Error::MAX_CHANGED_KEYS_EXCEEDED);
+  }
+
   /**
    * @given that every queried key changed in the given block
    * @when querying these changes through queryStorageAt
@@ -429,15 +506,18 @@ namespace kagome::api {
     // GIVEN
     std::vector<common::Buffer> keys{"key1"_buf, "key2"_buf, "key3"_buf};
     primitives::BlockHash at{"at"_hash256};
-    std::vector block_range{at};
-
-    EXPECT_CALL(*block_tree_, getChainByBlocks(at, at))
-        .WillOnce(testing::Return(block_range));
 
     primitives::BlockHash state_root = "at_state"_hash256;
-    EXPECT_CALL(*block_header_repo_, getBlockHeader(primitives::BlockId{at}))
-        .WillOnce(
-            testing::Return(primitives::BlockHeader{.state_root = state_root}));
+    EXPECT_CALL(*block_tree_,
+                forEachBlockInChain(
+                    at, at, BlockTree::GetChainDirection::ASCEND, _))
+        .WillOnce(testing::Invoke([&](auto &, auto &, auto, auto &visitor)
+                                      -> outcome::result<void> {
+          OUTCOME_TRY(visitor(
+              {1, at},
+              primitives::BlockHeader{.number = 1, .state_root = state_root}));
+          return outcome::success();
+        }));
     EXPECT_CALL(*storage_, getEphemeralBatchAt(state_root))
         .WillOnce(testing::Invoke([&keys](auto &root) {
           auto batch =
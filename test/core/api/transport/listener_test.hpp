@@ -21,6 +21,8 @@
 #include "mock/core/api/transport/jrpc_processor_stub.hpp"
 #include "mock/core/application/app_state_manager_mock.hpp"
 #include "mock/core/blockchain/block_tree_mock.hpp"
+#include "mock/core/crypto/hasher_mock.hpp"
+#include "mock/core/storage/trie/trie_diff_mock.hpp"
 #include "mock/core/storage/trie/trie_storage_mock.hpp"
 #include "primitives/event_types.hpp"
 #include "subscription/extrinsic_event_key_repository.hpp"
@@ -37,12 +39,16 @@ using namespace kagome::primitives;
 using kagome::application::AppStateManager;
 using kagome::blockchain::BlockTree;
 using kagome::blockchain::BlockTreeMock;
+using kagome::crypto::Hasher;
+using kagome::crypto::HasherMock;
 using kagome::primitives::events::ChainSubscriptionEngine;
 using kagome::primitives::events::ChainSubscriptionEnginePtr;
 using kagome::primitives::events::ExtrinsicSubscriptionEngine;
 using kagome::primitives::events::ExtrinsicSubscriptionEnginePtr;
 using kagome::primitives::events::StorageSubscriptionEngine;
 using kagome::primitives::events::StorageSubscriptionEnginePtr;
+using kagome::storage::trie::TrieDiff;
+using kagome::storage::trie::TrieDiffMock;
 using kagome::storage::trie::TrieStorage;
 using kagome::storage::trie::TrieStorageMock;
 using kagome::subscription::ExtrinsicEventKeyRepository;
@@ -129,6 +135,8 @@ struct ListenerTest : public ::testing::Test {
   std::shared_ptr<BlockTree> block_tree = std::make_shared<BlockTreeMock>();
   std::shared_ptr<TrieStorage> trie_storage =
       std::make_shared<TrieStorageMock>();
+  std::shared_ptr<TrieDiff> trie_diff = std::make_shared<TrieDiffMock>();
+  std::shared_ptr<Hasher> hasher = std::make_shared<HasherMock>();
 
   sptr<ApiService> service = std::make_shared<ApiServiceImpl>(
       app_state_manager,
@@ -141,7 +149,9 @@ struct ListenerTest : public ::testing::Test {
       ext_events_engine,
       ext_event_key_repo,
       block_tree,
-      trie_storage);
+      trie_storage,
+      trie_diff,
+      hasher);
 };
 
 #endif  // KAGOME_TEST_CORE_API_TRANSPORT_LISTENER_TEST_HPP
@@ -9,9 +9,14 @@
 #include "mock/core/blockchain/block_header_repository_mock.hpp"
 #include "mock/core/runtime/block_builder_api_mock.hpp"
 #include "mock/core/runtime/core_mock.hpp"
+#include "mock/core/storage/trie/trie_batches_mock.hpp"
+#include "mock/core/storage/trie/trie_storage_mock.hpp"
+#include "testutil/literals.hpp"
 #include "testutil/outcome.hpp"
 #include "testutil/prepare_loggers.hpp"
 
+using ::testing::_;
+using ::testing::Invoke;
 using ::testing::Return;
 
 using kagome::authorship::BlockBuilderFactoryImpl;
@@ -23,6 +28,8 @@ using kagome::primitives::Digest;
 using kagome::primitives::PreRuntime;
 using kagome::runtime::BlockBuilderApiMock;
 using kagome::runtime::CoreMock;
+using kagome::storage::trie::PersistentTrieBatchMock;
+using kagome::storage::trie::TrieStorageMock;
 
 class BlockBuilderFactoryTest : public ::testing::Test {
  public:
@@ -38,8 +45,16 @@ class BlockBuilderFactoryTest : public ::testing::Test {
     expected_header_.number = expected_number_;
     expected_header_.digest = inherent_digests_;
 
-    ON_CALL(*header_backend_, getNumberByHash(parent_hash_))
-        .WillByDefault(Return(parent_number_));
+    parent_header_.number = parent_number_;
+    parent_header_.state_root = "parent_state"_hash256;
+    ON_CALL(*header_backend_, getBlockHeader(BlockId{parent_hash_}))
+        .WillByDefault(Return(parent_header_));
+
+    EXPECT_CALL(*trie_storage_,
+                getPersistentBatchAt(parent_header_.state_root))
+        .WillOnce(Invoke([](auto &) {
+          return std::make_unique<PersistentTrieBatchMock>();
+        }));
   }
 
   std::shared_ptr<CoreMock> core_ = std::make_shared<CoreMock>();
@@ -47,11 +62,14 @@ class BlockBuilderFactoryTest : public ::testing::Test {
       std::make_shared<BlockBuilderApiMock>();
   std::shared_ptr<BlockHeaderRepositoryMock> header_backend_ =
       std::make_shared<BlockHeaderRepositoryMock>();
+  std::shared_ptr<TrieStorageMock> trie_storage_ =
+      std::make_shared<TrieStorageMock>();
 
   BlockNumber parent_number_{41};
   BlockNumber expected_number_{parent_number_ + 1};
   kagome::common::Hash256 parent_hash_;
   kagome::primitives::BlockInfo parent_;
+  BlockHeader parent_header_;
   Digest inherent_digests_{{PreRuntime{}}};
   BlockHeader expected_header_;
 };
@@ -65,9 +83,10 @@ class BlockBuilderFactoryTest : public ::testing::Test {
  */
 TEST_F(BlockBuilderFactoryTest, CreateSuccessful) {
   // given
-  EXPECT_CALL(*core_, initialize_block(expected_header_))
+  EXPECT_CALL(*core_, initialize_block(expected_header_, _))
       .WillOnce(Return(outcome::success()));
-  BlockBuilderFactoryImpl factory(core_, block_builder_api_, header_backend_);
+  BlockBuilderFactoryImpl factory(
+      core_, block_builder_api_, header_backend_, trie_storage_);
 
   // when
   auto block_builder_res = factory.make(parent_, inherent_digests_);
@@ -85,9 +104,10 @@ TEST_F(BlockBuilderFactoryTest, CreateSuccessful) {
  */
 TEST_F(BlockBuilderFactoryTest, CreateFailed) {
   // given
-  EXPECT_CALL(*core_, initialize_block(expected_header_))
+  EXPECT_CALL(*core_, initialize_block(expected_header_, _))
       .WillOnce(Return(outcome::failure(boost::system::error_code{})));
-  BlockBuilderFactoryImpl factory(core_, block_builder_api_, header_backend_);
+  BlockBuilderFactoryImpl factory(
+      core_, block_builder_api_, header_backend_, trie_storage_);
 
   // when
   auto block_builder_res = factory.make(parent_, inherent_digests_);
@@ -7,6 +7,7 @@
 
 #include <gtest/gtest.h>
 #include "mock/core/runtime/block_builder_api_mock.hpp"
+#include "mock/core/storage/trie/trie_batches_mock.hpp"
 #include "testutil/literals.hpp"
 #include "testutil/outcome.hpp"
 #include "testutil/prepare_loggers.hpp"
@@ -28,8 +29,7 @@ using kagome::primitives::Extrinsic;
 using kagome::primitives::InherentData;
 using kagome::primitives::dispatch_error::Other;
 using kagome::runtime::BlockBuilderApiMock;
-using kagome::runtime::PersistentResult;
-using kagome::storage::trie::RootHash;
+using kagome::storage::trie::PersistentTrieBatchMock;
 
 class BlockBuilderTest : public ::testing::Test {
  public:
@@ -46,7 +46,15 @@ class BlockBuilderTest : public ::testing::Test {
     parent_block_ = BlockInfo{block_number_ - 1, expected_header_.parent_hash};
 
     block_builder_ = std::make_shared<BlockBuilderImpl>(
-        expected_header_, initial_state_, block_builder_api_);
+        expected_header_, batch_, block_builder_api_);
+  }
+
+  /**
+   * The block state is expected to be committed once, when the block is baked
+   */
+  void expectStateCommitted() {
+    EXPECT_CALL(*batch_, commit())
+        .WillOnce(Return(expected_header_.state_root));
   }
 
  protected:
@@ -55,7 +63,8 @@ class BlockBuilderTest : public ::testing::Test {
 
   BlockHeader expected_header_;
   BlockNumber block_number_ = 123;
-  RootHash initial_state_ = "init_state"_hash256;
+  std::shared_ptr<PersistentTrieBatchMock> batch_ =
+      std::make_shared<PersistentTrieBatchMock>();
   BlockInfo parent_block_;
 
   std::shared_ptr<BlockBuilderImpl> block_builder_;
@@ -71,11 +80,12 @@ TEST_F(BlockBuilderTest, PushWhenApplyFails) {
   // given
   Extrinsic xt{};
   EXPECT_CALL(*block_builder_api_,
-              apply_extrinsic(parent_block_, initial_state_, xt))
+              apply_extrinsic(parent_block_, batch_, xt))
       .WillOnce(Return(outcome::failure(boost::system::error_code{})));
   EXPECT_CALL(*block_builder_api_,
-              finalize_block(parent_block_, initial_state_))
+              finalize_block(parent_block_, batch_))
       .WillOnce(Return(expected_header_));
+  expectStateCommitted();
 
   // when
   auto res = block_builder_->pushExtrinsic(xt);
@@ -96,13 +106,13 @@ TEST_F(BlockBuilderTest, PushWhenApplySucceedsWithTrue) {
   // given
   Extrinsic xt{};
   EXPECT_CALL(*block_builder_api_,
-              apply_extrinsic(parent_block_, initial_state_, xt))
-      .WillOnce(Return(outcome::success(
-          PersistentResult<kagome::primitives::ApplyExtrinsicResult>{
-              DispatchSuccess{}, "next_state"_hash256})));
+              apply_extrinsic(parent_block_, batch_, xt))
+      .WillOnce(Return(kagome::primitives::ApplyExtrinsicResult{
+          DispatchSuccess{}}));
   EXPECT_CALL(*block_builder_api_,
-              finalize_block(parent_block_, "next_state"_hash256))
+              finalize_block(parent_block_, batch_))
       .WillOnce(Return(expected_header_));
+  expectStateCommitted();
 
   // when
   auto res = block_builder_->pushExtrinsic(xt);
@@ -125,13 +135,13 @@ TEST_F(BlockBuilderTest, PushWhenApplySucceedsWithFalse) {
   // given
   Extrinsic xt{};
   EXPECT_CALL(*block_builder_api_,
-              apply_extrinsic(parent_block_, initial_state_, xt))
-      .WillOnce(Return(kagome::runtime::PersistentResult<
-                       kagome::primitives::ApplyExtrinsicResult>{
-          DispatchError{Other{}}, "next_state"_hash256}));
+              apply_extrinsic(parent_block_, batch_, xt))
+      .WillOnce(Return(kagome::primitives::ApplyExtrinsicResult{
+          DispatchError{Other{}}}));
   EXPECT_CALL(*block_builder_api_,
-              finalize_block(parent_block_, "next_state"_hash256))
+              finalize_block(parent_block_, batch_))
       .WillOnce(Return(expected_header_));
+  expectStateCommitted();
 
   // when
   auto res = block_builder_->pushExtrinsic(xt);
@@ -10,6 +10,7 @@
 #include "authorship/impl/block_builder_error.hpp"
 #include "mock/core/authorship/block_builder_factory_mock.hpp"
 #include "mock/core/authorship/block_builder_mock.hpp"
+#include "mock/core/clock/clock_mock.hpp"
 #include "mock/core/runtime/block_builder_api_mock.hpp"
 #include "mock/core/transaction_pool/transaction_pool_mock.hpp"
 #include "primitives/event_types.hpp"
@@ -28,6 +29,8 @@ using kagome::authorship::BlockBuilderError;
 using kagome::authorship::BlockBuilderFactoryMock;
 using kagome::authorship::BlockBuilderMock;
 using kagome::authorship::ProposerImpl;
+using kagome::clock::SystemClock;
+using kagome::clock::SystemClockMock;
 using kagome::common::Buffer;
 using kagome::primitives::Block;
 using kagome::primitives::BlockId;
@@ -41,6 +44,7 @@ using kagome::primitives::Transaction;
 using kagome::primitives::events::ExtrinsicSubscriptionEngine;
 using kagome::runtime::BlockBuilderApiMock;
 using kagome::subscription::ExtrinsicEventKeyRepository;
+using kagome::transaction_pool::ReadyTransactions;
 using kagome::transaction_pool::TransactionPoolMock;
 
 // TODO (kamilsa): workaround unless we bump gtest version to 1.8.1+
@@ -54,6 +58,15 @@ namespace kagome::primitives {
   }
 }  // namespace kagome::primitives
 
+/**
+ * @returns ready queue of a single transaction with {@param hash}
+ */
+ReadyTransactions makeReadyTransactions(const Transaction::Hash &hash) {
+  auto tx = std::make_shared<Transaction>();
+  tx->hash = hash;
+  return ReadyTransactions{{tx}};
+}
+
 class ProposerTest : public ::testing::Test {
  public:
   static void SetUpTestCase() {
@@ -76,6 +89,8 @@ class ProposerTest : public ::testing::Test {
         .WillOnce(Invoke([this](auto &&, auto &&) {
           return std::unique_ptr<BlockBuilderMock>{block_builder_};
         }));
+
+    EXPECT_CALL(*clock_, now()).WillRepeatedly(Return(now_));
   }
 
  protected:
@@ -83,6 +98,7 @@ class ProposerTest : public ::testing::Test {
       std::make_shared<BlockBuilderFactoryMock>();
   std::shared_ptr<TransactionPoolMock> transaction_pool_ =
       std::make_shared<TransactionPoolMock>();
+  std::shared_ptr<SystemClockMock> clock_ = std::make_shared<SystemClockMock>();
   std::shared_ptr<ExtrinsicSubscriptionEngine> extrinsic_sub_engine_ =
       std::make_shared<ExtrinsicSubscriptionEngine>();
   std::shared_ptr<ExtrinsicEventKeyRepository> extrinsic_event_key_repo_ =
@@ -92,11 +108,15 @@ class ProposerTest : public ::testing::Test {
 
   ProposerImpl proposer_{block_builder_factory_,
                          transaction_pool_,
+                         clock_,
                          extrinsic_sub_engine_,
                          extrinsic_event_key_repo_};
 
   BlockInfo expected_block_{42, {}};
 
+  SystemClock::TimePoint now_ = SystemClock::zero();
+  SystemClock::TimePoint deadline_ = now_ + std::chrono::seconds{1};
+
   Digest inherent_digests_{PreRuntime{}};
 
   InherentData inherent_data_;
@@ -118,12 +138,9 @@ TEST_F(ProposerTest, CreateBlockSuccess) {
       .WillOnce(Return(outcome::success()))
       .WillOnce(Return(outcome::success()));
 
-  // getReadyTransaction will return vector with single transaction
-  std::map<Transaction::Hash, std::shared_ptr<Transaction>> ready_transactions{
-      std::make_pair("fakeHash"_hash256, std::make_shared<Transaction>())};
-
-  EXPECT_CALL(*transaction_pool_, getReadyTransactions())
-      .WillOnce(Return(ready_transactions));
+  // getReadyQueue will return a single transaction
+  EXPECT_CALL(*transaction_pool_, getReadyQueue())
+      .WillOnce(Return(makeReadyTransactions("fakeHash"_hash256)));
 
   EXPECT_CALL(*transaction_pool_, removeOne("fakeHash"_hash256))
       .WillOnce(Return(outcome::success()));
@@ -136,8 +153,8 @@ TEST_F(ProposerTest, CreateBlockSuccess) {
   EXPECT_CALL(*block_builder_, bake()).WillOnce(Return(expected_block));
 
   // when
-  auto block_res =
-      proposer_.propose(expected_block_, inherent_data_, inherent_digests_);
+  auto block_res = proposer_.propose(
+      expected_block_, inherent_data_, inherent_digests_, deadline_);
 
   // then
   ASSERT_TRUE(block_res);
@@ -157,8 +174,8 @@ TEST_F(ProposerTest, CreateBlockFailsWhenXtNotPushed) {
       .WillOnce(Return(outcome::failure(BlockBuilderError::BAD_MANDATORY)));
 
   // when
-  auto block_res =
-      proposer_.propose(expected_block_, inherent_data_, inherent_digests_);
+  auto block_res = proposer_.propose(
+      expected_block_, inherent_data_, inherent_digests_, deadline_);
 
   // then
   ASSERT_FALSE(block_res);
@@ -185,20 +202,50 @@ TEST_F(ProposerTest, PushFailed) {
   EXPECT_CALL(*block_builder_, estimateBlockSize()).WillOnce(Return(1));
   EXPECT_CALL(*block_builder_, bake()).WillOnce(Return(expected_block));
 
-  std::map<Transaction::Hash, std::shared_ptr<Transaction>> ready_transactions{
-      std::make_pair("fakeHash"_hash256, std::make_shared<Transaction>())};
-
   EXPECT_CALL(*transaction_pool_, removeOne("fakeHash"_hash256))
       .WillOnce(Return(Transaction{}));
-  EXPECT_CALL(*transaction_pool_, getReadyTransactions())
-      .WillOnce(Return(ready_transactions));
+  EXPECT_CALL(*transaction_pool_, getReadyQueue())
+      .WillOnce(Return(makeReadyTransactions("fakeHash"_hash256)));
+  EXPECT_CALL(*transaction_pool_, removeStale(BlockId(expected_block_.number)))
+      .WillOnce(Return(outcome::success()));
+
+  // when
+  auto block_res = proposer_.propose(
+      expected_block_, inherent_data_, inherent_digests_, deadline_);
+
+  // then
+  ASSERT_TRUE(block_res);
+}
+
+/**
+ * @given BlockBuilderApi creating inherent extrinsics @and TransactionPool
+ * returning extrinsics
+ * @when Proposer is trying to create block @but the time left to the deadline
+ * is less than the soft limit
+ * @then Block is created with the inherent extrinsics only @and the
+ * transactions are left in the pool
+ */
+TEST_F(ProposerTest, DeadlineStopsInclusion) {
+  // given
+  EXPECT_CALL(*clock_, now())
+      .WillRepeatedly(
+          Return(deadline_ - ProposerImpl::kDeadlineSoftLimit / 2));
+  EXPECT_CALL(*block_builder_, pushExtrinsic(inherent_xts[0]))
+      .WillOnce(Return(outcome::success()));
+  EXPECT_CALL(*block_builder_, estimateBlockSize()).WillOnce(Return(1));
+  EXPECT_CALL(*block_builder_, bake()).WillOnce(Return(expected_block));
+
+  EXPECT_CALL(*transaction_pool_, getReadyQueue())
+      .WillOnce(Return(makeReadyTransactions("fakeHash"_hash256)));
   EXPECT_CALL(*transaction_pool_, removeStale(BlockId(expected_block_.number)))
       .WillOnce(Return(outcome::success()));
+  EXPECT_CALL(*transaction_pool_, removeOne(_)).Times(0);
 
   // when
-  auto block_res =
-      proposer_.propose(expected_block_, inherent_data_, inherent_digests_);
+  auto block_res = proposer_.propose(
+      expected_block_, inherent_data_, inherent_digests_, deadline_);
 
   // then
   ASSERT_TRUE(block_res);
+  ASSERT_EQ(expected_block, block_res.value());
 }
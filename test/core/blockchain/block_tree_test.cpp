@@ -159,7 +159,8 @@ struct BlockTreeTest : public testing::Test {
                                         changes_tracker_,
                                         babe_config_,
                                         babe_util_,
-                                        justification_storage_policy_)
+                                        justification_storage_policy_,
+                                        nullptr)
                       .value();
   }
 
@@ -493,6 +494,11 @@ TEST_F(BlockTreeTest, FinalizeWithPruning) {
   ASSERT_EQ(block_tree_->getLastFinalized().hash, B1_hash);
   ASSERT_EQ(block_tree_->getLeaves().size(), 1);
   ASSERT_EQ(block_tree_->deepestLeaf().hash, C1_hash);
+  // only the non-finalized part of the tree is still kept in memory
+  ASSERT_FALSE(block_tree_->getEpochDigest(0, B_hash));
+  ASSERT_FALSE(block_tree_->getEpochDigest(0, A_finalized_hash));
+  ASSERT_TRUE(block_tree_->getEpochDigest(0, B1_hash));
+  ASSERT_TRUE(block_tree_->getEpochDigest(0, C1_hash));
 }
 
 /**
@@ -562,6 +568,10 @@ TEST_F(BlockTreeTest, FinalizeWithPruningDeepestLeaf) {
   ASSERT_EQ(block_tree_->getLastFinalized().hash, B_hash);
   ASSERT_EQ(block_tree_->getLeaves().size(), 1);
   ASSERT_EQ(block_tree_->deepestLeaf().hash, B_hash);
+  // only the non-finalized part of the tree is still kept in memory
+  ASSERT_FALSE(block_tree_->getEpochDigest(0, B1_hash));
+  ASSERT_FALSE(block_tree_->getEpochDigest(0, C1_hash));
+  ASSERT_TRUE(block_tree_->getEpochDigest(0, B_hash));
 }
 
 std::shared_ptr<TreeNode> makeFullTree(size_t depth, size_t branching_factor) {
@@ -768,6 +778,107 @@ TEST_F(BlockTreeTest, GetChainByBlockDescending) {
   ASSERT_EQ(chain, expected_chain);
 }
 
+/**
+ * @given block tree with the best chain and a fork, which is longer than it
+ * @when walking the chain from a block of the best chain to the end of the
+ * fork in both directions
+ * @then the blocks of the chain are visited in the requested order along with
+ * their headers, the walk stops when the visitor asks so
+ */
+TEST_F(BlockTreeTest, ForEachBlockInChain) {
+  /*
+          42   43  44  45   46
+
+          LF - A - B - C1
+                     \
+                       C2 - D2
+   */
+  auto [A_hash, A_header] =
+      addHeaderToRepositoryAndGet(kFinalizedBlockInfo.hash, 43);
+  auto [B_hash, B_header] = addHeaderToRepositoryAndGet(A_hash, 44);
+  auto [C1_hash, C1_header] =
+      addHeaderToRepositoryAndGet(B_hash, 45, "1"_hash256);
+  auto [C2_hash, C2_header] =
+      addHeaderToRepositoryAndGet(B_hash, 45, "2"_hash256);
+  auto [D2_hash, D2_header] =
+      addHeaderToRepositoryAndGet(C2_hash, 46, "2"_hash256);
+
+  // the blocks of the best chain are loaded by their numbers
+  EXPECT_CALL(*header_repo_, getBlockHeader(BlockId{43}))
+      .WillRepeatedly(Return(A_header));
+  EXPECT_CALL(*header_repo_, getBlockHeader(BlockId{44}))
+      .WillRepeatedly(Return(B_header));
+  EXPECT_CALL(*header_repo_, getBlockHeader(BlockId{45}))
+      .WillRepeatedly(Return(C1_header));
+  EXPECT_CALL(*header_repo_, getBlockHeader(BlockId{46}))
+      .WillRepeatedly(Return(BlockTreeError::HEADER_NOT_FOUND));
+
+  std::vector<std::pair<BlockInfo, BlockHeader>> visited;
+  auto visit_all = [&](const BlockInfo &block, const BlockHeader &header)
+      -> outcome::result<bool> {
+    visited.emplace_back(block, header);
+    return true;
+  };
+
+  ASSERT_OUTCOME_SUCCESS_TRY(block_tree_->forEachBlockInChain(
+      A_hash, D2_hash, BlockTree::GetChainDirection::ASCEND, visit_all));
+  std::vector<std::pair<BlockInfo, BlockHeader>> expected{
+      {{43, A_hash}, A_header},
+      {{44, B_hash}, B_header},
+      {{45, C2_hash}, C2_header},
+      {{46, D2_hash}, D2_header}};
+  ASSERT_EQ(visited, expected);
+
+  visited.clear();
+  ASSERT_OUTCOME_SUCCESS_TRY(block_tree_->forEachBlockInChain(
+      A_hash, D2_hash, BlockTree::GetChainDirection::DESCEND, visit_all));
+  std::reverse(expected.begin(), expected.end());
+  ASSERT_EQ(visited, expected);
+
+  visited.clear();
+  ASSERT_OUTCOME_SUCCESS_TRY(block_tree_->forEachBlockInChain(
+      A_hash,
+      C1_hash,
+      BlockTree::GetChainDirection::ASCEND,
+      [&](const BlockInfo &block,
+          const BlockHeader &header) -> outcome::result<bool> {
+        visited.emplace_back(block, header);
+        return visited.size() < 2;
+      }));
+  expected = {{{43, A_hash}, A_header}, {{44, B_hash}, B_header}};
+  ASSERT_EQ(visited, expected);
+}
+
+/**
+ * @given block tree with a fork
+ * @when walking the chain between the blocks of different branches
+ * @then NO_DIRECT_CHAIN error is returned and no blocks are visited
+ */
+TEST_F(BlockTreeTest, ForEachBlockInChainNotDirect) {
+  auto A_hash = addHeaderToRepository(kFinalizedBlockInfo.hash, 43);
+  auto B1_hash = addHeaderToRepository(A_hash, 44, "1"_hash256);
+  auto B2_hash = addHeaderToRepository(A_hash, 44, "2"_hash256);
+  auto C2_hash = addHeaderToRepository(B2_hash, 45, "2"_hash256);
+
+  EXPECT_CALL(*header_repo_, getBlockHeader(BlockId{45}))
+      .WillRepeatedly(Return(BlockTreeError::HEADER_NOT_FOUND));
+
+  size_t visited = 0;
+  auto visit = [&](const BlockInfo &, const BlockHeader &)
+      -> outcome::result<bool> {
+    ++visited;
+    return true;
+  };
+  EXPECT_OUTCOME_ERROR(res,
+                       block_tree_->forEachBlockInChain(
+                           B1_hash,
+                           C2_hash,
+                           BlockTree::GetChainDirection::ASCEND,
+                           visit),
+                       BlockTreeError::NO_DIRECT_CHAIN);
+  ASSERT_EQ(visited, 0);
+}
+
 /**
  * @given a block tree with one block in it
  * @when trying to obtain the best chain that contais a block, which is
@@ -0,0 +1,47 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "common/worker_pool.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <future>
+
+using kagome::common::WorkerPool;
+
+/**
+ * @given a pool of several threads
+ * @when a job is run for a range of indices
+ * @then the job is called exactly once for each index before the call returns
+ */
+TEST(WorkerPoolTest, ParallelForCallsEachIndexOnce) {
+  WorkerPool pool{{4}};
+  std::vector<std::atomic_size_t> calls(100);
+
+  pool.parallelFor(calls.size(), [&](size_t i) { ++calls[i]; });
+
+  for (auto &count : calls) {
+    ASSERT_EQ(count, 1);
+  }
+}
+
+/**
+ * @given a pool whose only thread is busy
+ * @when a job is run for a range of indices
+ * @then the job is completed by the calling thread
+ */
+TEST(WorkerPoolTest, ParallelForProgressesWhenPoolIsBusy) {
+  WorkerPool pool{{1}};
+  std::promise<void> release;
+  auto released = release.get_future().share();
+  pool.post([released] { released.wait(); });
+
+  std::atomic_size_t calls{0};
+  pool.parallelFor(10, [&](size_t) { ++calls; });
+  release.set_value();
+
+  ASSERT_EQ(calls, 10);
+}
@@ -12,6 +12,7 @@
 
 #include "consensus/babe/babe_error.hpp"
 #include "consensus/babe/impl/babe_impl.hpp"
+#include "mock/core/application/app_configuration_mock.hpp"
 #include "mock/core/application/app_state_manager_mock.hpp"
 #include "mock/core/authorship/proposer_mock.hpp"
 #include "mock/core/blockchain/block_tree_mock.hpp"
@@ -145,7 +146,10 @@ class BabeTest : public testing::Test {
     EXPECT_CALL(*sr25519_provider, sign(_, _))
         .WillRepeatedly(Return(Sr25519Signature{}));
 
+    EXPECT_CALL(app_config_, blockProposalShare()).WillRepeatedly(Return(66));
+
     babe_ = std::make_shared<babe::BabeImpl>(app_state_manager_,
+                                             app_config_,
                                              lottery_,
                                              babe_config_,
                                              proposer_,
@@ -159,7 +163,8 @@ class BabeTest : public testing::Test {
                                              grandpa_authority_update_observer_,
                                              synchronizer_,
                                              babe_util_,
-                                             offchain_worker_api_);
+                                             offchain_worker_api_,
+                                             block_state_cache_);
 
     epoch_.start_slot = 0;
     epoch_.epoch_number = 0;
@@ -176,6 +181,7 @@ class BabeTest : public testing::Test {
   }
 
   std::shared_ptr<AppStateManagerMock> app_state_manager_;
+  AppConfigurationMock app_config_;
   std::shared_ptr<BabeLotteryMock> lottery_;
   std::shared_ptr<Synchronizer> synchronizer_;
   std::shared_ptr<BlockValidator> babe_block_validator_;
@@ -196,6 +202,8 @@ class BabeTest : public testing::Test {
   std::shared_ptr<primitives::BabeConfiguration> babe_config_;
   std::shared_ptr<BabeUtilMock> babe_util_;
   std::shared_ptr<runtime::OffchainWorkerApiMock> offchain_worker_api_;
+  std::shared_ptr<BlockStateCache> block_state_cache_ =
+      std::make_shared<BlockStateCache>();
   std::shared_ptr<boost::asio::io_context> io_context_;
 
   std::shared_ptr<babe::BabeImpl> babe_;
@@ -298,7 +306,7 @@ TEST_F(BabeTest, Success) {
   EXPECT_CALL(*block_tree_, getBlockHeader(BlockId(BlockNumber(1))))
       .WillRepeatedly(Return(outcome::success(block_header_)));
 
-  EXPECT_CALL(*proposer_, propose(best_leaf, _, _))
+  EXPECT_CALL(*proposer_, propose(best_leaf, _, _, _))
       .WillOnce(Return(created_block_));
 
   EXPECT_CALL(*hasher_, blake2b_256(_))
@@ -312,4 +320,9 @@ TEST_F(BabeTest, Success) {
   ASSERT_NO_THROW(on_process_slot_1({}));
   ASSERT_NO_THROW(on_run_slot_2({}));
   ASSERT_NO_THROW(on_process_slot_2({}));
+
+  // the state of the produced block is known to the block executor
+  ASSERT_EQ(block_state_cache_->get(created_block_hash_,
+                                    best_block_header_.state_root),
+            created_block_.header.state_root);
 }
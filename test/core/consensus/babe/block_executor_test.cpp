@@ -17,9 +17,13 @@
 #include "mock/core/crypto/hasher_mock.hpp"
 #include "mock/core/runtime/core_mock.hpp"
 #include "mock/core/runtime/offchain_worker_api_mock.hpp"
+#include "mock/core/storage/changes_trie/changes_tracker_mock.hpp"
+#include "mock/core/storage/trie/trie_batches_mock.hpp"
+#include "mock/core/storage/trie/trie_storage_mock.hpp"
 #include "mock/core/transaction_pool/transaction_pool_mock.hpp"
 
 #include "blockchain/impl/common.hpp"
+#include "storage/trie/serialization/ordered_trie_hash.hpp"
 #include "testutil/literals.hpp"
 #include "testutil/outcome.hpp"
 #include "testutil/prepare_loggers.hpp"
@@ -30,10 +34,13 @@ using kagome::blockchain::BlockTree;
 using kagome::blockchain::BlockTreeError;
 using kagome::blockchain::BlockTreeMock;
 using kagome::common::Buffer;
+using kagome::common::Hash256;
+using kagome::common::WorkerPool;
 using kagome::consensus::BabeBlockHeader;
 using kagome::consensus::BabeUtil;
 using kagome::consensus::BabeUtilMock;
 using kagome::consensus::BlockExecutorImpl;
+using kagome::consensus::BlockStateCache;
 using kagome::consensus::BlockValidator;
 using kagome::consensus::BlockValidatorMock;
 using kagome::consensus::EpochDigest;
@@ -54,11 +61,24 @@ using kagome::runtime::Core;
 using kagome::runtime::CoreMock;
 using kagome::runtime::OffchainWorkerApi;
 using kagome::runtime::OffchainWorkerApiMock;
+using kagome::storage::changes_trie::ChangesTrackerMock;
+using kagome::storage::trie::EphemeralTrieBatchMock;
+using kagome::storage::trie::TrieStorageMock;
 using kagome::transaction_pool::TransactionPool;
 using kagome::transaction_pool::TransactionPoolMock;
 
 using testing::_;
 
+namespace {
+  /// extrinsics root of a block with an empty body
+  Hash256 emptyExtrinsicsRoot() {
+    return Hash256::fromSpan(kagome::storage::trie::calculateOrderedTrieHash(
+                                 std::vector<Buffer>{})
+                                 .value())
+        .value();
+  }
+}  // namespace
+
 class BlockExecutorTest : public testing::Test {
  public:
   static void SetUpTestCase() {
@@ -77,6 +97,9 @@ class BlockExecutorTest : public testing::Test {
         std::make_shared<AuthorityUpdateObserverMock>();
     babe_util_ = std::make_shared<BabeUtilMock>();
     offchain_worker_api_ = std::make_shared<OffchainWorkerApiMock>();
+    block_state_cache_ = std::make_shared<BlockStateCache>();
+    trie_storage_ = std::make_shared<TrieStorageMock>();
+    changes_tracker_ = std::make_shared<ChangesTrackerMock>();
 
     block_executor_ =
         std::make_shared<BlockExecutorImpl>(block_tree_,
@@ -88,7 +111,11 @@ class BlockExecutorTest : public testing::Test {
                                             hasher_,
                                             authority_update_observer_,
                                             babe_util_,
-                                            offchain_worker_api_);
+                                            offchain_worker_api_,
+                                            block_state_cache_,
+                                            trie_storage_,
+                                            changes_tracker_,
+                                            worker_pool_);
   }
 
  protected:
@@ -102,6 +129,11 @@ class BlockExecutorTest : public testing::Test {
   std::shared_ptr<AuthorityUpdateObserverMock> authority_update_observer_;
   std::shared_ptr<BabeUtilMock> babe_util_;
   std::shared_ptr<OffchainWorkerApiMock> offchain_worker_api_;
+  std::shared_ptr<BlockStateCache> block_state_cache_;
+  std::shared_ptr<TrieStorageMock> trie_storage_;
+  std::shared_ptr<ChangesTrackerMock> changes_tracker_;
+  std::shared_ptr<WorkerPool> worker_pool_ =
+      std::make_shared<WorkerPool>(WorkerPool::Configuration{.workers = 1});
 
   std::shared_ptr<BlockExecutorImpl> block_executor_;
 };
@@ -118,6 +150,7 @@ TEST_F(BlockExecutorTest, JustificationFollowDigests) {
   kagome::primitives::BlockHeader header{
       .parent_hash = "parent_hash"_hash256,
       .number = 42,
+      .extrinsics_root = emptyExtrinsicsRoot(),
       .digest = kagome::primitives::Digest{
           kagome::primitives::PreRuntime{
               kagome::primitives::kBabeEngineId,
@@ -192,3 +225,309 @@ TEST_F(BlockExecutorTest, JustificationFollowDigests) {
 
   EXPECT_OUTCOME_TRUE_1(block_executor_->applyBlock(std::move(block_data)))
 }
+
+/**
+ * @given a block with extrinsics root not matching its body
+ * @when applying the block
+ * @then the block is rejected
+ */
+TEST_F(BlockExecutorTest, InvalidExtrinsicsRoot) {
+  kagome::primitives::BlockData block_data{
+      .hash = "some_block"_hash256,
+      .header =
+          kagome::primitives::BlockHeader{
+              .parent_hash = "parent_hash"_hash256,
+              .number = 42,
+              .extrinsics_root = "wrong_root"_hash256},
+      .body = kagome::primitives::BlockBody{}};
+  EXPECT_CALL(*block_tree_, getBlockBody(BlockId{"parent_hash"_hash256}))
+      .WillOnce(testing::Return(kagome::primitives::BlockBody{}));
+  EXPECT_CALL(*block_tree_, getBlockBody(BlockId{"some_hash"_hash256}))
+      .WillOnce(
+          testing::Return(kagome::blockchain::BlockTreeError::BODY_NOT_FOUND));
+  EXPECT_CALL(*hasher_, blake2b_256(_))
+      .WillOnce(testing::Return("some_hash"_hash256));
+  EXPECT_CALL(*core_, execute_block(_)).Times(0);
+
+  EXPECT_OUTCOME_ERROR(res,
+                       block_executor_->applyBlock(std::move(block_data)),
+                       BlockExecutorImpl::Error::INVALID_EXTRINSICS_ROOT);
+}
+
+/**
+ * @given a block prepared for application while its parent is in the tree
+ * @when applying the block
+ * @then its header is validated only once, ahead of the application
+ */
+TEST_F(BlockExecutorTest, PreparedHeaderIsValidatedOnce) {
+  AuthorityList authorities{Authority{"auth0"_hash256, 1}};
+  kagome::primitives::BlockHeader header{
+      .parent_hash = "parent_hash"_hash256,
+      .number = 42,
+      .extrinsics_root = emptyExtrinsicsRoot(),
+      .digest = kagome::primitives::Digest{
+          kagome::primitives::PreRuntime{
+              kagome::primitives::kBabeEngineId,
+              Buffer{scale::encode(BabeBlockHeader{.slot_number = 0,
+                                                   .authority_index = 0})
+                         .value()}},
+          kagome::primitives::Seal{
+              kagome::primitives::kBabeEngineId,
+              Buffer{scale::encode(kagome::consensus::Seal{}).value()}}}};
+  kagome::primitives::BlockData block_data{
+      .hash = "some_block"_hash256,
+      .header = header,
+      .body = kagome::primitives::BlockBody{}};
+
+  EXPECT_CALL(*hasher_, blake2b_256(_))
+      .WillRepeatedly(testing::Return("some_hash"_hash256));
+  EXPECT_CALL(*block_tree_, getLastFinalized())
+      .WillRepeatedly(
+          testing::Return(BlockInfo{40, "grandparent_hash"_hash256}));
+  EXPECT_CALL(*block_tree_, getEpochDigest(0, "parent_hash"_hash256))
+      .WillRepeatedly(testing::Return(EpochDigest{
+          .authorities = authorities, .randomness = "randomness"_hash256}));
+  configuration_->leadership_rate.second = 42;
+  EXPECT_CALL(
+      *block_validator_,
+      validateHeader(header,
+                     0,
+                     AuthorityId{"auth0"_hash256},
+                     kagome::consensus::calculateThreshold(
+                         configuration_->leadership_rate, authorities, 0),
+                     "randomness"_hash256))
+      .WillOnce(testing::Return(outcome::success()));
+
+  block_executor_->prepareBlock(block_data);
+
+  EXPECT_CALL(*block_tree_, getBlockBody(BlockId{"parent_hash"_hash256}))
+      .WillOnce(testing::Return(kagome::primitives::BlockBody{}));
+  EXPECT_CALL(*block_tree_, getBlockBody(BlockId{"some_hash"_hash256}))
+      .WillOnce(
+          testing::Return(kagome::blockchain::BlockTreeError::BODY_NOT_FOUND));
+  EXPECT_CALL(*block_tree_, getBlockHeader(BlockId{"parent_hash"_hash256}))
+      .WillOnce(testing::Return(kagome::primitives::BlockHeader{
+          .parent_hash = "grandparent_hash"_hash256, .number = 41}));
+  EXPECT_CALL(*block_tree_,
+              getBestContaining("grandparent_hash"_hash256,
+                                std::optional<BlockNumber>{}))
+      .WillOnce(testing::Return(BlockInfo{41, "parent_hash"_hash256}))
+      .WillOnce(testing::Return(BlockInfo{42, "some_hash"_hash256}));
+  EXPECT_CALL(*core_, execute_block(_))
+      .WillOnce(testing::Return(outcome::success()));
+  EXPECT_CALL(*block_tree_, addBlock(_))
+      .WillOnce(testing::Return(outcome::success()));
+  EXPECT_CALL(*offchain_worker_api_, offchain_worker(_, _))
+      .WillOnce(testing::Return(outcome::success()));
+
+  EXPECT_OUTCOME_TRUE_1(block_executor_->applyBlock(std::move(block_data)))
+}
+
+/**
+ * @given a block of the next epoch, whose parent is not in the tree yet
+ * @when the block is prepared for application
+ * @then its header is not validated ahead, as the epoch descriptor of the block
+ * can not be taken from the best block of the previous epoch
+ */
+TEST_F(BlockExecutorTest, PreparationSkipsHeaderOfUnknownEpoch) {
+  auto babe_digests = [](kagome::consensus::BabeSlotNumber slot) {
+    return kagome::primitives::Digest{
+        kagome::primitives::PreRuntime{
+            kagome::primitives::kBabeEngineId,
+            Buffer{scale::encode(BabeBlockHeader{.slot_number = slot,
+                                                 .authority_index = 0})
+                       .value()}},
+        kagome::primitives::Seal{
+            kagome::primitives::kBabeEngineId,
+            Buffer{scale::encode(kagome::consensus::Seal{}).value()}}};
+  };
+  kagome::primitives::BlockData block_data{
+      .hash = "some_block"_hash256,
+      .header =
+          kagome::primitives::BlockHeader{
+              .parent_hash = "parent_hash"_hash256,
+              .number = 42,
+              .extrinsics_root = emptyExtrinsicsRoot(),
+              .digest = babe_digests(10)},
+      .body = kagome::primitives::BlockBody{}};
+
+  EXPECT_CALL(*hasher_, blake2b_256(_))
+      .WillRepeatedly(testing::Return("some_hash"_hash256));
+  EXPECT_CALL(*block_tree_, getLastFinalized())
+      .WillRepeatedly(
+          testing::Return(BlockInfo{40, "grandparent_hash"_hash256}));
+  EXPECT_CALL(*babe_util_, slotToEpoch(10)).WillRepeatedly(testing::Return(1));
+  EXPECT_CALL(*babe_util_, slotToEpoch(5)).WillRepeatedly(testing::Return(0));
+  EXPECT_CALL(*block_tree_, getEpochDigest(1, "parent_hash"_hash256))
+      .WillOnce(testing::Return(BlockTreeError::HEADER_NOT_FOUND));
+  EXPECT_CALL(*block_tree_, deepestLeaf())
+      .WillOnce(testing::Return(BlockInfo{41, "best_hash"_hash256}));
+  EXPECT_CALL(*block_tree_, getBlockHeader(BlockId{"best_hash"_hash256}))
+      .WillOnce(testing::Return(kagome::primitives::BlockHeader{
+          .number = 41, .digest = babe_digests(5)}));
+  EXPECT_CALL(*block_tree_, getEpochDigest(1, "best_hash"_hash256)).Times(0);
+  EXPECT_CALL(*block_validator_, validateHeader(_, _, _, _, _)).Times(0);
+
+  block_executor_->prepareBlock(block_data);
+}
+
+namespace {
+  /// ephemeral batch of a state with the runtime \arg code
+  std::unique_ptr<EphemeralTrieBatchMock> makeStateWithCode(
+      const Buffer &code) {
+    auto batch = std::make_unique<EphemeralTrieBatchMock>();
+    EXPECT_CALL(*batch, tryGet(_))
+        .WillOnce(testing::Return(
+            std::make_optional(kagome::common::BufferConstRef{code})));
+    return batch;
+  }
+}  // namespace
+
+/**
+ * @given a block, which state has been produced by this node on top of the
+ * state of its parent and is still in the storage, with the same runtime code
+ * as the parent state
+ * @when applying the block
+ * @then the block is added to the block tree without being executed, after
+ * the changes of the previous execution are discarded
+ */
+TEST_F(BlockExecutorTest, KnownStateIsNotProducedAgain) {
+  AuthorityList authorities{Authority{"auth0"_hash256, 1}};
+  kagome::primitives::BlockHeader header{
+      .parent_hash = "parent_hash"_hash256,
+      .number = 42,
+      .state_root = "state_root"_hash256,
+      .extrinsics_root = emptyExtrinsicsRoot(),
+      .digest = kagome::primitives::Digest{
+          kagome::primitives::PreRuntime{
+              kagome::primitives::kBabeEngineId,
+              Buffer{scale::encode(BabeBlockHeader{.slot_number = 0,
+                                                   .authority_index = 0})
+                         .value()}},
+          kagome::primitives::Seal{
+              kagome::primitives::kBabeEngineId,
+              Buffer{scale::encode(kagome::consensus::Seal{}).value()}}}};
+  kagome::primitives::BlockData block_data{
+      .hash = "some_block"_hash256,
+      .header = header,
+      .body = kagome::primitives::BlockBody{}};
+  block_state_cache_->put(
+      "some_hash"_hash256, "parent_state"_hash256, "state_root"_hash256);
+  Buffer code{"code"_buf};
+
+  EXPECT_CALL(*block_tree_, getBlockBody(BlockId{"parent_hash"_hash256}))
+      .WillOnce(testing::Return(kagome::primitives::BlockBody{}));
+  EXPECT_CALL(*block_tree_, getBlockBody(BlockId{"some_hash"_hash256}))
+      .WillOnce(
+          testing::Return(kagome::blockchain::BlockTreeError::BODY_NOT_FOUND));
+  EXPECT_CALL(*hasher_, blake2b_256(_))
+      .WillRepeatedly(testing::Return("some_hash"_hash256));
+  EXPECT_CALL(*block_tree_, getEpochDigest(0, "parent_hash"_hash256))
+      .WillOnce(testing::Return(EpochDigest{
+          .authorities = authorities, .randomness = "randomness"_hash256}));
+  EXPECT_CALL(*block_validator_, validateHeader(header, 0, _, _, _))
+      .WillOnce(testing::Return(outcome::success()));
+  EXPECT_CALL(*block_tree_, getBlockHeader(BlockId{"parent_hash"_hash256}))
+      .WillOnce(testing::Return(kagome::primitives::BlockHeader{
+          .parent_hash = "grandparent_hash"_hash256,
+          .number = 41,
+          .state_root = "parent_state"_hash256}));
+  EXPECT_CALL(*block_tree_, getLastFinalized())
+      .WillRepeatedly(
+          testing::Return(BlockInfo{40, "grandparent_hash"_hash256}));
+  EXPECT_CALL(*block_tree_,
+              getBestContaining("grandparent_hash"_hash256,
+                                std::optional<BlockNumber>{}))
+      .WillOnce(testing::Return(BlockInfo{41, "parent_hash"_hash256}))
+      .WillOnce(testing::Return(BlockInfo{42, "some_hash"_hash256}));
+  EXPECT_CALL(*trie_storage_, getEphemeralBatchAt("state_root"_hash256))
+      .WillOnce(
+          testing::Invoke([&](auto &) { return makeStateWithCode(code); }));
+  EXPECT_CALL(*trie_storage_, getEphemeralBatchAt("parent_state"_hash256))
+      .WillOnce(
+          testing::Invoke([&](auto &) { return makeStateWithCode(code); }));
+  EXPECT_CALL(*core_, execute_block(_)).Times(0);
+  EXPECT_CALL(*changes_tracker_,
+              onBlockExecutionStart("parent_hash"_hash256, 41))
+      .WillOnce(testing::Return(outcome::success()));
+  EXPECT_CALL(*block_tree_, addBlock(_))
+      .WillOnce(testing::Return(outcome::success()));
+  EXPECT_CALL(*offchain_worker_api_, offchain_worker(_, _))
+      .WillOnce(testing::Return(outcome::success()));
+
+  EXPECT_OUTCOME_TRUE_1(block_executor_->applyBlock(std::move(block_data)))
+}
+
+/**
+ * @given a block, which state has been produced by this node on top of the
+ * state of its parent and is still in the storage, with a runtime code
+ * different from the one of the parent state
+ * @when applying the block
+ * @then the block is executed, so that the runtime upgrade is detected
+ */
+TEST_F(BlockExecutorTest, RuntimeUpgradeIsExecutedAgain) {
+  AuthorityList authorities{Authority{"auth0"_hash256, 1}};
+  kagome::primitives::BlockHeader header{
+      .parent_hash = "parent_hash"_hash256,
+      .number = 42,
+      .state_root = "state_root"_hash256,
+      .extrinsics_root = emptyExtrinsicsRoot(),
+      .digest = kagome::primitives::Digest{
+          kagome::primitives::PreRuntime{
+              kagome::primitives::kBabeEngineId,
+              Buffer{scale::encode(BabeBlockHeader{.slot_number = 0,
+                                                   .authority_index = 0})
+                         .value()}},
+          kagome::primitives::Seal{
+              kagome::primitives::kBabeEngineId,
+              Buffer{scale::encode(kagome::consensus::Seal{}).value()}}}};
+  kagome::primitives::BlockData block_data{
+      .hash = "some_block"_hash256,
+      .header = header,
+      .body = kagome::primitives::BlockBody{}};
+  block_state_cache_->put(
+      "some_hash"_hash256, "parent_state"_hash256, "state_root"_hash256);
+  Buffer code{"new_code"_buf};
+  Buffer parent_code{"code"_buf};
+
+  EXPECT_CALL(*block_tree_, getBlockBody(BlockId{"parent_hash"_hash256}))
+      .WillOnce(testing::Return(kagome::primitives::BlockBody{}));
+  EXPECT_CALL(*block_tree_, getBlockBody(BlockId{"some_hash"_hash256}))
+      .WillOnce(
+          testing::Return(kagome::blockchain::BlockTreeError::BODY_NOT_FOUND));
+  EXPECT_CALL(*hasher_, blake2b_256(_))
+      .WillRepeatedly(testing::Return("some_hash"_hash256));
+  EXPECT_CALL(*block_tree_, getEpochDigest(0, "parent_hash"_hash256))
+      .WillOnce(testing::Return(EpochDigest{
+          .authorities = authorities, .randomness = "randomness"_hash256}));
+  EXPECT_CALL(*block_validator_, validateHeader(header, 0, _, _, _))
+      .WillOnce(testing::Return(outcome::success()));
+  EXPECT_CALL(*block_tree_, getBlockHeader(BlockId{"parent_hash"_hash256}))
+      .WillOnce(testing::Return(kagome::primitives::BlockHeader{
+          .parent_hash = "grandparent_hash"_hash256,
+          .number = 41,
+          .state_root = "parent_state"_hash256}));
+  EXPECT_CALL(*block_tree_, getLastFinalized())
+      .WillRepeatedly(
+          testing::Return(BlockInfo{40, "grandparent_hash"_hash256}));
+  EXPECT_CALL(*block_tree_,
+              getBestContaining("grandparent_hash"_hash256,
+                                std::optional<BlockNumber>{}))
+      .WillOnce(testing::Return(BlockInfo{41, "parent_hash"_hash256}))
+      .WillOnce(testing::Return(BlockInfo{42, "some_hash"_hash256}));
+  EXPECT_CALL(*trie_storage_, getEphemeralBatchAt("state_root"_hash256))
+      .WillOnce(
+          testing::Invoke([&](auto &) { return makeStateWithCode(code); }));
+  EXPECT_CALL(*trie_storage_, getEphemeralBatchAt("parent_state"_hash256))
+      .WillOnce(testing::Invoke(
+          [&](auto &) { return makeStateWithCode(parent_code); }));
+  EXPECT_CALL(*core_, execute_block(_))
+      .WillOnce(testing::Return(outcome::success()));
+  EXPECT_CALL(*changes_tracker_, onBlockExecutionStart(_, _)).Times(0);
+  EXPECT_CALL(*block_tree_, addBlock(_))
+      .WillOnce(testing::Return(outcome::success()));
+  EXPECT_CALL(*offchain_worker_api_, offchain_worker(_, _))
+      .WillOnce(testing::Return(outcome::success()));
+
+  EXPECT_OUTCOME_TRUE_1(block_executor_->applyBlock(std::move(block_data)))
+}
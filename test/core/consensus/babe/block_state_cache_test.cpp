@@ -0,0 +1,51 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "consensus/babe/impl/block_state_cache.hpp"
+
+#include <gtest/gtest.h>
+
+#include "testutil/literals.hpp"
+
+using kagome::common::Hash256;
+using kagome::consensus::BlockStateCache;
+
+/**
+ * @given a cache with the state of a block
+ * @when the state is requested for the same parent state and for another one
+ * @then it is returned only for the parent state it was produced on top of
+ */
+TEST(BlockStateCacheTest, MatchesParentState) {
+  BlockStateCache cache;
+  cache.put("block"_hash256, "parent_state"_hash256, "state"_hash256);
+
+  ASSERT_EQ(cache.get("block"_hash256, "parent_state"_hash256),
+            "state"_hash256);
+  ASSERT_FALSE(cache.get("block"_hash256, "other_state"_hash256));
+  ASSERT_FALSE(cache.get("other_block"_hash256, "parent_state"_hash256));
+}
+
+/**
+ * @given a cache filled up to its capacity
+ * @when one more block is put
+ * @then the oldest block is evicted, while the rest are kept
+ */
+TEST(BlockStateCacheTest, EvictsOldestBlock) {
+  BlockStateCache cache;
+  auto block = [](size_t i) {
+    Hash256 hash;
+    hash[0] = i & 0xff;
+    hash[1] = i >> 8;
+    return hash;
+  };
+  for (size_t i = 0; i <= BlockStateCache::kCapacity; ++i) {
+    cache.put(block(i), "parent_state"_hash256, "state"_hash256);
+  }
+
+  ASSERT_FALSE(cache.get(block(0), "parent_state"_hash256));
+  for (size_t i = 1; i <= BlockStateCache::kCapacity; ++i) {
+    ASSERT_EQ(cache.get(block(i), "parent_state"_hash256), "state"_hash256);
+  }
+}
@@ -0,0 +1,117 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "consensus/grandpa/impl/vote_crypto_provider_impl.hpp"
+
+#include <gtest/gtest.h>
+
+#include "mock/core/crypto/ed25519_provider_mock.hpp"
+#include "testutil/literals.hpp"
+
+using kagome::common::WorkerPool;
+using kagome::consensus::grandpa::Prevote;
+using kagome::consensus::grandpa::SignedMessage;
+using kagome::consensus::grandpa::VerifiedVoteCache;
+using kagome::consensus::grandpa::VoteCryptoProviderImpl;
+using kagome::consensus::grandpa::VoterSet;
+using kagome::crypto::Ed25519Keypair;
+using kagome::crypto::Ed25519ProviderMock;
+
+using testing::_;
+using testing::Return;
+
+class VoteCryptoProviderTest : public testing::Test {
+ public:
+  /**
+   * @returns vote for block {@param number} signed by voter {@param voter}
+   */
+  static SignedMessage makeVote(uint8_t voter, uint32_t number) {
+    SignedMessage vote{.message = Prevote{number, "block"_hash256}};
+    vote.id[0] = voter;
+    vote.signature[0] = voter;
+    return vote;
+  }
+
+  std::shared_ptr<VoteCryptoProviderImpl> makeProvider(uint64_t round) {
+    return std::make_shared<VoteCryptoProviderImpl>(keypair_,
+                                                    ed_provider_,
+                                                    round,
+                                                    voter_set_,
+                                                    verified_votes_,
+                                                    worker_pool_);
+  }
+
+ protected:
+  std::shared_ptr<Ed25519Keypair> keypair_;
+  std::shared_ptr<Ed25519ProviderMock> ed_provider_ =
+      std::make_shared<Ed25519ProviderMock>();
+  std::shared_ptr<VoterSet> voter_set_ = std::make_shared<VoterSet>(0);
+  std::shared_ptr<VerifiedVoteCache> verified_votes_ =
+      std::make_shared<VerifiedVoteCache>();
+  std::shared_ptr<WorkerPool> worker_pool_ =
+      std::make_shared<WorkerPool>(WorkerPool::Configuration{.workers = 2});
+};
+
+/**
+ * @given a valid vote
+ * @when it is verified twice in the same round and once in another round
+ * @then its signature is checked once per round
+ */
+TEST_F(VoteCryptoProviderTest, VerifiesVoteOncePerRound) {
+  auto vote = makeVote(1, 10);
+  EXPECT_CALL(*ed_provider_, verify(vote.signature, _, vote.id))
+      .Times(2)
+      .WillRepeatedly(Return(true));
+
+  auto provider = makeProvider(1);
+  ASSERT_TRUE(provider->verifyPrevote(vote));
+  ASSERT_TRUE(provider->verifyPrevote(vote));
+  ASSERT_TRUE(makeProvider(2)->verifyPrevote(vote));
+}
+
+/**
+ * @given a vote with an invalid signature
+ * @when it is verified twice
+ * @then it is rejected both times and not remembered as verified
+ */
+TEST_F(VoteCryptoProviderTest, DoesNotRememberInvalidVote) {
+  auto vote = makeVote(1, 10);
+  EXPECT_CALL(*ed_provider_, verify(vote.signature, _, vote.id))
+      .Times(2)
+      .WillRepeatedly(Return(false));
+
+  auto provider = makeProvider(1);
+  ASSERT_FALSE(provider->verifyPrevote(vote));
+  ASSERT_FALSE(provider->verifyPrevote(vote));
+  ASSERT_EQ(verified_votes_->size(), 0);
+}
+
+/**
+ * @given votes of many voters, one of which has an invalid signature
+ * @when they are preverified and then verified one by one
+ * @then each signature is checked once, except of the invalid one, and only
+ * the invalid vote is rejected
+ */
+TEST_F(VoteCryptoProviderTest, PreverifiesVotes) {
+  std::vector<SignedMessage> votes;
+  for (uint8_t voter = 1; voter <= 100; ++voter) {
+    votes.emplace_back(makeVote(voter, 10));
+  }
+  auto &invalid = votes[42];
+  EXPECT_CALL(*ed_provider_, verify(_, _, _))
+      .Times(votes.size() - 1)
+      .WillRepeatedly(Return(true));
+  EXPECT_CALL(*ed_provider_, verify(invalid.signature, _, invalid.id))
+      .Times(2)
+      .WillRepeatedly(Return(false));
+
+  auto provider = makeProvider(1);
+  provider->preverify(votes);
+  ASSERT_EQ(verified_votes_->size(), votes.size() - 1);
+  for (auto &vote : votes) {
+    ASSERT_EQ(provider->verifyPrevote(vote), &vote != &invalid);
+  }
+  ASSERT_FALSE(provider->verifyPrecommit(votes[0]));
+}
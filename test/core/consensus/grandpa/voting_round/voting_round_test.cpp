@@ -101,6 +101,9 @@ class VotingRoundTest : public testing::Test,
         .WillRepeatedly(onVerify(this));
     EXPECT_CALL(*vote_crypto_provider_, verifyPrecommit(Truly(is_known_id)))
         .WillRepeatedly(onVerify(this));
+    EXPECT_CALL(*vote_crypto_provider_, preverify(_)).Times(AnyNumber());
+    EXPECT_CALL(*vote_crypto_provider_, preverifyPrecommits(_))
+        .Times(AnyNumber());
 
     EXPECT_CALL(*vote_crypto_provider_, signPrimaryPropose(_))
         .WillRepeatedly(onSignPrimaryPropose(this));
@@ -31,6 +31,7 @@
 using namespace kagome::host_api;
 using kagome::common::Blob;
 using kagome::common::Buffer;
+using kagome::common::WorkerPool;
 using kagome::crypto::Bip39Provider;
 using kagome::crypto::Bip39ProviderImpl;
 using kagome::crypto::BoostRandomGenerator;
@@ -121,6 +122,8 @@ class CryptoExtensionTest : public ::testing::Test {
         std::make_shared<Pbkdf2ProviderImpl>());
 
     crypto_store_ = std::make_shared<CryptoStoreMock>();
+    worker_pool_ =
+        std::make_shared<WorkerPool>(WorkerPool::Configuration{.workers = 2});
     crypto_ext_ = std::make_shared<CryptoExtension>(memory_provider_,
                                                     sr25519_provider_,
                                                     ecdsa_provider_,
@@ -128,7 +131,8 @@ class CryptoExtensionTest : public ::testing::Test {
                                                     secp256k1_provider_,
                                                     hasher_,
                                                     crypto_store_,
-                                                    bip39_provider_);
+                                                    bip39_provider_,
+                                                    worker_pool_);
 
     EXPECT_OUTCOME_TRUE(seed_tmp,
                         kagome::common::Blob<32>::fromHexWithPrefix(seed_hex));
@@ -218,6 +222,7 @@ class CryptoExtensionTest : public ::testing::Test {
   std::shared_ptr<CryptoStoreMock> crypto_store_;
   std::shared_ptr<CryptoExtension> crypto_ext_;
   std::shared_ptr<Bip39Provider> bip39_provider_;
+  std::shared_ptr<WorkerPool> worker_pool_;
 
   inline static Buffer input{"6920616d2064617461"_unhex};
 
@@ -481,36 +486,94 @@ TEST_F(CryptoExtensionTest, Sr25519VerifyFailure) {
  * @when trying to finish batch
  * @then exception is thrown
  */
-// TODO (kamilsa) 05.07.21 https://github.com/soramitsu/kagome/issues/804
-// TEST_F(CryptoExtensionTest, VerificationBatching_FinishWithoutStart) {
-//}
+TEST_F(CryptoExtensionTest, VerificationBatching_FinishWithoutStart) {
+  ASSERT_THROW(crypto_ext_->ext_crypto_finish_batch_verify_version_1(),
+               std::runtime_error);
+}
 
 /**
  * @given initialized crypto extension without started batch
  * @when trying to start batch twice
  * @then exception is thrown at second call
  */
-// TODO (kamilsa) 05.07.21 https://github.com/soramitsu/kagome/issues/804
-// TEST_F(CryptoExtensionTest, VerificationBatching_StartAgainWithoutFinish) {
-//}
+TEST_F(CryptoExtensionTest, VerificationBatching_StartAgainWithoutFinish) {
+  crypto_ext_->ext_crypto_start_batch_verify_version_1();
+  ASSERT_THROW(crypto_ext_->ext_crypto_start_batch_verify_version_1(),
+               std::runtime_error);
+}
 
 /**
  * @given initialized crypto extension without started batch
  * @when start batch, check valid signature, and finish batch
  * @then verification returns positive, batch result is positive too
  */
-// TODO (kamilsa) 05.07.21 https://github.com/soramitsu/kagome/issues/804
-// TEST_F(CryptoExtensionTest, VerificationBatching_NormalOrderAndSuccess) {
-//}
+TEST_F(CryptoExtensionTest, VerificationBatching_NormalOrderAndSuccess) {
+  auto pub_key = gsl::span<uint8_t>(sr25519_keypair.public_key);
+  WasmPointer input_data = 0;
+  WasmSize input_size = input.size();
+  WasmPointer sig_data_ptr = 42;
+  WasmPointer pub_key_data_ptr = 123;
+
+  EXPECT_CALL(*memory_, loadN(input_data, input_size))
+      .Times(2)
+      .WillRepeatedly(Return(input));
+  EXPECT_CALL(*memory_, loadN(pub_key_data_ptr, sr25519_constants::PUBLIC_SIZE))
+      .Times(2)
+      .WillRepeatedly(Return(Buffer(pub_key)));
+  EXPECT_CALL(*memory_, loadN(sig_data_ptr, sr25519_constants::SIGNATURE_SIZE))
+      .Times(2)
+      .WillRepeatedly(Return(Buffer(sr25519_signature)));
+
+  crypto_ext_->ext_crypto_start_batch_verify_version_1();
+  for (auto i = 0; i < 2; ++i) {
+    ASSERT_EQ(
+        crypto_ext_->ext_crypto_sr25519_verify_version_2(
+            PtrSize{sig_data_ptr, sr25519_constants::SIGNATURE_SIZE}.combine(),
+            PtrSize{input_data, input_size}.combine(),
+            pub_key_data_ptr),
+        CryptoExtension::kVerifySuccess);
+  }
+  ASSERT_EQ(crypto_ext_->ext_crypto_finish_batch_verify_version_1(),
+            CryptoExtension::kVerifyBatchSuccess);
+}
 
 /**
  * @given initialized crypto extension without started batch
  * @when start batch, check valid signature, and finish batch
  * @then verification returns positive, but batch returns negative result
  */
-// TODO (kamilsa) 05.07.21 https://github.com/soramitsu/kagome/issues/804
-// TEST_F(CryptoExtensionTest, VerificationBatching_NormalOrderAndInvalid) {
-//}
+TEST_F(CryptoExtensionTest, VerificationBatching_NormalOrderAndInvalid) {
+  auto pub_key = gsl::span<uint8_t>(sr25519_keypair.public_key);
+  auto false_signature = Buffer(sr25519_signature);
+  ++false_signature[0];
+
+  WasmPointer input_data = 0;
+  WasmSize input_size = input.size();
+  WasmPointer sig_data_ptr = 42;
+  WasmPointer pub_key_data_ptr = 123;
+
+  EXPECT_CALL(*memory_, loadN(input_data, input_size))
+      .Times(2)
+      .WillRepeatedly(Return(input));
+  EXPECT_CALL(*memory_, loadN(pub_key_data_ptr, sr25519_constants::PUBLIC_SIZE))
+      .Times(2)
+      .WillRepeatedly(Return(Buffer(pub_key)));
+  EXPECT_CALL(*memory_, loadN(sig_data_ptr, sr25519_constants::SIGNATURE_SIZE))
+      .WillOnce(Return(Buffer(sr25519_signature)))
+      .WillOnce(Return(false_signature));
+
+  crypto_ext_->ext_crypto_start_batch_verify_version_1();
+  for (auto i = 0; i < 2; ++i) {
+    ASSERT_EQ(
+        crypto_ext_->ext_crypto_sr25519_verify_version_2(
+            PtrSize{sig_data_ptr, sr25519_constants::SIGNATURE_SIZE}.combine(),
+            PtrSize{input_data, input_size}.combine(),
+            pub_key_data_ptr),
+        CryptoExtension::kVerifySuccess);
+  }
+  ASSERT_EQ(crypto_ext_->ext_crypto_finish_batch_verify_version_1(),
+            CryptoExtension::kVerifyBatchFail);
+}
 
 /**
  * @given initialized crypto extensions @and some bytes
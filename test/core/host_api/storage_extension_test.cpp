@@ -667,7 +667,7 @@ TEST_F(StorageExtensionTest, RootTest) {
   WasmSize root_size = Hash256::size();
   RootHash root_val = "123456"_hash256;
   WasmSpan root_span = PtrSize(root_pointer, root_size).combine();
-  EXPECT_CALL(*trie_batch_, commit())
+  EXPECT_CALL(*trie_batch_, hash())
       .WillOnce(Return(outcome::success(root_val)));
   EXPECT_CALL(*memory_, storeBuffer(gsl::span<const uint8_t>(root_val)))
       .WillOnce(Return(root_span));
@@ -0,0 +1,81 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "network/impl/stream_engine.hpp"
+
+#include <gtest/gtest.h>
+
+#include "mock/core/network/protocol_base_mock.hpp"
+#include "mock/libp2p/connection/stream_mock.hpp"
+#include "testutil/literals.hpp"
+#include "testutil/outcome.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+using kagome::network::ProtocolBaseMock;
+using kagome::network::StreamEngine;
+using libp2p::connection::StreamMock;
+using libp2p::peer::PeerId;
+
+using testing::_;
+using testing::Invoke;
+using testing::Return;
+using testing::ReturnRef;
+
+class StreamEngineTest : public testing::Test {
+ public:
+  static void SetUpTestCase() {
+    testutil::prepareLoggers();
+  }
+
+  void SetUp() override {
+    protocol_ = std::make_shared<ProtocolBaseMock>();
+    EXPECT_CALL(*protocol_, protocol())
+        .WillRepeatedly(ReturnRef(protocol_name_));
+    engine_ = StreamEngine::create();
+  }
+
+  std::shared_ptr<StreamMock> addOutgoingStream(const PeerId &peer_id) {
+    auto stream = std::make_shared<StreamMock>();
+    EXPECT_CALL(*stream, remotePeerId()).WillRepeatedly(Return(peer_id));
+    EXPECT_CALL(*stream, isClosed()).WillRepeatedly(Return(false));
+    EXPECT_OUTCOME_TRUE_1(engine_->addOutgoing(stream, protocol_));
+    return stream;
+  }
+
+ protected:
+  libp2p::peer::Protocol protocol_name_{"/test/1"};
+  std::shared_ptr<ProtocolBaseMock> protocol_;
+  std::shared_ptr<StreamEngine> engine_;
+};
+
+/**
+ * @given stream engine with outgoing streams to several peers
+ * @when a message is broadcast
+ * @then the same bytes of the length-prefixed SCALE-encoded message are
+ * written to each of the streams
+ */
+TEST_F(StreamEngineTest, BroadcastEncodesOnce) {
+  auto msg = std::make_shared<std::string>("message");
+  auto encoded = scale::encode(*msg).value();
+  std::vector<uint8_t> expected{static_cast<uint8_t>(encoded.size())};
+  expected.insert(expected.end(), encoded.begin(), encoded.end());
+
+  std::vector<const uint8_t *> written;
+  for (const auto &peer_id : {"peer_a"_peerid, "peer_b"_peerid}) {
+    auto stream = addOutgoingStream(peer_id);
+    EXPECT_CALL(*stream, write(_, expected.size(), _))
+        .WillOnce(Invoke([&](auto bytes, auto size, auto cb) {
+          EXPECT_EQ(std::vector<uint8_t>(bytes.begin(), bytes.end()),
+                    expected);
+          written.push_back(bytes.data());
+          cb(size);
+        }));
+  }
+
+  engine_->broadcast(protocol_, msg);
+
+  ASSERT_EQ(written.size(), 2);
+  ASSERT_EQ(written[0], written[1]);
+}
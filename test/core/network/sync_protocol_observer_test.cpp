@@ -75,15 +75,19 @@ TEST_F(SynchronizerTest, ProcessRequest) {
                                  Direction::ASCENDING,
                                  std::nullopt};
 
+  EXPECT_CALL(*tree_, deepestLeaf())
+      .WillOnce(Return(BlockInfo{4, block4_hash_}));
   EXPECT_CALL(*tree_,
-              getBestChainFromBlock(
-                  block3_hash_, AppConfiguration::kAbsolutMaxBlocksInResponse))
-      .WillOnce(Return(std::vector<BlockHash>{block3_hash_, block4_hash_}));
-
-  EXPECT_CALL(*headers_, getBlockHeader(BlockId{block3_hash_}))
-      .WillOnce(Return(block3_.header));
-  EXPECT_CALL(*headers_, getBlockHeader(BlockId{block4_hash_}))
-      .WillOnce(Return(block4_.header));
+              forEachBlockInChain(block3_hash_,
+                                  block4_hash_,
+                                  BlockTree::GetChainDirection::ASCEND,
+                                  _))
+      .WillOnce(testing::Invoke([this](auto &, auto &, auto, auto &visitor)
+                                    -> outcome::result<void> {
+        OUTCOME_TRY(visitor({3, block3_hash_}, block3_.header));
+        OUTCOME_TRY(visitor({4, block4_hash_}, block4_.header));
+        return outcome::success();
+      }));
 
   EXPECT_CALL(*tree_, getBlockBody(BlockId{block3_hash_}))
       .WillOnce(Return(block3_.body));
@@ -0,0 +1,177 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "offchain/impl/offchain_worker_impl.hpp"
+
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "crypto/random_generator/boost_generator.hpp"
+#include "mock/core/api/service/author/author_api_mock.hpp"
+#include "mock/core/application/app_configuration_mock.hpp"
+#include "mock/core/blockchain/block_header_repository_mock.hpp"
+#include "mock/core/clock/clock_mock.hpp"
+#include "mock/core/crypto/hasher_mock.hpp"
+#include "mock/core/offchain/offchain_persistent_storage_mock.hpp"
+#include "mock/core/offchain/offchain_worker_pool_mock.hpp"
+#include "mock/core/runtime/module_repository_mock.hpp"
+#include "mock/core/runtime/runtime_environment_factory_mock.hpp"
+#include "mock/core/runtime/wasm_provider_mock.hpp"
+#include "runtime/executor.hpp"
+#include "storage/in_memory/in_memory_storage.hpp"
+#include "testutil/literals.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+using kagome::api::AuthorApiMock;
+using kagome::application::AppConfigurationMock;
+using kagome::blockchain::BlockHeaderRepositoryMock;
+using kagome::clock::SystemClock;
+using kagome::clock::SystemClockMock;
+using kagome::crypto::BoostRandomGenerator;
+using kagome::crypto::HasherMock;
+using kagome::network::OwnPeerInfo;
+using kagome::offchain::DeadlineHasReached;
+using kagome::offchain::HttpMethod;
+using kagome::offchain::OffchainPersistentStorageMock;
+using kagome::offchain::OffchainWorkerImpl;
+using kagome::offchain::OffchainWorkerPoolMock;
+using kagome::offchain::Timestamp;
+using kagome::primitives::BlockHeader;
+using kagome::runtime::Executor;
+using kagome::runtime::ModuleRepositoryMock;
+using kagome::runtime::RuntimeEnvironmentFactoryMock;
+using kagome::runtime::WasmProviderMock;
+using kagome::storage::InMemoryStorage;
+using testing::Invoke;
+using testing::NiceMock;
+
+class OffchainWorkerImplTest : public testing::Test {
+ public:
+  static void SetUpTestCase() {
+    testutil::prepareLoggers();
+  }
+
+  /**
+   * Makes the worker, which clock is \arg shift ahead of the real one
+   */
+  std::shared_ptr<OffchainWorkerImpl> makeWorker(
+      SystemClock::Duration shift = {}) {
+    EXPECT_CALL(*clock_, now()).WillRepeatedly(Invoke([shift] {
+      return std::chrono::system_clock::now() + shift;
+    }));
+    auto env_factory = std::make_shared<RuntimeEnvironmentFactoryMock>(
+        std::make_shared<WasmProviderMock>(),
+        std::make_shared<ModuleRepositoryMock>(),
+        std::make_shared<BlockHeaderRepositoryMock>());
+    return std::make_shared<OffchainWorkerImpl>(
+        app_config_,
+        clock_,
+        std::make_shared<NiceMock<HasherMock>>(),
+        std::make_shared<InMemoryStorage>(),
+        std::make_shared<BoostRandomGenerator>(),
+        std::make_shared<AuthorApiMock>(),
+        peer_info_,
+        std::make_shared<OffchainPersistentStorageMock>(),
+        std::make_shared<Executor>(env_factory),
+        BlockHeader{},
+        std::make_shared<OffchainWorkerPoolMock>());
+  }
+
+  /**
+   * Runs \arg call and @returns its duration
+   */
+  template <typename F>
+  static std::chrono::milliseconds measure(F &&call) {
+    auto start = std::chrono::steady_clock::now();
+    std::forward<F>(call)();
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start);
+  }
+
+  // far beyond the end of the run of the worker
+  static constexpr Timestamp kHour = 3600 * 1000;
+  static constexpr auto kLongTime = std::chrono::seconds(10);
+
+  AppConfigurationMock app_config_;
+  std::shared_ptr<SystemClockMock> clock_ =
+      std::make_shared<SystemClockMock>();
+  OwnPeerInfo peer_info_{"peer"_peerid, {}, {}};
+};
+
+/**
+ * @given a worker, which run is about to exceed its time limit
+ * @when it falls asleep till a deadline beyond the limit
+ * @then it wakes up at the end of the run rather than at the deadline
+ */
+TEST_F(OffchainWorkerImplTest, SleepIsLimitedByRunTimeout) {
+  auto worker = makeWorker(std::chrono::milliseconds(100)
+                           - OffchainWorkerImpl::kRunTimeout);
+
+  auto duration =
+      measure([&] { worker->sleepUntil(worker->timestamp() + kHour); });
+
+  EXPECT_LT(duration, kLongTime);
+}
+
+/**
+ * @given a just started worker
+ * @when it falls asleep till a deadline before the end of the run
+ * @then it wakes up at the deadline
+ */
+TEST_F(OffchainWorkerImplTest, SleepBeforeRunTimeoutIsKept) {
+  auto worker = makeWorker();
+
+  auto duration =
+      measure([&] { worker->sleepUntil(worker->timestamp() + 100); });
+
+  // the deadline is quantized with milliseconds
+  EXPECT_GE(duration, std::chrono::milliseconds(99));
+  EXPECT_LT(duration, kLongTime);
+}
+
+/**
+ * @given a sleeping worker
+ * @when it is stopped
+ * @then it wakes up before the end of the run
+ */
+TEST_F(OffchainWorkerImplTest, StopInterruptsSleep) {
+  auto worker = makeWorker();
+
+  std::thread stopper([&] {
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    worker->stop();
+  });
+  auto duration =
+      measure([&] { worker->sleepUntil(worker->timestamp() + kHour); });
+  stopper.join();
+
+  EXPECT_LT(duration, kLongTime);
+}
+
+/**
+ * @given a worker waiting for the response to an HTTP request
+ * @when it is stopped
+ * @then the waiting is finished before the end of the run, the request is
+ * reported as timed out
+ */
+TEST_F(OffchainWorkerImplTest, StopInterruptsResponseWait) {
+  auto worker = makeWorker();
+  auto id = worker->httpRequestStart(HttpMethod::Get, "http://node/path", {});
+  ASSERT_TRUE(id.isSuccess());
+
+  std::thread stopper([&] {
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    worker->stop();
+  });
+  std::vector<kagome::offchain::HttpStatus> statuses;
+  auto duration = measure(
+      [&] { statuses = worker->httpResponseWait({id.value()}, std::nullopt); });
+  stopper.join();
+
+  EXPECT_LT(duration, kLongTime);
+  EXPECT_EQ(statuses,
+            std::vector<kagome::offchain::HttpStatus>{DeadlineHasReached});
+}
@@ -62,10 +62,10 @@ TEST_F(BlockBuilderApiTest, CheckInherents) {
  * were valid
  */
 TEST_F(BlockBuilderApiTest, ApplyExtrinsic) {
-  preparePersistentStorageExpects();
+  auto batch = preparePersistentBatch();
   createBlock("block_hash_43"_hash256, 43);
   EXPECT_OUTCOME_FALSE_1(builder_->apply_extrinsic(BlockInfo{43, "block_hash_43"_hash256},
-                                "state_root"_hash256,
+                                batch,
                                 Extrinsic{Buffer{1, 2, 3}}));
 }
 
@@ -85,11 +85,11 @@ TEST_F(BlockBuilderApiTest, DISABLED_RandomSeed){
  * were valid
  */
 TEST_F(BlockBuilderApiTest, InherentExtrinsics) {
-  prepareEphemeralStorageExpects();
+  auto batch = preparePersistentBatch();
   createBlock("block_hash_44"_hash256, 44);
   EXPECT_OUTCOME_FALSE_1(
       builder_->inherent_extrinsics(BlockInfo{44, "block_hash_44"_hash256},
-                                    "state_root"_hash256,
+                                    batch,
                                     InherentData{}))
 }
 
@@ -100,8 +100,8 @@ TEST_F(BlockBuilderApiTest, InherentExtrinsics) {
  * were valid
  */
 TEST_F(BlockBuilderApiTest, DISABLED_FinalizeBlock) {
-  preparePersistentStorageExpects();
+  auto batch = preparePersistentBatch();
   createBlock("block_hash"_hash256, 42);
-  EXPECT_OUTCOME_FALSE_1(builder_->finalize_block(
-      BlockInfo{42, "block_hash"_hash256}, "state_root"_hash256))
+  EXPECT_OUTCOME_FALSE_1(
+      builder_->finalize_block(BlockInfo{42, "block_hash"_hash256}, batch))
 }
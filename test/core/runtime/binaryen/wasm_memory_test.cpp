@@ -33,7 +33,9 @@ class BinaryenMemoryHeapTest : public ::testing::Test {
     auto allocator = std::make_unique<MemoryAllocator>(
         MemoryAllocator::MemoryHandle{
             [this](auto size) { return memory_->resize(size); },
-            [this] { return memory_->size(); }},
+            [this] { return memory_->size(); },
+            [this](auto addr) { return memory_->load32u(addr); },
+            [this](auto addr, auto value) { memory_->store32(addr, value); }},
         kInitialMemorySize, kDefaultHeapBase);
     allocator_ = allocator.get();
     memory_ = std::make_unique<MemoryImpl>(
@@ -198,6 +200,35 @@ TEST_F(BinaryenMemoryHeapTest, AllocateTooBigMemoryAfterDeallocate) {
   ASSERT_EQ(ptr3, runtime::roundUpAlign(mem_offset));
 }
 
+/**
+ * @given full memory with a deallocated memory chunk
+ * @when allocate memory chunk of size less than the deallocated one
+ * @then it is allocated at the beginning of the deallocated chunk @and the
+ * rest of the deallocated chunk remains available
+ */
+TEST_F(BinaryenMemoryHeapTest, AllocateInsideDeallocatedChunk) {
+  auto available_memory_size = kInitialMemorySize - kDefaultHeapBase;
+  const size_t size1 = available_memory_size / 2;
+  const size_t size2 = available_memory_size - size1;
+  const size_t size3 = size1 / 4 + 1;
+
+  // fill memory
+  auto ptr1 = memory_->allocate(size1);
+  memory_->allocate(size2);
+
+  memory_->deallocate(ptr1);
+  auto ptr3 = memory_->allocate(size3);
+  ASSERT_EQ(ptr3, ptr1);
+
+  const auto aligned_size1 = runtime::roundUpAlign(size1);
+  const auto aligned_size3 = runtime::roundUpAlign(size3);
+  auto opt_size = allocator_->getDeallocatedChunkSize(ptr3 + aligned_size3);
+  ASSERT_TRUE(opt_size.has_value());
+  EXPECT_EQ(opt_size.value(), aligned_size1 - aligned_size3);
+  EXPECT_EQ(allocator_->getDeallocatedChunksNum(), 1);
+  EXPECT_EQ(allocator_->getAllocatedChunksNum(), 2);
+}
+
 /**
  * @given full memory with different sized memory chunks
  * @when deallocate chunks in various ways: in order, reversed, single chunk
@@ -261,6 +292,25 @@ TEST_F(BinaryenMemoryHeapTest, CombineDeallocatedChunks) {
   EXPECT_TRUE(allocator_->getAllocatedChunkSize(ptr7));
 }
 
+/**
+ * @given a deallocated chunk, which header is overwritten by the runtime
+ * @when its neighbor chunk is deallocated
+ * @then the call fails instead of merging with the corrupted chunk, the state
+ * of the allocator is kept
+ */
+TEST_F(BinaryenMemoryHeapTest, DeallocateNextToCorruptedChunkFails) {
+  auto ptr1 = memory_->allocate(1);
+  auto ptr2 = memory_->allocate(1);
+  memory_->allocate(1);
+  memory_->deallocate(ptr1);
+
+  memory_->store32(ptr1, 0);
+
+  EXPECT_THROW(memory_->deallocate(ptr2), std::runtime_error);
+  EXPECT_EQ(allocator_->getDeallocatedChunksNum(), 1);
+  EXPECT_TRUE(allocator_->getAllocatedChunkSize(ptr2));
+}
+
 /**
  * @given arbitrary buffer of size N
  * @when this buffer is stored in memory heap @and then load of N bytes is done
@@ -278,3 +328,33 @@ TEST_F(BinaryenMemoryHeapTest, LoadNTest) {
   auto res_b = memory_->loadN(ptr, N);
   ASSERT_EQ(b, res_b);
 }
+
+/**
+ * @given buffers stored in memory heap
+ * @when views of all of them are taken at once
+ * @then each view holds the bytes of its buffer
+ */
+TEST_F(BinaryenMemoryHeapTest, ViewTest) {
+  std::vector<kagome::common::Buffer> buffers;
+  std::vector<gsl::span<const uint8_t>> views;
+  for (uint8_t i = 0; i < MemoryImpl::kViewBuffers; ++i) {
+    auto &b = buffers.emplace_back(kagome::common::Buffer{i, i, i});
+    auto ptr = memory_->allocate(b.size());
+    memory_->storeBuffer(ptr, b);
+    views.push_back(memory_->view(ptr, b.size()));
+  }
+
+  for (size_t i = 0; i < buffers.size(); ++i) {
+    ASSERT_EQ(kagome::common::BufferView{views[i]}, buffers[i]);
+  }
+}
+
+/**
+ * @given memory of some size
+ * @when a view exceeding the memory bounds is taken
+ * @then the access traps
+ */
+TEST_F(BinaryenMemoryHeapTest, ViewOutOfBoundsTraps) {
+  EXPECT_THROW(memory_->view(memory_->size() - 1, 2), wasm::TrapException);
+  EXPECT_NO_THROW(memory_->view(memory_->size() - 2, 2));
+}
@@ -238,3 +238,87 @@ TEST_F(ExecutorTest, LatestStateSwitchesCorrectly) {
                           block_info2, "state_hash5"_hash256, "addTwo", 7, 10));
   ASSERT_EQ(res6, 17);
 }
+
+/**
+ * @given an executor and a persistent batch
+ * @when a method is called on the batch twice, keeping the changes of a
+ * succeeded call, and the second call fails
+ * @then the changes of the first call are committed to the batch, while the
+ * changes of the second one are rolled back, and the batch is never committed
+ * to the storage
+ */
+TEST_F(ExecutorTest, CallOnBatchKeepsChangesOfSucceededCalls) {
+  Executor executor{env_factory_};
+  kagome::primitives::BlockInfo block_info{42, "block_hash"_hash256};
+  auto batch_mock = std::make_shared<PersistentTrieBatchMock>();
+  EXPECT_CALL(*batch_mock, commit()).Times(0);
+  std::shared_ptr<PersistentTrieBatch> batch = batch_mock;
+  const PtrSize RESULT_LOCATION{3, 4};
+
+  auto module_instance = std::make_shared<ModuleInstanceMock>();
+  EXPECT_CALL(*module_instance,
+              callExportFunction(std::string_view{"addTwo"}, _))
+      .WillOnce(Return(RESULT_LOCATION))
+      .WillOnce(Return(outcome::failure(boost::system::error_code{})));
+  EXPECT_CALL(*module_instance, resetEnvironment())
+      .WillOnce(Return(outcome::success()));
+  EXPECT_CALL(*memory_, loadN(RESULT_LOCATION.ptr, RESULT_LOCATION.size))
+      .WillOnce(Return(Buffer{scale::encode(5).value()}));
+  auto memory_provider = std::make_shared<MemoryProviderMock>();
+  EXPECT_CALL(*memory_provider, getCurrentMemory())
+      .WillRepeatedly(Return(
+          std::optional<std::reference_wrapper<kagome::runtime::Memory>>(
+              *memory_)));
+
+  auto storage_provider = std::make_shared<TrieStorageProviderMock>();
+  {
+    testing::InSequence s;
+    EXPECT_CALL(*storage_provider, startTransaction())
+        .WillOnce(Return(outcome::success()));
+    EXPECT_CALL(*storage_provider, commitTransaction())
+        .WillOnce(Return(outcome::success()));
+    EXPECT_CALL(*storage_provider, startTransaction())
+        .WillOnce(Return(outcome::success()));
+    EXPECT_CALL(*storage_provider, rollbackTransaction())
+        .WillOnce(Return(outcome::success()));
+  }
+
+  EXPECT_CALL(*env_factory_, start(block_info, batch))
+      .Times(2)
+      .WillRepeatedly(Invoke(
+          [&,
+           weak_env_factory =
+               std::weak_ptr<kagome::runtime::RuntimeEnvironmentFactoryMock>{
+                   env_factory_}](auto &blockchain_state, auto) {
+            auto env_template =
+                std::make_unique<RuntimeEnvironmentTemplateMock>(
+                    weak_env_factory,
+                    blockchain_state,
+                    kagome::storage::trie::RootHash{});
+            EXPECT_CALL(*env_template, make()).WillOnce(Invoke([&] {
+              return std::make_unique<RuntimeEnvironment>(
+                  module_instance,
+                  memory_provider,
+                  storage_provider,
+                  block_info);
+            }));
+            return env_template;
+          }));
+
+  EXPECT_OUTCOME_TRUE(res,
+                      executor.callOnBatch<int>(
+                          block_info,
+                          batch,
+                          Executor::BatchChanges::KEEP_IF_SUCCEEDED,
+                          "addTwo",
+                          2,
+                          3));
+  ASSERT_EQ(res, 5);
+  ASSERT_FALSE(executor.callOnBatch<int>(
+      block_info,
+      batch,
+      Executor::BatchChanges::KEEP_IF_SUCCEEDED,
+      "addTwo",
+      7,
+      10));
+}
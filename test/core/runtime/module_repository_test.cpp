@@ -0,0 +1,113 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "runtime/common/module_repository_impl.hpp"
+
+#include <gtest/gtest.h>
+
+#include "mock/core/runtime/module_factory_mock.hpp"
+#include "mock/core/runtime/module_instance_mock.hpp"
+#include "mock/core/runtime/runtime_upgrade_tracker_mock.hpp"
+#include "runtime/common/constant_code_provider.hpp"
+#include "runtime/module.hpp"
+#include "testutil/literals.hpp"
+#include "testutil/outcome.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+using kagome::common::Buffer;
+using kagome::primitives::BlockHeader;
+using kagome::primitives::BlockInfo;
+using kagome::runtime::ConstantCodeProvider;
+using kagome::runtime::Module;
+using kagome::runtime::ModuleFactoryMock;
+using kagome::runtime::ModuleInstanceMock;
+using kagome::runtime::ModuleMock;
+using kagome::runtime::ModuleRepositoryImpl;
+using kagome::runtime::RuntimeUpgradeTrackerMock;
+using kagome::runtime::SingleModuleCache;
+using testing::_;
+using testing::Invoke;
+using testing::Return;
+
+class ModuleRepositoryTest : public testing::Test {
+ public:
+  static void SetUpTestCase() {
+    testutil::prepareLoggers();
+  }
+
+  void SetUp() override {
+    repo_ = std::make_unique<ModuleRepositoryImpl>(
+        upgrade_tracker_,
+        module_factory_,
+        std::make_shared<SingleModuleCache>());
+    EXPECT_CALL(*upgrade_tracker_, getLastCodeUpdateState(block_))
+        .WillRepeatedly(Return(state_));
+  }
+
+  /**
+   * @returns a function making a module which instantiates to instance_
+   */
+  auto makeModule() {
+    return [this](gsl::span<const uint8_t> code)
+               -> outcome::result<std::unique_ptr<Module>> {
+      EXPECT_EQ(Buffer{code}, code_);
+      auto module = std::make_unique<ModuleMock>();
+      EXPECT_CALL(*module, instantiate()).WillOnce(Return(instance_));
+      return module;
+    };
+  }
+
+ protected:
+  std::shared_ptr<RuntimeUpgradeTrackerMock> upgrade_tracker_ =
+      std::make_shared<RuntimeUpgradeTrackerMock>();
+  std::shared_ptr<ModuleFactoryMock> module_factory_ =
+      std::make_shared<ModuleFactoryMock>();
+  std::shared_ptr<ModuleInstanceMock> instance_ =
+      std::make_shared<ModuleInstanceMock>();
+  std::unique_ptr<ModuleRepositoryImpl> repo_;
+
+  Buffer code_{"runtime code"_buf};
+  std::shared_ptr<ConstantCodeProvider> code_provider_ =
+      std::make_shared<ConstantCodeProvider>(code_);
+  kagome::storage::trie::RootHash state_ = "upgrade_state"_hash256;
+  BlockInfo block_{42, "block_hash"_hash256};
+};
+
+/**
+ * @given a runtime upgrade compiled in background
+ * @when an instance of the upgraded runtime is requested
+ * @then the precompiled module is instantiated without compiling it again
+ */
+TEST_F(ModuleRepositoryTest, UsesPrecompiledModule) {
+  EXPECT_CALL(*module_factory_, make(_)).WillOnce(Invoke(makeModule()));
+  repo_->precompileAt(code_provider_, state_);
+  // repeated upgrade notifications do not trigger a new compilation
+  repo_->precompileAt(code_provider_, state_);
+
+  EXPECT_CALL(*instance_, borrow(_));
+  EXPECT_OUTCOME_TRUE(
+      instance, repo_->getInstanceAt(code_provider_, block_, BlockHeader{}));
+  ASSERT_EQ(instance, instance_);
+}
+
+/**
+ * @given a runtime upgrade which failed to compile in background
+ * @when an instance of the upgraded runtime is requested
+ * @then the runtime is compiled on demand
+ */
+TEST_F(ModuleRepositoryTest, CompilesOnDemandAfterFailedPrecompilation) {
+  EXPECT_CALL(*module_factory_, make(_))
+      .WillOnce(Invoke([](gsl::span<const uint8_t>)
+                           -> outcome::result<std::unique_ptr<Module>> {
+        return std::make_error_code(std::errc::not_enough_memory);
+      }))
+      .WillOnce(Invoke(makeModule()));
+  repo_->precompileAt(code_provider_, state_);
+
+  EXPECT_CALL(*instance_, borrow(_));
+  EXPECT_OUTCOME_TRUE(
+      instance, repo_->getInstanceAt(code_provider_, block_, BlockHeader{}));
+  ASSERT_EQ(instance, instance_);
+}
@@ -0,0 +1,182 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "runtime/runtime_api/impl/offchain_worker_api.hpp"
+
+#include <condition_variable>
+
+#include <gtest/gtest.h>
+
+#include "mock/core/application/app_configuration_mock.hpp"
+#include "mock/core/blockchain/block_header_repository_mock.hpp"
+#include "mock/core/offchain/offchain_worker_factory_mock.hpp"
+#include "mock/core/offchain/offchain_worker_mock.hpp"
+#include "mock/core/runtime/module_repository_mock.hpp"
+#include "mock/core/runtime/runtime_environment_factory_mock.hpp"
+#include "mock/core/runtime/wasm_provider_mock.hpp"
+#include "runtime/executor.hpp"
+#include "testutil/outcome.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+using kagome::application::AppConfiguration;
+using kagome::application::AppConfigurationMock;
+using kagome::blockchain::BlockHeaderRepositoryMock;
+using kagome::offchain::OffchainWorkerFactoryMock;
+using kagome::offchain::OffchainWorkerMock;
+using kagome::primitives::BlockHeader;
+using kagome::primitives::BlockNumber;
+using kagome::runtime::Executor;
+using kagome::runtime::ModuleRepositoryMock;
+using kagome::runtime::OffchainWorkerApiImpl;
+using kagome::runtime::RuntimeEnvironmentFactoryMock;
+using kagome::runtime::WasmProviderMock;
+using testing::_;
+using testing::Invoke;
+using testing::NiceMock;
+using testing::Return;
+
+class OffchainWorkerApiTest : public testing::Test {
+ public:
+  static void SetUpTestCase() {
+    testutil::prepareLoggers();
+  }
+
+  void SetUp() override {
+    EXPECT_CALL(app_config_, offchainWorkerMode())
+        .WillRepeatedly(Return(AppConfiguration::OffchainWorkerMode::Always));
+
+    // the workers of the blocks are run until they are released
+    EXPECT_CALL(*ocw_factory_, make(_, _))
+        .WillRepeatedly(Invoke([this](auto &&, const BlockHeader &header) {
+          std::lock_guard lock{mutex_};
+          made_.push_back(header.number);
+          auto worker = std::make_shared<NiceMock<OffchainWorkerMock>>();
+          ON_CALL(*worker, run()).WillByDefault(Invoke([this] {
+            std::unique_lock lock{mutex_};
+            ++running_;
+            max_running_ = std::max(max_running_, running_);
+            cv_.notify_all();
+            cv_.wait(lock, [this] { return released_; });
+            --running_;
+            ++finished_;
+            cv_.notify_all();
+            return kagome::outcome::success();
+          }));
+          ON_CALL(*worker, stop()).WillByDefault(Invoke([this] { release(); }));
+          return worker;
+        }));
+
+    auto env_factory = std::make_shared<RuntimeEnvironmentFactoryMock>(
+        std::make_shared<WasmProviderMock>(),
+        std::make_shared<ModuleRepositoryMock>(),
+        std::make_shared<BlockHeaderRepositoryMock>());
+    api_ = std::make_unique<OffchainWorkerApiImpl>(
+        app_config_, ocw_factory_, std::make_shared<Executor>(env_factory));
+  }
+
+  void TearDown() override {
+    release();
+    api_.reset();
+  }
+
+  /**
+   * Requests the worker of the block with \arg number
+   */
+  void offchainWorker(BlockNumber number) {
+    BlockHeader header;
+    header.number = number;
+    EXPECT_OUTCOME_TRUE_1(api_->offchain_worker({}, header));
+  }
+
+  /**
+   * Waits for \arg condition checked under the lock of the counters
+   * @returns the last result of the condition
+   */
+  template <typename F>
+  bool waitFor(F &&condition,
+               std::chrono::milliseconds timeout = std::chrono::seconds(10)) {
+    std::unique_lock lock{mutex_};
+    return cv_.wait_for(lock, timeout, std::forward<F>(condition));
+  }
+
+  /**
+   * Lets the running and the further workers finish
+   */
+  void release() {
+    std::lock_guard lock{mutex_};
+    released_ = true;
+    cv_.notify_all();
+  }
+
+  AppConfigurationMock app_config_;
+  std::shared_ptr<OffchainWorkerFactoryMock> ocw_factory_ =
+      std::make_shared<OffchainWorkerFactoryMock>();
+  std::unique_ptr<OffchainWorkerApiImpl> api_;
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::vector<BlockNumber> made_;
+  size_t running_ = 0;
+  size_t max_running_ = 0;
+  size_t finished_ = 0;
+  bool released_ = false;
+};
+
+/**
+ * @given all the threads busy with the workers of blocks #1 and #2
+ * @when the workers of blocks #3 and #4 are requested
+ * @then the worker of block #4 replaces the queued one of block #3, which
+ * is never run
+ */
+TEST_F(OffchainWorkerApiTest, NewerWorkerReplacesQueuedOne) {
+  static_assert(OffchainWorkerApiImpl::kWorkers == 2);
+  offchainWorker(1);
+  ASSERT_TRUE(waitFor([this] { return running_ == 1; }));
+  offchainWorker(2);
+  ASSERT_TRUE(waitFor([this] { return running_ == 2; }));
+
+  offchainWorker(3);
+  offchainWorker(4);
+  release();
+  ASSERT_TRUE(waitFor([this] { return finished_ == 3; }));
+  api_.reset();
+
+  EXPECT_EQ(made_, (std::vector<BlockNumber>{1, 2, 4}));
+}
+
+/**
+ * @given all the threads busy with workers
+ * @when one more worker is requested
+ * @then it is not run until one of the threads is free
+ */
+TEST_F(OffchainWorkerApiTest, RunsAtMostKWorkers) {
+  const auto workers = OffchainWorkerApiImpl::kWorkers;
+  for (BlockNumber number = 1; number <= workers; ++number) {
+    offchainWorker(number);
+    ASSERT_TRUE(waitFor([&] { return running_ == number; }));
+  }
+
+  offchainWorker(workers + 1);
+  EXPECT_FALSE(waitFor([&] { return running_ > workers; },
+                       std::chrono::milliseconds(100)));
+  release();
+  ASSERT_TRUE(waitFor([&] { return finished_ == workers + 1; }));
+
+  EXPECT_EQ(max_running_, workers);
+}
+
+/**
+ * @given a running worker, which does not finish by itself
+ * @when the offchain worker API is destroyed
+ * @then the worker is stopped and the destruction does not wait for it
+ */
+TEST_F(OffchainWorkerApiTest, StopsRunningWorkers) {
+  offchainWorker(1);
+  ASSERT_TRUE(waitFor([this] { return running_ == 1; }));
+
+  api_.reset();
+
+  EXPECT_EQ(finished_, 1u);
+}
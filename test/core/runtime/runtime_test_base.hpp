@@ -107,7 +107,9 @@ class RuntimeTestBase : public ::testing::Test {
         crypto_store,
         bip39_provider,
         offchain_storage_,
-        offchain_worker_pool_);
+        offchain_worker_pool_,
+        std::make_shared<common::WorkerPool>(
+            common::WorkerPool::Configuration{}));
 
     header_repo_ = std::make_shared<
         testing::NiceMock<blockchain::BlockHeaderRepositoryMock>>();
@@ -168,6 +170,16 @@ class RuntimeTestBase : public ::testing::Test {
         }));
   }
 
+  /**
+   * @return a persistent batch to make runtime calls on without committing
+   * them, as during block authoring
+   */
+  std::shared_ptr<PersistentTrieBatchMock> preparePersistentBatch() {
+    auto batch = std::make_shared<PersistentTrieBatchMock>();
+    prepareStorageBatchExpectations(*batch);
+    return batch;
+  }
+
   void prepareEphemeralStorageExpects() {
     EXPECT_CALL(*trie_storage_, getEphemeralBatchAt(_))
         .WillOnce(testing::Invoke([this](auto &root) {
@@ -0,0 +1,124 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "runtime/wavm/compiled_module_cache.hpp"
+
+#include <fstream>
+
+#include <gtest/gtest.h>
+
+#include "crypto/hasher/hasher_impl.hpp"
+#include "testutil/storage/base_fs_test.hpp"
+
+using kagome::crypto::HasherImpl;
+using kagome::runtime::wavm::CompiledModuleCache;
+
+class CompiledModuleCacheTest : public test::BaseFS_Test {
+ public:
+  CompiledModuleCacheTest()
+      : BaseFS_Test(fs::temp_directory_path() / "compiled_module_cache_test") {}
+
+  void SetUp() override {
+    BaseFS_Test::SetUp();
+    hasher_ = std::make_shared<HasherImpl>();
+  }
+
+  std::unique_ptr<CompiledModuleCache> makeCache(
+      size_t size_limit, std::string_view compiler_version = "compiler 1") {
+    return std::make_unique<CompiledModuleCache>(
+        hasher_, base_path, size_limit, compiler_version);
+  }
+
+  fs::path entryPath(const std::vector<uint8_t> &code) const {
+    return base_path / (hasher_->blake2b_256(code).toHex() + ".wavm");
+  }
+
+  void setLastUsed(const std::vector<uint8_t> &code, std::time_t time) {
+    fs::last_write_time(entryPath(code), time);
+  }
+
+ protected:
+  std::shared_ptr<HasherImpl> hasher_;
+  std::vector<uint8_t> code_a_{1, 2, 3};
+  std::vector<uint8_t> code_b_{4, 5, 6};
+  std::vector<uint8_t> code_c_{7, 8, 9};
+  std::vector<uint8_t> object_code_ = std::vector<uint8_t>(100, 42);
+};
+
+/**
+ * @given a cache with object code stored for some runtime code
+ * @when the cache is reopened and queried for that code and for another one
+ * @then the stored object code is returned for the former only
+ */
+TEST_F(CompiledModuleCacheTest, PersistsObjectCode) {
+  makeCache(1024)->put(code_a_, object_code_);
+
+  auto cache = makeCache(1024);
+  ASSERT_EQ(cache->get(code_a_), object_code_);
+  ASSERT_EQ(cache->get(code_b_), std::nullopt);
+}
+
+/**
+ * @given a cache with object code stored for some runtime code
+ * @when the entry file gets corrupted
+ * @then the entry is not returned and is removed from the disk
+ */
+TEST_F(CompiledModuleCacheTest, InvalidatesCorruptedEntries) {
+  auto cache = makeCache(1024);
+  cache->put(code_a_, object_code_);
+  {
+    std::fstream file{entryPath(code_a_).native(),
+                      std::ios::in | std::ios::out | std::ios::binary};
+    file.seekp(-1, std::ios::end);
+    file.put(0);
+  }
+
+  ASSERT_EQ(cache->get(code_a_), std::nullopt);
+  ASSERT_FALSE(fs::exists(entryPath(code_a_)));
+}
+
+/**
+ * @given a cache with object code stored by a build with another compiler
+ * @when the cache is queried for that code
+ * @then the entry is not returned and is removed from the disk
+ */
+TEST_F(CompiledModuleCacheTest, InvalidatesEntriesOfAnotherCompiler) {
+  makeCache(1024, "compiler 1")->put(code_a_, object_code_);
+
+  ASSERT_EQ(makeCache(1024, "compiler 2")->get(code_a_), std::nullopt);
+  ASSERT_FALSE(fs::exists(entryPath(code_a_)));
+}
+
+/**
+ * @given a cache which fits only two entries
+ * @when the third entry is stored in it
+ * @then the least recently used entry is evicted
+ */
+TEST_F(CompiledModuleCacheTest, EvictsLeastRecentlyUsed) {
+  auto cache = makeCache(400);
+  cache->put(code_a_, object_code_);
+  cache->put(code_b_, object_code_);
+  auto now = std::time(nullptr);
+  setLastUsed(code_a_, now - 200);
+  setLastUsed(code_b_, now - 100);
+  ASSERT_TRUE(cache->get(code_a_));
+
+  cache->put(code_c_, object_code_);
+
+  ASSERT_TRUE(cache->get(code_a_));
+  ASSERT_FALSE(cache->get(code_b_));
+  ASSERT_TRUE(cache->get(code_c_));
+}
+
+/**
+ * @given a cache with a size limit
+ * @when object code which exceeds the limit is stored
+ * @then it is not cached
+ */
+TEST_F(CompiledModuleCacheTest, SkipsTooLargeObjectCode) {
+  auto cache = makeCache(100);
+  cache->put(code_a_, object_code_);
+  ASSERT_FALSE(cache->get(code_a_));
+}
@@ -85,7 +85,7 @@ TEST_F(CoreTest, DISABLED_InitializeBlockTest) {
               onBlockExecutionStart(header.parent_hash, header.number - 1))
       .WillOnce(Return(outcome::success()));
 
-  ASSERT_TRUE(core_->initialize_block(header));
+  ASSERT_TRUE(core_->initialize_block(header, preparePersistentBatch()));
 }
 
 /**
@@ -147,7 +147,9 @@ class WasmExecutorTest : public ::testing::Test {
             crypto_store,
             bip39_provider,
             offchain_persistent_storage,
-            offchain_worker_pool);
+            offchain_worker_pool,
+            std::make_shared<kagome::common::WorkerPool>(
+                kagome::common::WorkerPool::Configuration{}));
 
     header_repo_ =
         std::make_shared<kagome::blockchain::BlockHeaderRepositoryMock>();
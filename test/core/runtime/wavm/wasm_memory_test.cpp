@@ -46,7 +46,9 @@ class WavmMemoryHeapTest : public ::testing::Test {
     auto allocator = std::make_unique<MemoryAllocator>(
         MemoryAllocator::MemoryHandle{
             [this](auto size) { return memory_->resize(size); },
-            [this] { return memory_->size(); }},
+            [this] { return memory_->size(); },
+            [this](auto addr) { return memory_->load32u(addr); },
+            [this](auto addr, auto value) { memory_->store32(addr, value); }},
         kInitialMemorySize, kDefaultHeapBase);
     allocator_ = allocator.get();
     memory_ = std::make_unique<MemoryImpl>(
@@ -206,6 +208,34 @@ TEST_F(WavmMemoryHeapTest, AllocateTooBigMemoryAfterDeallocate) {
   ASSERT_EQ(ptr3, roundUpAlign(mem_offset));
 }
 
+/**
+ * @given full memory with a deallocated memory chunk
+ * @when allocate memory chunk of size less than the deallocated one
+ * @then it is allocated at the beginning of the deallocated chunk @and the
+ * rest of the deallocated chunk remains available
+ */
+TEST_F(WavmMemoryHeapTest, AllocateInsideDeallocatedChunk) {
+  auto available_memory_size = kInitialMemorySize - kDefaultHeapBase;
+  const size_t size1 = available_memory_size / 2;
+  const size_t size2 = available_memory_size - size1;
+  const size_t size3 = size1 / 4 + 1;
+
+  // fill memory
+  auto ptr1 = memory_->allocate(size1);
+  memory_->allocate(size2);
+
+  memory_->deallocate(ptr1);
+  auto ptr3 = memory_->allocate(size3);
+  ASSERT_EQ(ptr3, ptr1);
+
+  auto opt_size =
+      allocator_->getDeallocatedChunkSize(ptr3 + roundUpAlign(size3));
+  ASSERT_TRUE(opt_size.has_value());
+  EXPECT_EQ(opt_size.value(), roundUpAlign(size1) - roundUpAlign(size3));
+  EXPECT_EQ(allocator_->getDeallocatedChunksNum(), 1);
+  EXPECT_EQ(allocator_->getAllocatedChunksNum(), 2);
+}
+
 /**
  * @given full memory with different sized memory chunks
  * @when deallocate chunks in various ways: in order, reversed, single chunk
@@ -269,6 +299,25 @@ TEST_F(WavmMemoryHeapTest, CombineDeallocatedChunks) {
   EXPECT_TRUE(allocator_->getAllocatedChunkSize(ptr7));
 }
 
+/**
+ * @given a deallocated chunk, which header is overwritten by the runtime
+ * @when its neighbor chunk is deallocated
+ * @then the call fails instead of merging with the corrupted chunk, the state
+ * of the allocator is kept
+ */
+TEST_F(WavmMemoryHeapTest, DeallocateNextToCorruptedChunkFails) {
+  auto ptr1 = memory_->allocate(1);
+  auto ptr2 = memory_->allocate(1);
+  memory_->allocate(1);
+  memory_->deallocate(ptr1);
+
+  memory_->store32(ptr1, 0);
+
+  EXPECT_THROW(memory_->deallocate(ptr2), std::runtime_error);
+  EXPECT_EQ(allocator_->getDeallocatedChunksNum(), 1);
+  EXPECT_TRUE(allocator_->getAllocatedChunkSize(ptr2));
+}
+
 /**
  * @given arbitrary buffer of size N
  * @when this buffer is stored in memory heap @and then load of N bytes is done
@@ -286,3 +335,21 @@ TEST_F(WavmMemoryHeapTest, LoadNTest) {
   auto res_b = memory_->loadN(ptr, N);
   ASSERT_EQ(b, res_b);
 }
+
+/**
+ * @given a buffer stored in memory heap
+ * @when a view of the stored bytes is taken @and the bytes are overwritten
+ * @then the view points straight into the memory and reflects the new bytes
+ */
+TEST_F(WavmMemoryHeapTest, ViewTest) {
+  kagome::common::Buffer b{1, 2, 3};
+  auto ptr = memory_->allocate(b.size());
+  memory_->storeBuffer(ptr, b);
+
+  auto view = memory_->view(ptr, b.size());
+  ASSERT_EQ(kagome::common::BufferView{view}, b);
+
+  kagome::common::Buffer other{4, 5, 6};
+  memory_->storeBuffer(ptr, other);
+  ASSERT_EQ(kagome::common::BufferView{view}, other);
+}
@@ -26,7 +26,6 @@ using kagome::common::Buffer;
 using kagome::primitives::BlockHash;
 using kagome::primitives::ExtrinsicIndex;
 using kagome::primitives::events::ChainSubscriptionEngine;
-using kagome::primitives::events::StorageSubscriptionEngine;
 using kagome::storage::InMemoryStorage;
 using kagome::storage::changes_trie::ChangesTracker;
 using kagome::storage::changes_trie::StorageChangesTrackerImpl;
@@ -55,14 +54,10 @@ TEST(ChangesTrieTest, IntegrationWithOverlay) {
       std::make_shared<InMemoryStorage>(), Buffer{});
   auto serializer =
       std::make_shared<TrieSerializerImpl>(factory, codec, backend);
-  auto storage_subscription_engine =
-      std::make_shared<StorageSubscriptionEngine>();
   auto chain_subscription_engine = std::make_shared<ChainSubscriptionEngine>();
   std::shared_ptr<ChangesTracker> changes_tracker =
-      std::make_shared<StorageChangesTrackerImpl>(factory,
-                                                  codec,
-                                                  storage_subscription_engine,
-                                                  chain_subscription_engine);
+      std::make_shared<StorageChangesTrackerImpl>(
+          factory, codec, chain_subscription_engine);
   EXPECT_OUTCOME_TRUE_1(
       changes_tracker->onBlockExecutionStart("aaa"_hash256, 42));
   auto batch = PersistentTrieBatchImpl::create(
@@ -130,3 +130,35 @@ TEST_F(LevelDB_Integration_Test, Iterator) {
     EXPECT_EQ(counter[i], 1);
   }
 }
+
+/**
+ * @given database opened with a block cache and a bloom filter
+ * @when data is written, compacted to files and read back
+ * @then the read blocks are charged to the cache and the files are reported in
+ * the level statistics
+ */
+TEST_F(LevelDB_Integration_Test, CacheAndLevelStats) {
+  db_.reset();
+  leveldb::Options options;
+  options.create_if_missing = true;
+  EXPECT_OUTCOME_TRUE(
+      db, LevelDB::create(getPathString(), options, 1 << 20, 10));
+
+  for (uint8_t i = 0; i < 100; ++i) {
+    ASSERT_OUTCOME_SUCCESS_TRY(db->put(Buffer{i}, Buffer(100, i)));
+  }
+  db->compact({}, {});
+  EXPECT_OUTCOME_TRUE_2(value, db->load(Buffer{42}));
+  EXPECT_EQ(value, Buffer(100, 42));
+  EXPECT_OUTCOME_TRUE_2(absent, db->tryLoad(key_));
+  EXPECT_FALSE(absent);
+
+  EXPECT_GT(db->getBlockCacheUsage(), 0);
+  auto levels = db->getLevelStats();
+  ASSERT_FALSE(levels.empty());
+  int files = 0;
+  for (auto &level : levels) {
+    files += level.files;
+  }
+  EXPECT_GT(files, 0);
+}
@@ -0,0 +1,91 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "storage/leveldb/leveldb_spaces.hpp"
+
+#include <gtest/gtest.h>
+
+#include "blockchain/impl/storage_util.hpp"
+#include "testutil/outcome.hpp"
+#include "testutil/storage/base_fs_test.hpp"
+
+using kagome::blockchain::moveKeySpace;
+using kagome::common::Buffer;
+using kagome::storage::LevelDBSpaces;
+using kagome::storage::Space;
+using kagome::storage::spaceName;
+namespace prefix = kagome::blockchain::prefix;
+
+struct LevelDBSpacesTest : public test::BaseFS_Test {
+  LevelDBSpacesTest() : test::BaseFS_Test("/tmp/kagome_leveldb_spaces_test") {}
+
+  void SetUp() override {
+    BaseFS_Test::SetUp();
+    open();
+  }
+
+  void open() {
+    LevelDBSpaces::SpaceOptions options;
+    options.options.create_if_missing = true;
+    EXPECT_OUTCOME_TRUE(
+        spaces,
+        LevelDBSpaces::create(getPathString(), {{Space::kDefault, options}}));
+    spaces_ = spaces;
+  }
+
+  std::shared_ptr<LevelDBSpaces> spaces_;
+};
+
+/**
+ * @given opened spaced database
+ * @when a value is put to the default space
+ * @then it is not visible in the trie node space, which database is located in
+ * a subdirectory of the database path
+ */
+TEST_F(LevelDBSpacesTest, SpacesAreSeparate) {
+  Buffer key{1, 2, 3};
+  EXPECT_OUTCOME_TRUE_1(spaces_->getSpace(Space::kDefault)->put(key, key));
+
+  EXPECT_OUTCOME_TRUE(contains,
+                      spaces_->getSpace(Space::kTrieNode)->contains(key));
+  ASSERT_FALSE(contains);
+  ASSERT_TRUE(fs::is_directory(base_path / spaceName(Space::kTrieNode)));
+}
+
+/**
+ * @given the default space with entries of several key spaces
+ * @when the trie node key space is moved to the trie node space
+ * @then only its entries are moved, and they are kept after reopening
+ */
+TEST_F(LevelDBSpacesTest, MovesKeySpace) {
+  auto default_space = spaces_->getSpace(Space::kDefault);
+  Buffer node_key1{prefix::TRIE_NODE, 1};
+  Buffer node_key2{prefix::TRIE_NODE, 2};
+  Buffer block_key{prefix::HEADER, 1};
+  Buffer value{4, 5, 6};
+  for (auto &key : {node_key1, node_key2, block_key}) {
+    EXPECT_OUTCOME_TRUE_1(default_space->put(key, value));
+  }
+
+  EXPECT_OUTCOME_TRUE(
+      moved,
+      moveKeySpace(*default_space,
+                   *spaces_->getSpace(Space::kTrieNode),
+                   prefix::TRIE_NODE));
+  ASSERT_EQ(moved, 2);
+
+  spaces_.reset();
+  open();
+  default_space = spaces_->getSpace(Space::kDefault);
+  auto trie_node_space = spaces_->getSpace(Space::kTrieNode);
+  for (auto &key : {node_key1, node_key2}) {
+    EXPECT_OUTCOME_TRUE(moved_value, trie_node_space->load(key));
+    ASSERT_EQ(moved_value, value);
+    EXPECT_OUTCOME_TRUE(contains, default_space->contains(key));
+    ASSERT_FALSE(contains);
+  }
+  EXPECT_OUTCOME_TRUE(contains, default_space->contains(block_key));
+  ASSERT_TRUE(contains);
+}
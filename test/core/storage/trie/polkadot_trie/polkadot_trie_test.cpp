@@ -374,11 +374,10 @@ size_t size(const PolkadotTrie::NodePtr &node) {
   if(node == nullptr) return 0;
 
   if (node->isBranch()) {
-    auto branch =
-        std::dynamic_pointer_cast<kagome::storage::trie::BranchNode>(node);
+    auto branch = kagome::storage::trie::nodeCast<BranchNode>(node);
     for (const auto &child : branch->children) {
       if (child != nullptr) {
-        auto child_node = std::dynamic_pointer_cast<TrieNode>(child);
+        auto child_node = kagome::storage::trie::nodeCast<TrieNode>(child);
         count += size(child_node);
       }
     }
@@ -597,3 +596,39 @@ TEST_F(TrieTest, GetNodeReturnsNullptrWhenNotFound) {
       trie->getNode(trie->getRoot(), KeyNibbles{"01020304050607"_hex2buf}));
   ASSERT_EQ(res, nullptr) << res->value->toHex();
 }
+
+/**
+ * @given a trie with merkle values of its nodes cached by an encoding of the
+ * root
+ * @when modifying the trie with put, remove and clearPrefix
+ * @then the root hash is the same as the one of a trie built from scratch with
+ * the resulting entries, so no stale merkle value is used
+ */
+TEST_F(TrieTest, CachedMerkleValuesInvalidatedOnChanges) {
+  PolkadotCodec codec;
+  auto root_hash = [&codec](const PolkadotTrie &trie) {
+    auto enc = codec.encodeNode(*trie.getRoot()).value();
+    return codec.hash256(enc);
+  };
+
+  FillSmallTree(*trie);
+  std::ignore = root_hash(*trie);
+
+  ASSERT_OUTCOME_SUCCESS_TRY(trie->put("010204"_hex2buf, "cafe"_hex2buf));
+  std::ignore = root_hash(*trie);
+  ASSERT_OUTCOME_SUCCESS_TRY(trie->remove(data[3].first));
+  std::ignore = root_hash(*trie);
+  ASSERT_OUTCOME_SUCCESS_TRY(
+      trie->clearPrefix("12"_hex2buf, std::nullopt, [](const auto &, auto &&) {
+        return outcome::success();
+      }));
+
+  PolkadotTrieImpl expected_trie;
+  for (auto &entry : {data[2], data[4]}) {
+    ASSERT_OUTCOME_SUCCESS_TRY(expected_trie.put(entry.first, entry.second));
+  }
+  ASSERT_OUTCOME_SUCCESS_TRY(
+      expected_trie.put("010204"_hex2buf, "cafe"_hex2buf));
+
+  ASSERT_EQ(root_hash(*trie), root_hash(expected_trie));
+}
@@ -0,0 +1,101 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "storage/trie/polkadot_trie/trie_node.hpp"
+
+#include <gtest/gtest.h>
+
+using kagome::common::Buffer;
+using kagome::storage::trie::BranchContainingHashesNode;
+using kagome::storage::trie::BranchNode;
+using kagome::storage::trie::DummyNode;
+using kagome::storage::trie::KeyNibbles;
+using kagome::storage::trie::LeafContainingHashesNode;
+using kagome::storage::trie::LeafNode;
+using kagome::storage::trie::nodeCast;
+using kagome::storage::trie::OpaqueTrieNode;
+using kagome::storage::trie::TrieNode;
+
+/**
+ * @given a node of each class
+ * @when it is cast by a pointer to each of the node classes
+ * @then the cast succeeds only for its own class and, unless it is a dummy,
+ * for TrieNode, nullptr is returned otherwise
+ */
+TEST(TrieNodeTest, CastsPointer) {
+  LeafNode leaf{KeyNibbles{1}, Buffer{2}};
+  BranchNode branch{KeyNibbles{1}};
+  DummyNode dummy{Buffer{3}};
+  OpaqueTrieNode *leaf_ptr = &leaf;
+  OpaqueTrieNode *branch_ptr = &branch;
+  const OpaqueTrieNode *dummy_ptr = &dummy;
+
+  EXPECT_EQ(nodeCast<LeafNode>(leaf_ptr), &leaf);
+  EXPECT_EQ(nodeCast<TrieNode>(leaf_ptr), &leaf);
+  EXPECT_EQ(nodeCast<BranchNode>(leaf_ptr), nullptr);
+  EXPECT_EQ(nodeCast<LeafContainingHashesNode>(leaf_ptr), nullptr);
+  EXPECT_EQ(nodeCast<DummyNode>(leaf_ptr), nullptr);
+
+  EXPECT_EQ(nodeCast<BranchNode>(branch_ptr), &branch);
+  EXPECT_EQ(nodeCast<TrieNode>(branch_ptr), &branch);
+  EXPECT_EQ(nodeCast<LeafNode>(branch_ptr), nullptr);
+  EXPECT_EQ(nodeCast<BranchContainingHashesNode>(branch_ptr), nullptr);
+
+  EXPECT_EQ(nodeCast<DummyNode>(dummy_ptr), &dummy);
+  EXPECT_EQ(nodeCast<TrieNode>(dummy_ptr), nullptr);
+  EXPECT_EQ(nodeCast<BranchNode>(dummy_ptr), nullptr);
+
+  EXPECT_EQ(nodeCast<TrieNode>(static_cast<OpaqueTrieNode *>(nullptr)),
+            nullptr);
+}
+
+/**
+ * @given a node
+ * @when it is cast by a reference
+ * @then the cast to its own class or to TrieNode returns the node, the cast
+ * to another class throws std::bad_cast
+ */
+TEST(TrieNodeTest, CastsReference) {
+  BranchContainingHashesNode branch{KeyNibbles{1}};
+  OpaqueTrieNode &node = branch;
+  const OpaqueTrieNode &const_node = branch;
+
+  EXPECT_EQ(&nodeCast<BranchContainingHashesNode>(node), &branch);
+  EXPECT_EQ(&nodeCast<TrieNode>(const_node), &branch);
+  EXPECT_THROW(nodeCast<BranchNode>(node), std::bad_cast);
+  EXPECT_THROW(nodeCast<DummyNode>(const_node), std::bad_cast);
+}
+
+/**
+ * @given a node owned by a shared pointer
+ * @when the pointer is cast
+ * @then the result shares the ownership of the node if the node is of the
+ * requested class, it is nullptr otherwise
+ */
+TEST(TrieNodeTest, CastsSharedPointer) {
+  std::shared_ptr<OpaqueTrieNode> node =
+      std::make_shared<LeafContainingHashesNode>(KeyNibbles{1}, Buffer{2});
+  std::shared_ptr<const OpaqueTrieNode> const_node = node;
+
+  auto leaf = nodeCast<LeafContainingHashesNode>(node);
+  EXPECT_EQ(leaf, node);
+  EXPECT_EQ(node.use_count(), 3);
+  EXPECT_EQ(nodeCast<const TrieNode>(const_node), node);
+  EXPECT_EQ(nodeCast<LeafNode>(node), nullptr);
+  EXPECT_EQ(nodeCast<const DummyNode>(const_node), nullptr);
+  EXPECT_EQ(nodeCast<TrieNode>(std::shared_ptr<OpaqueTrieNode>{}), nullptr);
+}
+
+/**
+ * @given a leaf node
+ * @when its size is compared to the size of its data
+ * @then the kind of the node takes no space of its own
+ */
+TEST(TrieNodeTest, KindTakesNoSpace) {
+  // vptr, the kind and the dirty flag, the key, the value and the merkle value
+  EXPECT_EQ(sizeof(LeafNode),
+            2 * sizeof(void *) + sizeof(KeyNibbles)
+                + 2 * sizeof(std::optional<Buffer>));
+}
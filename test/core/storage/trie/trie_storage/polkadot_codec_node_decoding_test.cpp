@@ -28,9 +28,8 @@ TEST_P(NodeDecodingTest, GetHeader) {
 
   EXPECT_OUTCOME_TRUE(encoded, codec->encodeNode(*node));
   EXPECT_OUTCOME_TRUE(decoded, codec->decodeNode(encoded));
-  auto decoded_node = std::dynamic_pointer_cast<TrieNode>(decoded);
-  EXPECT_EQ(decoded_node->key_nibbles, node->key_nibbles);
-  EXPECT_EQ(decoded_node->value, node->value);
+  EXPECT_EQ(decoded->key_nibbles, node->key_nibbles);
+  EXPECT_EQ(decoded->value, node->value);
 }
 
 template <typename T>
@@ -263,4 +263,114 @@ TEST_F(TrieBatchTest, TopperBatchRemove) {
   ASSERT_FALSE(p_batch->contains("102030"_hex2buf).value());
 }
 
+/**
+ * @given a trie committed to the storage
+ * @when reading all its entries with a new batch and committing this batch
+ * @then nothing is written to the storage and the root stays the same
+ */
+TEST_F(TrieBatchTest, CommitUnmodifiedWritesNothing) {
+  auto db = std::make_shared<MockDb>();
+  EXPECT_CALL(*db, put(_, _))
+      .WillRepeatedly(Invoke(db.get(), &MockDb::true_put));
+
+  auto factory = std::make_shared<PolkadotTrieFactoryImpl>();
+  auto codec = std::make_shared<PolkadotCodec>();
+  auto serializer = std::make_shared<TrieSerializerImpl>(
+      factory,
+      codec,
+      std::make_shared<TrieStorageBackendImpl>(db, kNodePrefix));
+  auto trie =
+      TrieStorageImpl::createEmpty(factory, codec, serializer, std::nullopt)
+          .value();
+  auto batch = trie->getPersistentBatchAt(empty_hash).value();
+  FillSmallTrieWithBatch(*batch);
+  ASSERT_OUTCOME_SUCCESS(root_hash, batch->commit());
+
+  testing::Mock::VerifyAndClearExpectations(db.get());
+  EXPECT_CALL(*db, put(_, _)).Times(0);
+
+  auto read_batch = trie->getPersistentBatchAt(root_hash).value();
+  for (auto &entry : data) {
+    ASSERT_OUTCOME_SUCCESS(res, read_batch->get(entry.first));
+    ASSERT_EQ(res.get(), entry.second);
+  }
+  ASSERT_OUTCOME_SUCCESS(new_root_hash, read_batch->commit());
+  ASSERT_EQ(new_root_hash, root_hash);
+}
+
+/**
+ * @given a trie committed to the storage
+ * @when modifying one of its entries with a new batch and committing this batch
+ * @then only the nodes on the path to the modified entry are written
+ */
+TEST_F(TrieBatchTest, CommitWritesOnlyModifiedPath) {
+  auto db = std::make_shared<MockDb>();
+  EXPECT_CALL(*db, put(_, _))
+      .WillRepeatedly(Invoke(db.get(), &MockDb::true_put));
+
+  auto factory = std::make_shared<PolkadotTrieFactoryImpl>();
+  auto codec = std::make_shared<PolkadotCodec>();
+  auto serializer = std::make_shared<TrieSerializerImpl>(
+      factory,
+      codec,
+      std::make_shared<TrieStorageBackendImpl>(db, kNodePrefix));
+  auto trie =
+      TrieStorageImpl::createEmpty(factory, codec, serializer, std::nullopt)
+          .value();
+  auto batch = trie->getPersistentBatchAt(empty_hash).value();
+  FillSmallTrieWithBatch(*batch);
+  ASSERT_OUTCOME_SUCCESS(root_hash, batch->commit());
+
+  testing::Mock::VerifyAndClearExpectations(db.get());
+  // the root, the branch with the common nibble 0 and the leaf itself
+  EXPECT_CALL(*db, put(_, _))
+      .Times(3)
+      .WillRepeatedly(Invoke(db.get(), &MockDb::true_put));
+
+  auto write_batch = trie->getPersistentBatchAt(root_hash).value();
+  for (auto &entry : data) {
+    ASSERT_OUTCOME_SUCCESS_TRY(write_batch->get(entry.first));
+  }
+  ASSERT_OUTCOME_SUCCESS_TRY(write_batch->put(data[4].first, "1337"_hex2buf));
+  ASSERT_OUTCOME_SUCCESS(new_root_hash, write_batch->commit());
+  ASSERT_NE(new_root_hash, root_hash);
+
+  auto read_batch = trie->getEphemeralBatchAt(new_root_hash).value();
+  ASSERT_OUTCOME_SUCCESS(res, read_batch->get(data[4].first));
+  ASSERT_EQ(res.get(), "1337"_hex2buf);
+}
+
+/**
+ * @given a persistent batch with some changes
+ * @when calculating the root hash of the batch
+ * @then nothing is written to the storage and the root is the same as the one
+ * obtained on the commit of the batch
+ */
+TEST_F(TrieBatchTest, HashWritesNothing) {
+  auto db = std::make_shared<MockDb>();
+  auto factory = std::make_shared<PolkadotTrieFactoryImpl>();
+  auto codec = std::make_shared<PolkadotCodec>();
+  auto serializer = std::make_shared<TrieSerializerImpl>(
+      factory,
+      codec,
+      std::make_shared<TrieStorageBackendImpl>(db, kNodePrefix));
+  auto trie =
+      TrieStorageImpl::createEmpty(factory, codec, serializer, std::nullopt)
+          .value();
+  auto batch = trie->getPersistentBatchAt(empty_hash).value();
+
+  EXPECT_CALL(*db, put(_, _)).Times(0);
+  FillSmallTrieWithBatch(*batch);
+  ASSERT_OUTCOME_SUCCESS(hash, batch->hash());
+  ASSERT_OUTCOME_SUCCESS_TRY(batch->put(data[0].first, "1337"_hex2buf));
+  ASSERT_OUTCOME_SUCCESS(new_hash, batch->hash());
+  ASSERT_NE(hash, new_hash);
+
+  testing::Mock::VerifyAndClearExpectations(db.get());
+  EXPECT_CALL(*db, put(_, _))
+      .WillRepeatedly(Invoke(db.get(), &MockDb::true_put));
+  ASSERT_OUTCOME_SUCCESS(root_hash, batch->commit());
+  ASSERT_EQ(root_hash, new_hash);
+}
+
 // TODO(Harrm): #595 test clearPrefix
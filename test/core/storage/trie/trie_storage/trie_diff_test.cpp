@@ -0,0 +1,203 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "storage/trie/impl/trie_diff_impl.hpp"
+
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "storage/in_memory/in_memory_storage.hpp"
+#include "storage/trie/impl/trie_storage_backend_impl.hpp"
+#include "storage/trie/impl/trie_storage_impl.hpp"
+#include "storage/trie/polkadot_trie/polkadot_trie_factory_impl.hpp"
+#include "storage/trie/serialization/polkadot_codec.hpp"
+#include "storage/trie/serialization/trie_serializer_impl.hpp"
+#include "testutil/literals.hpp"
+#include "testutil/outcome.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+using namespace kagome::storage::trie;
+using kagome::common::Buffer;
+using kagome::common::BufferView;
+using kagome::storage::InMemoryStorage;
+
+class TrieDiffTest : public testing::Test {
+ public:
+  /// Values of the changed keys in the new state, std::nullopt if removed
+  using Changes = std::map<Buffer, std::optional<Buffer>>;
+
+  static void SetUpTestCase() {
+    testutil::prepareLoggers();
+  }
+
+  void SetUp() override {
+    auto backend = std::make_shared<TrieStorageBackendImpl>(
+        std::make_shared<InMemoryStorage>(), Buffer{});
+    auto serializer =
+        std::make_shared<TrieSerializerImpl>(factory_, codec_, backend);
+    storage_ = TrieStorageImpl::createEmpty(
+                   factory_, codec_, serializer, std::nullopt)
+                   .value();
+    diff_ = std::make_shared<TrieDiffImpl>(serializer);
+    empty_root_ = serializer->getEmptyRootHash();
+  }
+
+  /**
+   * Applies {@param changes} to the state with {@param root}
+   * @return root of the resulting state
+   */
+  RootHash commit(const RootHash &root, const Changes &changes) {
+    auto batch = storage_->getPersistentBatchAt(root).value();
+    for (auto &[key, value] : changes) {
+      if (value.has_value()) {
+        EXPECT_OUTCOME_TRUE_1(batch->put(key, value.value()));
+      } else {
+        EXPECT_OUTCOME_TRUE_1(batch->remove(key));
+      }
+    }
+    return batch->commit().value();
+  }
+
+  /**
+   * @return changes reported by the diff in the order of reporting
+   */
+  std::vector<std::pair<Buffer, std::optional<Buffer>>> diff(
+      const RootHash &from,
+      const RootHash &to,
+      std::optional<std::vector<Buffer>> keys = std::nullopt) {
+    std::vector<std::pair<Buffer, std::optional<Buffer>>> changes;
+    auto on_change = [&](const Buffer &key,
+                         const std::optional<BufferView> &value)
+        -> outcome::result<void> {
+      changes.emplace_back(
+          key, value ? std::make_optional(Buffer{*value}) : std::nullopt);
+      return outcome::success();
+    };
+    if (keys.has_value()) {
+      EXPECT_OUTCOME_TRUE_1(diff_->diff(from, to, keys.value(), on_change));
+    } else {
+      EXPECT_OUTCOME_TRUE_1(diff_->diff(from, to, on_change));
+    }
+    return changes;
+  }
+
+ protected:
+  std::shared_ptr<PolkadotTrieFactoryImpl> factory_ =
+      std::make_shared<PolkadotTrieFactoryImpl>();
+  std::shared_ptr<PolkadotCodec> codec_ = std::make_shared<PolkadotCodec>();
+  std::unique_ptr<TrieStorageImpl> storage_;
+  std::shared_ptr<TrieDiffImpl> diff_;
+  RootHash empty_root_;
+};
+
+/**
+ * @given two states, which differ by a changed value, an added key, which
+ * splits a node of the old state, and a removed key
+ * @when the diff of the states is computed
+ * @then exactly the differing keys are reported in the lexicographical order
+ */
+TEST_F(TrieDiffTest, ReportsChangedKeys) {
+  auto root1 = commit(empty_root_,
+                      {{"123"_buf, "abc"_buf},
+                       {"124"_buf, "def"_buf},
+                       {"345"_buf, "ghi"_buf},
+                       {"3456"_buf, "jkl"_buf}});
+  auto root2 = commit(root1,
+                      {{"124"_buf, "xyz"_buf},
+                       {"13"_buf, "new"_buf},
+                       {"345"_buf, std::nullopt}});
+
+  std::vector<std::pair<Buffer, std::optional<Buffer>>> expected{
+      {"124"_buf, "xyz"_buf},
+      {"13"_buf, "new"_buf},
+      {"345"_buf, std::nullopt}};
+  ASSERT_EQ(diff(root1, root2), expected);
+
+  std::vector<std::pair<Buffer, std::optional<Buffer>>> reverse{
+      {"124"_buf, "def"_buf},
+      {"13"_buf, std::nullopt},
+      {"345"_buf, "ghi"_buf}};
+  ASSERT_EQ(diff(root2, root1), reverse);
+  ASSERT_TRUE(diff(root1, root1).empty());
+}
+
+/**
+ * @given two states with several changed keys
+ * @when the diff is restricted to some of the keys
+ * @then only those of them which changed are reported
+ */
+TEST_F(TrieDiffTest, ReportsOnlyRequestedKeys) {
+  auto root1 = commit(empty_root_,
+                      {{"123"_buf, "abc"_buf},
+                       {"124"_buf, "def"_buf},
+                       {"345"_buf, "ghi"_buf}});
+  auto root2 = commit(root1,
+                      {{"123"_buf, "cba"_buf},
+                       {"124"_buf, "fed"_buf},
+                       {"5"_buf, "x"_buf}});
+
+  std::vector<std::pair<Buffer, std::optional<Buffer>>> expected{
+      {"124"_buf, "fed"_buf}, {"5"_buf, "x"_buf}};
+  ASSERT_EQ(diff(root1, root2, {{"124"_buf, "345"_buf, "5"_buf, "12"_buf}}),
+            expected);
+}
+
+/**
+ * @given random states sharing most of their entries
+ * @when the diff of the states is computed in both directions
+ * @then it matches the difference of their entries computed by comparing them
+ * key by key
+ */
+TEST_F(TrieDiffTest, MatchesKeyByKeyComparison) {
+  std::mt19937 rand{42};
+  auto random_buffer = [&](size_t max_size) {
+    Buffer buf(1 + rand() % max_size, 0);
+    for (auto &byte : buf) {
+      // small alphabet makes the keys share prefixes
+      byte = rand() % 4;
+    }
+    return buf;
+  };
+
+  Changes entries1;
+  for (auto i = 0; i < 300; ++i) {
+    entries1[random_buffer(6)] = random_buffer(40);
+  }
+  Changes changes;
+  for (auto &[key, value] : entries1) {
+    if (rand() % 10 == 0) {
+      changes[key] = rand() % 2 ? std::make_optional(random_buffer(40))
+                                : std::nullopt;
+    }
+  }
+  for (auto i = 0; i < 30; ++i) {
+    changes[random_buffer(6)] = random_buffer(40);
+  }
+  auto root1 = commit(empty_root_, entries1);
+  auto root2 = commit(root1, changes);
+
+  auto value_at = [](const Changes &entries, const Buffer &key) {
+    auto it = entries.find(key);
+    return it != entries.end() ? it->second : std::nullopt;
+  };
+  Changes entries2 = entries1;
+  for (auto &[key, value] : changes) {
+    entries2[key] = value;
+  }
+  std::vector<std::pair<Buffer, std::optional<Buffer>>> expected;
+  std::vector<std::pair<Buffer, std::optional<Buffer>>> reverse;
+  for (auto &[key, value] : entries2) {
+    auto old_value = value_at(entries1, key);
+    if (old_value != value) {
+      expected.emplace_back(key, value);
+      reverse.emplace_back(key, old_value);
+    }
+  }
+
+  ASSERT_FALSE(expected.empty());
+  ASSERT_EQ(diff(root1, root2), expected);
+  ASSERT_EQ(diff(root2, root1), reverse);
+}
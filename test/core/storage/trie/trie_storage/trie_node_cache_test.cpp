@@ -0,0 +1,115 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <gtest/gtest.h>
+
+#include "storage/in_memory/in_memory_storage.hpp"
+#include "storage/trie/impl/trie_storage_backend_impl.hpp"
+#include "storage/trie/polkadot_trie/polkadot_trie_factory_impl.hpp"
+#include "storage/trie/serialization/polkadot_codec.hpp"
+#include "storage/trie/serialization/trie_node_cache_impl.hpp"
+#include "storage/trie/serialization/trie_serializer_impl.hpp"
+#include "testutil/literals.hpp"
+#include "testutil/outcome.hpp"
+
+using namespace kagome::storage::trie;
+using kagome::common::Buffer;
+using kagome::storage::InMemoryStorage;
+
+namespace {
+  std::shared_ptr<LeafNode> makeLeaf(uint8_t nibble) {
+    auto leaf = std::make_shared<LeafNode>(KeyNibbles{nibble}, "value"_buf);
+    leaf->setClean(Buffer{nibble});
+    return leaf;
+  }
+}  // namespace
+
+/**
+ * @given a cache with a node
+ * @when getting the node and modifying the obtained copy
+ * @then the cached node stays intact
+ */
+TEST(TrieNodeCacheTest, GetReturnsCopy) {
+  TrieNodeCacheImpl cache{1024};
+  auto key = "01"_hex2buf;
+  cache.put(key, *makeLeaf(1));
+
+  auto node = cache.get(key);
+  ASSERT_NE(node, nullptr);
+  ASSERT_EQ(node->key_nibbles, KeyNibbles{1});
+  ASSERT_EQ(node->value, "value"_buf);
+  ASSERT_FALSE(node->isDirty());
+  node->value = "other"_buf;
+  node->setDirty();
+
+  auto other = cache.get(key);
+  ASSERT_NE(other, node);
+  ASSERT_EQ(other->value, "value"_buf);
+  ASSERT_FALSE(other->isDirty());
+
+  ASSERT_EQ(cache.get("02"_hex2buf), nullptr);
+}
+
+/**
+ * @given a cache which fits only two nodes
+ * @when putting a third node into it
+ * @then the least recently used node is evicted
+ */
+TEST(TrieNodeCacheTest, EvictsLeastRecentlyUsed) {
+  TrieNodeCacheImpl probe{1024};
+  probe.put("01"_hex2buf, *makeLeaf(1));
+  TrieNodeCacheImpl cache{probe.size() * 2};
+
+  cache.put("01"_hex2buf, *makeLeaf(1));
+  cache.put("02"_hex2buf, *makeLeaf(2));
+  ASSERT_NE(cache.get("01"_hex2buf), nullptr);
+  cache.put("03"_hex2buf, *makeLeaf(3));
+
+  ASSERT_NE(cache.get("01"_hex2buf), nullptr);
+  ASSERT_EQ(cache.get("02"_hex2buf), nullptr);
+  ASSERT_NE(cache.get("03"_hex2buf), nullptr);
+  ASSERT_EQ(cache.size(), probe.size() * 2);
+}
+
+/**
+ * @given a serializer with a node cache and a trie stored with it
+ * @when the trie is retrieved and its nodes are removed from the storage
+ * @then the trie can still be retrieved, as its nodes are taken from the cache
+ */
+TEST(TrieNodeCacheTest, SerializerUsesCache) {
+  auto factory = std::make_shared<PolkadotTrieFactoryImpl>();
+  auto codec = std::make_shared<PolkadotCodec>();
+  auto backend = std::make_shared<TrieStorageBackendImpl>(
+      std::make_shared<InMemoryStorage>(), Buffer{});
+  auto cache = std::make_shared<TrieNodeCacheImpl>(1024 * 1024);
+  TrieSerializerImpl serializer{factory, codec, backend, cache};
+
+  std::vector<std::pair<Buffer, Buffer>> data{
+      {"123456"_hex2buf, "42"_hex2buf},
+      {"1234"_hex2buf, "1234"_hex2buf},
+      {"010203"_hex2buf, "0a0b"_hex2buf}};
+  auto trie = factory->createEmpty(
+      [](const std::shared_ptr<OpaqueTrieNode> &)
+          -> outcome::result<PolkadotTrie::NodePtr> { return nullptr; });
+  for (auto &[key, value] : data) {
+    EXPECT_OUTCOME_TRUE_1(trie->put(key, value));
+  }
+  EXPECT_OUTCOME_TRUE(root, serializer.storeTrie(*trie));
+
+  EXPECT_OUTCOME_TRUE(retrieved, serializer.retrieveTrie(Buffer{root}));
+  for (auto &[key, value] : data) {
+    ASSERT_OUTCOME_SUCCESS(res, retrieved->get(key));
+    ASSERT_EQ(res.get(), value);
+  }
+
+  EXPECT_OUTCOME_TRUE_1(backend->remove(Buffer{root}));
+  ASSERT_FALSE(backend->contains(Buffer{root}).value());
+
+  EXPECT_OUTCOME_TRUE(cached, serializer.retrieveTrie(Buffer{root}));
+  for (auto &[key, value] : data) {
+    ASSERT_OUTCOME_SUCCESS(res, cached->get(key));
+    ASSERT_EQ(res.get(), value);
+  }
+}
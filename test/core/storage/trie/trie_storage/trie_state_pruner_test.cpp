@@ -0,0 +1,274 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "storage/trie/impl/trie_state_pruner_impl.hpp"
+
+#include <gtest/gtest.h>
+
+#include "scale/scale.hpp"
+#include "storage/in_memory/in_memory_storage.hpp"
+#include "storage/predefined_keys.hpp"
+#include "storage/trie/impl/trie_storage_backend_impl.hpp"
+#include "storage/trie/impl/trie_storage_impl.hpp"
+#include "storage/trie/polkadot_trie/polkadot_trie_factory_impl.hpp"
+#include "storage/trie/serialization/polkadot_codec.hpp"
+#include "storage/trie/serialization/trie_serializer_impl.hpp"
+#include "testutil/literals.hpp"
+#include "testutil/outcome.hpp"
+#include "testutil/prepare_loggers.hpp"
+
+using namespace kagome::storage::trie;
+using kagome::common::Buffer;
+using kagome::storage::InMemoryStorage;
+
+class TrieStatePrunerTest : public testing::Test {
+ public:
+  static void SetUpTestCase() {
+    testutil::prepareLoggers();
+  }
+
+  /**
+   * Enables the pruning on the current contents of the node storage
+   */
+  std::shared_ptr<TrieStatePrunerImpl> makePruner() {
+    return TrieStatePrunerImpl::create(
+               codec_, node_backend_, refcount_storage_, storage_, 1)
+        .value();
+  }
+
+  std::unique_ptr<TrieStorageImpl> makeTrieStorage(
+      std::shared_ptr<TrieStatePruner> pruner) {
+    auto serializer = std::make_shared<TrieSerializerImpl>(
+        factory_, codec_, node_backend_, nullptr, std::move(pruner));
+    return TrieStorageImpl::createEmpty(
+               factory_, codec_, serializer, std::nullopt)
+        .value();
+  }
+
+  /**
+   * Commits {@param entries} on top of the state with {@param root}
+   */
+  RootHash commit(TrieStorage &storage,
+                  const RootHash &root,
+                  const std::vector<std::pair<Buffer, Buffer>> &entries) {
+    auto batch = storage.getPersistentBatchAt(root).value();
+    for (auto &[key, value] : entries) {
+      EXPECT_OUTCOME_TRUE_1(batch->put(key, value));
+    }
+    return batch->commit().value();
+  }
+
+ protected:
+  std::shared_ptr<PolkadotTrieFactoryImpl> factory_ =
+      std::make_shared<PolkadotTrieFactoryImpl>();
+  std::shared_ptr<PolkadotCodec> codec_ = std::make_shared<PolkadotCodec>();
+  std::shared_ptr<InMemoryStorage> node_storage_ =
+      std::make_shared<InMemoryStorage>();
+  std::shared_ptr<TrieStorageBackendImpl> node_backend_ =
+      std::make_shared<TrieStorageBackendImpl>(node_storage_, "\1"_buf);
+  std::shared_ptr<InMemoryStorage> refcount_storage_ =
+      std::make_shared<InMemoryStorage>();
+  std::shared_ptr<InMemoryStorage> storage_ =
+      std::make_shared<InMemoryStorage>();
+  std::vector<std::pair<Buffer, Buffer>> entries_{
+      {"123"_buf, "abc"_buf}, {"124"_buf, "def"_buf}, {"345"_buf, "ghi"_buf}};
+};
+
+/**
+ * @given two blocks with states, the second of which differs from the first
+ * one by a single value
+ * @when the first state is pruned
+ * @then it is not available anymore, while the second one is intact, and no
+ * nodes are left in the storage after the second state is pruned as well
+ */
+TEST_F(TrieStatePrunerTest, RemovesUnreferencedNodes) {
+  auto pruner = makePruner();
+  auto storage = makeTrieStorage(pruner);
+  auto empty_root = codec_->hash256(Buffer{0});
+  auto root1 = commit(*storage, empty_root, entries_);
+  EXPECT_OUTCOME_TRUE_1(pruner->addState(root1));
+  auto root2 = commit(*storage, root1, {{"124"_buf, "xyz"_buf}});
+  EXPECT_OUTCOME_TRUE_1(pruner->addState(root2));
+
+  EXPECT_OUTCOME_TRUE_1(pruner->pruneState(root1));
+
+  ASSERT_FALSE(storage->getEphemeralBatchAt(root1));
+  EXPECT_OUTCOME_TRUE(batch, storage->getEphemeralBatchAt(root2));
+  ASSERT_EQ(batch->get("123"_buf).value().get(), "abc"_buf);
+  ASSERT_EQ(batch->get("124"_buf).value().get(), "xyz"_buf);
+  ASSERT_EQ(batch->get("345"_buf).value().get(), "ghi"_buf);
+
+  EXPECT_OUTCOME_TRUE_1(pruner->pruneState(root2));
+
+  ASSERT_TRUE(node_storage_->empty());
+  ASSERT_TRUE(refcount_storage_->empty());
+}
+
+/**
+ * @given two blocks with states, both of which contain the same child trie
+ * @when the first state is pruned
+ * @then the child trie is intact, and no nodes are left in the storage after
+ * the second state is pruned as well
+ */
+TEST_F(TrieStatePrunerTest, RemovesChildTries) {
+  auto pruner = makePruner();
+  auto storage = makeTrieStorage(pruner);
+  auto empty_root = codec_->hash256(Buffer{0});
+  auto child_root = commit(*storage, empty_root, entries_);
+  auto child_key =
+      Buffer{kagome::storage::kChildStorageDefaultPrefix}.putBuffer(
+          "child"_buf);
+  auto root1 = commit(
+      *storage,
+      empty_root,
+      {{"123"_buf, "abc"_buf}, {child_key, Buffer{child_root}}});
+  EXPECT_OUTCOME_TRUE_1(pruner->addState(root1));
+  auto root2 = commit(*storage, root1, {{"123"_buf, "xyz"_buf}});
+  EXPECT_OUTCOME_TRUE_1(pruner->addState(root2));
+
+  EXPECT_OUTCOME_TRUE_1(pruner->pruneState(root1));
+
+  ASSERT_FALSE(storage->getEphemeralBatchAt(root1));
+  EXPECT_OUTCOME_TRUE(batch, storage->getEphemeralBatchAt(child_root));
+  ASSERT_EQ(batch->get("345"_buf).value().get(), "ghi"_buf);
+
+  EXPECT_OUTCOME_TRUE_1(pruner->pruneState(root2));
+
+  ASSERT_FALSE(storage->getEphemeralBatchAt(child_root));
+  ASSERT_TRUE(node_storage_->empty());
+  ASSERT_TRUE(refcount_storage_->empty());
+}
+
+/**
+ * @given a state of two blocks
+ * @when it is pruned once
+ * @then it is still available
+ */
+TEST_F(TrieStatePrunerTest, KeepsStateReferencedTwice) {
+  auto pruner = makePruner();
+  auto storage = makeTrieStorage(pruner);
+  auto empty_root = codec_->hash256(Buffer{0});
+  auto root = commit(*storage, empty_root, entries_);
+  EXPECT_OUTCOME_TRUE_1(pruner->addState(root));
+  ASSERT_EQ(commit(*storage, root, {}), root);
+  EXPECT_OUTCOME_TRUE_1(pruner->addState(root));
+
+  EXPECT_OUTCOME_TRUE_1(pruner->pruneState(root));
+
+  EXPECT_OUTCOME_TRUE(batch, storage->getEphemeralBatchAt(root));
+  ASSERT_EQ(batch->get("123"_buf).value().get(), "abc"_buf);
+}
+
+/**
+ * @given a state of a single block, which is stored several times, both
+ * from a clean and from a rebuilt trie
+ * @when it is pruned once
+ * @then no nodes are left in the storage
+ */
+TEST_F(TrieStatePrunerTest, CountsStateOncePerBlock) {
+  auto pruner = makePruner();
+  auto storage = makeTrieStorage(pruner);
+  auto empty_root = codec_->hash256(Buffer{0});
+  auto root = commit(*storage, empty_root, entries_);
+  ASSERT_EQ(commit(*storage, root, {}), root);
+  ASSERT_EQ(commit(*storage, empty_root, entries_), root);
+  EXPECT_OUTCOME_TRUE_1(pruner->addState(root));
+
+  EXPECT_OUTCOME_TRUE_1(pruner->pruneState(root));
+
+  ASSERT_TRUE(node_storage_->empty());
+  ASSERT_TRUE(refcount_storage_->empty());
+}
+
+/**
+ * @given a pinned state of a block, which is pinned once more
+ * @when the state of the block is pruned
+ * @then the state is still available
+ */
+TEST_F(TrieStatePrunerTest, KeepsPinnedState) {
+  auto pruner = makePruner();
+  auto storage = makeTrieStorage(pruner);
+  auto empty_root = codec_->hash256(Buffer{0});
+  auto root = commit(*storage, empty_root, entries_);
+  EXPECT_OUTCOME_TRUE_1(pruner->addState(root));
+  EXPECT_OUTCOME_TRUE_1(pruner->pinState(root));
+  EXPECT_OUTCOME_TRUE_1(makePruner()->pinState(root));
+
+  EXPECT_OUTCOME_TRUE_1(pruner->pruneState(root));
+
+  EXPECT_OUTCOME_TRUE(batch, storage->getEphemeralBatchAt(root));
+  ASSERT_EQ(batch->get("123"_buf).value().get(), "abc"_buf);
+  ASSERT_EQ(refcount_storage_->load(Buffer{root}).value(),
+            Buffer{kagome::scale::encode(uint32_t{1}).value()});
+}
+
+/**
+ * @given a pinned state of a block
+ * @when the state is unpinned, unpinned once more and the state of the block
+ * is pruned
+ * @then no nodes are left in the storage
+ */
+TEST_F(TrieStatePrunerTest, RemovesUnpinnedState) {
+  auto pruner = makePruner();
+  auto storage = makeTrieStorage(pruner);
+  auto empty_root = codec_->hash256(Buffer{0});
+  auto root = commit(*storage, empty_root, entries_);
+  EXPECT_OUTCOME_TRUE_1(pruner->addState(root));
+  EXPECT_OUTCOME_TRUE_1(pruner->pinState(root));
+
+  EXPECT_OUTCOME_TRUE_1(pruner->unpinState(root));
+  EXPECT_OUTCOME_TRUE_1(makePruner()->unpinState(root));
+  EXPECT_OUTCOME_TRUE(batch, storage->getEphemeralBatchAt(root));
+  ASSERT_EQ(batch->get("123"_buf).value().get(), "abc"_buf);
+  EXPECT_OUTCOME_TRUE_1(pruner->pruneState(root));
+
+  ASSERT_TRUE(node_storage_->empty());
+  ASSERT_TRUE(refcount_storage_->empty());
+}
+
+/**
+ * @given a state stored before the pruning was enabled and a state on top of
+ * it stored with the pruning
+ * @when the latter state is pruned
+ * @then the former state is intact
+ */
+TEST_F(TrieStatePrunerTest, KeepsNodesStoredWithoutPruning) {
+  auto empty_root = codec_->hash256(Buffer{0});
+  auto root1 = commit(*makeTrieStorage(nullptr), empty_root, entries_);
+  auto pruner = makePruner();
+  auto storage = makeTrieStorage(pruner);
+  EXPECT_OUTCOME_TRUE_1(pruner->addState(root1));
+  auto root2 = commit(*storage, root1, {{"124"_buf, "xyz"_buf}});
+  EXPECT_OUTCOME_TRUE_1(pruner->addState(root2));
+
+  EXPECT_OUTCOME_TRUE_1(pruner->pruneState(root2));
+
+  ASSERT_FALSE(storage->getEphemeralBatchAt(root2));
+  EXPECT_OUTCOME_TRUE(batch, storage->getEphemeralBatchAt(root1));
+  ASSERT_EQ(batch->get("123"_buf).value().get(), "abc"_buf);
+  ASSERT_EQ(batch->get("124"_buf).value().get(), "def"_buf);
+  ASSERT_EQ(batch->get("345"_buf).value().get(), "ghi"_buf);
+}
+
+/**
+ * @given the pruning enabled on an empty storage and a state stored
+ * bypassing it
+ * @when a state on top of it is stored with the pruning
+ * @then the missing reference counters are reported
+ */
+TEST_F(TrieStatePrunerTest, FailsOnMissingRefCount) {
+  auto pruner = makePruner();
+  auto empty_root = codec_->hash256(Buffer{0});
+  auto root1 = commit(*makeTrieStorage(nullptr), empty_root, entries_);
+
+  EXPECT_OUTCOME_ERROR(res,
+                       pruner->addState(root1),
+                       TrieStatePrunerImpl::Error::MISSING_REFCOUNT);
+  auto batch =
+      makeTrieStorage(makePruner())->getPersistentBatchAt(root1).value();
+  EXPECT_OUTCOME_TRUE_1(batch->put("124"_buf, "xyz"_buf));
+  EXPECT_OUTCOME_ERROR(
+      res2, batch->commit(), TrieStatePrunerImpl::Error::MISSING_REFCOUNT);
+}
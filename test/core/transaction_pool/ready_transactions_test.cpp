@@ -0,0 +1,102 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "transaction_pool/ready_transactions.hpp"
+
+#include <gtest/gtest.h>
+
+#include "testutil/literals.hpp"
+
+using kagome::primitives::Transaction;
+using kagome::transaction_pool::ReadyTransactions;
+
+std::shared_ptr<const Transaction> makeTx(
+    Transaction::Hash hash,
+    Transaction::Priority priority,
+    std::vector<Transaction::Tag> provides,
+    std::vector<Transaction::Tag> requires) {
+  auto tx = std::make_shared<Transaction>();
+  tx->hash = std::move(hash);
+  tx->priority = priority;
+  tx->valid_till = 10000;
+  tx->provides = std::move(provides);
+  tx->requires = std::move(requires);
+  return tx;
+}
+
+/**
+ * Takes transactions from {@param ready} until it is exhausted, marking each
+ * of them as included
+ * @returns hashes of the taken transactions
+ */
+std::vector<Transaction::Hash> includeAll(ReadyTransactions &ready) {
+  std::vector<Transaction::Hash> hashes;
+  while (auto tx = ready.next()) {
+    hashes.push_back(tx->hash);
+    ready.markIncluded(*tx);
+  }
+  return hashes;
+}
+
+/**
+ * @given independent transactions with different priorities and two
+ * transactions with the same priority, but different end of validity
+ * @when all of them are taken from the ready queue
+ * @then they are yielded by descending priority, then by the earliest end of
+ * validity
+ */
+TEST(ReadyTransactionsTest, YieldsByPriority) {
+  auto late = std::make_shared<Transaction>(*makeTx("04"_hash256, 5, {}, {}));
+  late->valid_till = 20000;
+  ReadyTransactions ready{{makeTx("01"_hash256, 1, {}, {}),
+                           late,
+                           makeTx("02"_hash256, 10, {}, {}),
+                           makeTx("03"_hash256, 5, {}, {})}};
+  ASSERT_EQ(ready.size(), 4);
+
+  std::vector<Transaction::Hash> expected{
+      "02"_hash256, "03"_hash256, "04"_hash256, "01"_hash256};
+  ASSERT_EQ(includeAll(ready), expected);
+  ASSERT_EQ(ready.size(), 0);
+}
+
+/**
+ * @given a chain of dependent transactions, where the dependents have higher
+ * priority than the transactions they depend on, and a transaction requiring a
+ * tag which none of the transactions provides
+ * @when all of them are taken from the ready queue
+ * @then a transaction is yielded only after the transaction providing its
+ * requirement, while the unknown requirement is considered satisfied
+ */
+TEST(ReadyTransactionsTest, YieldsDependentsAfterRequirements) {
+  ReadyTransactions ready{{makeTx("01"_hash256, 1, {{1}}, {}),
+                           makeTx("02"_hash256, 20, {{2}}, {{1}}),
+                           makeTx("03"_hash256, 30, {{3}}, {{1}, {2}}),
+                           makeTx("04"_hash256, 10, {}, {{42}})}};
+
+  std::vector<Transaction::Hash> expected{
+      "04"_hash256, "01"_hash256, "02"_hash256, "03"_hash256};
+  ASSERT_EQ(includeAll(ready), expected);
+}
+
+/**
+ * @given a transaction and its dependent
+ * @when the transaction is taken from the ready queue, but not included
+ * @then its dependent is not yielded
+ */
+TEST(ReadyTransactionsTest, SkipsDependentsOfNotIncluded) {
+  ReadyTransactions ready{{makeTx("01"_hash256, 1, {{1}}, {}),
+                           makeTx("02"_hash256, 2, {{2}}, {{1}}),
+                           makeTx("03"_hash256, 0, {}, {})}};
+
+  auto tx = ready.next();
+  ASSERT_TRUE(tx);
+  ASSERT_EQ(tx->hash, "01"_hash256);
+  tx = ready.next();
+  ASSERT_TRUE(tx);
+  ASSERT_EQ(tx->hash, "03"_hash256);
+  ASSERT_FALSE(ready.next());
+  ASSERT_EQ(ready.size(), 1);
+}
@@ -31,6 +31,14 @@ using kagome::transaction_pool::PoolModeratorMock;
 using kagome::transaction_pool::TransactionPoolError;
 using kagome::transaction_pool::TransactionPoolImpl;
 
+using kagome::primitives::Extrinsic;
+using kagome::primitives::TransactionSource;
+using kagome::primitives::TransactionValidity;
+using kagome::primitives::ValidTransaction;
+using kagome::runtime::ValidityResults;
+
+using testing::_;
+using testing::ElementsAre;
 using testing::NiceMock;
 using testing::Return;
 
@@ -43,9 +51,9 @@ class TransactionPoolTest : public testing::Test {
   }
 
   void SetUp() override {
-    auto ttq = std::make_shared<TaggedTransactionQueueMock>();
-    auto hasher = std::make_shared<HasherMock>();
-    auto tx_transmitter = std::make_shared<TransactionsTransmitterMock>();
+    ttq_ = std::make_shared<TaggedTransactionQueueMock>();
+    hasher_ = std::make_shared<HasherMock>();
+    tx_transmitter_ = std::make_shared<TransactionsTransmitterMock>();
     auto moderator = std::make_unique<NiceMock<PoolModeratorMock>>();
     auto header_repo = std::make_unique<BlockHeaderRepositoryMock>();
     auto engine = std::make_unique<ExtrinsicSubscriptionEngine>();
@@ -53,9 +61,9 @@ class TransactionPoolTest : public testing::Test {
         std::make_unique<ExtrinsicEventKeyRepository>();
 
     pool_ = std::make_shared<TransactionPoolImpl>(
-        std::move(ttq),
-        std::move(hasher),
-        std::move(tx_transmitter),
+        ttq_,
+        hasher_,
+        tx_transmitter_,
         std::move(moderator),
         std::move(header_repo),
         std::move(engine),
@@ -64,6 +72,9 @@ class TransactionPoolTest : public testing::Test {
   }
 
  protected:
+  std::shared_ptr<TaggedTransactionQueueMock> ttq_;
+  std::shared_ptr<HasherMock> hasher_;
+  std::shared_ptr<TransactionsTransmitterMock> tx_transmitter_;
   std::shared_ptr<TransactionPoolImpl> pool_;
 };
 
@@ -161,3 +172,87 @@ TEST_F(TransactionPoolTest, CorrectRemoveTx) {
     EXPECT_EQ(outcome.error(), TransactionPoolError::TX_NOT_FOUND);
   }
 }
+
+/**
+ * @given a batch of extrinsics, one of which is submitted twice
+ * @when the batch is submitted to the pool
+ * @then each distinct extrinsic is validated once in a single runtime call and
+ * imported, while the duplicate is rejected
+ */
+TEST_F(TransactionPoolTest, SubmitExtrinsicsValidatesDuplicatesOnce) {
+  std::vector<Extrinsic> extrinsics{
+      Extrinsic{"01"_buf}, Extrinsic{"02"_buf}, Extrinsic{"01"_buf}};
+  EXPECT_CALL(*hasher_, blake2b_256(gsl::span<const uint8_t>("01"_buf)))
+      .WillRepeatedly(Return("01"_hash256));
+  EXPECT_CALL(*hasher_, blake2b_256(gsl::span<const uint8_t>("02"_buf)))
+      .WillRepeatedly(Return("02"_hash256));
+  ValidityResults validities;
+  for (uint8_t tag : {1, 2}) {
+    ValidTransaction valid{};
+    valid.provides = {{tag}};
+    valid.longevity = 10000;
+    validities.emplace_back(TransactionValidity{valid});
+  }
+  EXPECT_CALL(*ttq_,
+              validate_transactions(
+                  TransactionSource::External,
+                  ElementsAre(Extrinsic{"01"_buf}, Extrinsic{"02"_buf})))
+      .WillOnce(Return(validities));
+
+  auto results =
+      pool_->submitExtrinsics(TransactionSource::External, extrinsics);
+
+  ASSERT_EQ(results.size(), 3);
+  EXPECT_OUTCOME_TRUE(hash1, results[0]);
+  EXPECT_EQ(hash1, "01"_hash256);
+  EXPECT_OUTCOME_TRUE(hash2, results[1]);
+  EXPECT_EQ(hash2, "02"_hash256);
+  ASSERT_TRUE(results[2].has_error());
+  EXPECT_EQ(results[2].error(), TransactionPoolError::TX_ALREADY_IMPORTED);
+  EXPECT_EQ(pool_->getStatus().ready_num, 2);
+}
+
+/**
+ * @given an extrinsic already imported to the pool
+ * @when it is submitted again
+ * @then it is rejected without being validated by the runtime
+ */
+TEST_F(TransactionPoolTest, SubmitExtrinsicsSkipsImported) {
+  EXPECT_OUTCOME_TRUE_1(submit(*pool_, {makeTx("01"_hash256, {{1}}, {})}));
+  EXPECT_CALL(*hasher_, blake2b_256(_)).WillOnce(Return("01"_hash256));
+  EXPECT_CALL(*ttq_, validate_transactions(_, _)).Times(0);
+
+  auto results = pool_->submitExtrinsics(TransactionSource::External,
+                                         {Extrinsic{"01"_buf}});
+
+  ASSERT_EQ(results.size(), 1);
+  ASSERT_TRUE(results[0].has_error());
+  EXPECT_EQ(results[0].error(), TransactionPoolError::TX_ALREADY_IMPORTED);
+}
+
+/**
+ * @given transactions with different priorities, the best of which depends on
+ * the worst one
+ * @when they are imported to the pool and taken from its ready queue
+ * @then they are yielded by descending priority, but the dependent one only
+ * after the transaction it depends on
+ */
+TEST_F(TransactionPoolTest, ReadyQueueOrder) {
+  std::vector<Transaction> txs{makeTx("01"_hash256, {{1}}, {}),
+                               makeTx("02"_hash256, {{2}}, {}),
+                               makeTx("03"_hash256, {{3}}, {{1}})};
+  txs[0].priority = 1;
+  txs[1].priority = 2;
+  txs[2].priority = 3;
+  EXPECT_OUTCOME_TRUE_1(submit(*pool_, txs));
+
+  auto ready = pool_->getReadyQueue();
+  std::vector<Transaction::Hash> hashes;
+  while (auto tx = ready.next()) {
+    hashes.push_back(tx->hash);
+    ready.markIncluded(*tx);
+  }
+  std::vector<Transaction::Hash> expected{
+      "02"_hash256, "01"_hash256, "03"_hash256};
+  ASSERT_EQ(hashes, expected);
+}
@@ -100,8 +100,6 @@ int main() {
           database, kagome::common::Buffer::fromHex("DEADBEEF").value());
   auto serializer = std::make_shared<kagome::storage::trie::TrieSerializerImpl>(
       trie_factory, codec, storage_backend);
-  auto storage_subscription_engine =
-      std::make_shared<kagome::primitives::events::StorageSubscriptionEngine>();
   auto chain_subscription_engine =
       std::make_shared<kagome::primitives::events::ChainSubscriptionEngine>();
 
@@ -109,7 +107,6 @@ int main() {
       kagome::storage::changes_trie::StorageChangesTrackerImpl>(
       trie_factory,
       codec,
-      storage_subscription_engine,
       chain_subscription_engine);
 
   auto trie_storage =
@@ -192,7 +189,9 @@ int main() {
           crypto_store,
           bip39_provider,
           offchain_persistent_storage,
-          offchain_worker_pool);
+          offchain_worker_pool,
+          std::make_shared<kagome::common::WorkerPool>(
+              kagome::common::WorkerPool::Configuration{}));
 
   auto smc = std::make_shared<kagome::runtime::SingleModuleCache>();
   auto instance_env_factory =
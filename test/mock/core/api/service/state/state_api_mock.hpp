@@ -60,6 +60,12 @@ namespace kagome::api {
                  std::optional<primitives::BlockHash> at),
                 (const, override));
 
+    MOCK_METHOD(outcome::result<std::vector<common::Buffer>>,
+                getChangedKeys,
+                (const primitives::BlockHash &from,
+                 std::optional<primitives::BlockHash> to),
+                (const, override));
+
     MOCK_METHOD(outcome::result<uint32_t>,
                 subscribeStorage,
                 (std::vector<common::Buffer> const &keys),
@@ -33,6 +33,11 @@ namespace kagome::application {
                 (std::string chain_id),
                 (const, override));
 
+    MOCK_METHOD(boost::filesystem::path,
+                runtimeCachePath,
+                (std::string chain_id),
+                (const, override));
+
     MOCK_METHOD(const std::optional<crypto::Ed25519PrivateKey> &,
                 nodeKey,
                 (),
@@ -109,6 +114,25 @@ namespace kagome::application {
 
     MOCK_METHOD(bool, isOffchainIndexingEnabled, (), (const, override));
 
+    MOCK_METHOD(uint32_t, trieCacheSize, (), (const, override));
+
+    MOCK_METHOD(uint32_t, runtimeCacheSize, (), (const, override));
+
+    MOCK_METHOD(std::optional<uint32_t>,
+                statePruningDepth,
+                (),
+                (const, override));
+
+    MOCK_METHOD(uint32_t, dbCacheSize, (), (const, override));
+
+    MOCK_METHOD(uint32_t, dbBloomFilterBits, (), (const, override));
+
+    MOCK_METHOD(uint32_t, dbWriteBufferSize, (), (const, override));
+
+    MOCK_METHOD(bool, isDbCompressionEnabled, (), (const, override));
+
+    MOCK_METHOD(uint32_t, blockProposalShare, (), (const, override));
+
     MOCK_METHOD(std::optional<primitives::BlockId>,
                 recoverState,
                 (),
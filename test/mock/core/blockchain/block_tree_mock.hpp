@@ -103,6 +103,14 @@ namespace kagome::blockchain {
                  const uint32_t),
                 (const, override));
 
+    MOCK_METHOD(outcome::result<void>,
+                forEachBlockInChain,
+                (const primitives::BlockHash &,
+                 const primitives::BlockHash &,
+                 GetChainDirection,
+                 const ChainVisitor &),
+                (const, override));
+
     MOCK_METHOD(bool,
                 hasDirectChain,
                 (const primitives::BlockHash &, const primitives::BlockHash &),
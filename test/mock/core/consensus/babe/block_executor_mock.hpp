@@ -21,6 +21,11 @@ namespace kagome::consensus {
     outcome::result<void> applyBlock(primitives::BlockData &&block) override {
       return applyBlock(block);
     }
+
+    MOCK_METHOD(void,
+                prepareBlock,
+                (const primitives::BlockData &block),
+                (override));
   };
 
 }  // namespace kagome::consensus
@@ -29,6 +29,16 @@ namespace kagome::consensus::grandpa {
                 (const SignedMessage &precommit),
                 (const, override));
 
+    MOCK_METHOD(void,
+                preverify,
+                (gsl::span<const SignedMessage> votes),
+                (const, override));
+
+    MOCK_METHOD(void,
+                preverifyPrecommits,
+                (gsl::span<const SignedPrecommit> precommits),
+                (const, override));
+
     MOCK_METHOD(std::optional<SignedMessage>,
                 signPrimaryPropose,
                 (const PrimaryPropose &primary_propose),
@@ -14,18 +14,22 @@ namespace kagome::crypto {
 
   class Ed25519ProviderMock : public Ed25519Provider {
    public:
-    Ed25519Keypair;
-    Ed25519Keypair;
+    MOCK_METHOD(Ed25519Keypair, generateKeypair, (), (const, override));
+
+    MOCK_METHOD(Ed25519Keypair,
+                generateKeypair,
+                (const Ed25519Seed &),
+                (const, override));
 
     MOCK_METHOD(outcome::result<Ed25519Signature>,
                 sign,
-                (const Ed25519Keypair &, gsl::span<uint8_t>),
+                (const Ed25519Keypair &, gsl::span<const uint8_t>),
                 (const, override));
 
     MOCK_METHOD(outcome::result<bool>,
                 verify,
                 (const Ed25519Signature &signature,
-                 gsl::span<uint8_t> message,
+                 gsl::span<const uint8_t> message,
                  const Ed25519PublicKey &public_key),
                 (const, override));
   };
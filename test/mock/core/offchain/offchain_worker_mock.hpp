@@ -16,6 +16,8 @@ namespace kagome::offchain {
    public:
     MOCK_METHOD(outcome::result<void>, run, (), (override));
 
+    MOCK_METHOD(void, stop, (), (override));
+
     MOCK_METHOD(bool, isValidator, (), (const, override));
 
     MOCK_METHOD((Result<Success, Failure>),
@@ -14,25 +14,27 @@ namespace kagome::runtime {
   class BlockBuilderApiMock : public BlockBuilder {
    public:
     MOCK_METHOD(
-        outcome::result<PersistentResult<primitives::ApplyExtrinsicResult>>,
+        outcome::result<primitives::ApplyExtrinsicResult>,
         apply_extrinsic,
         (const primitives::BlockInfo &block,
-         storage::trie::RootHash const &storage_hash,
+         const std::shared_ptr<storage::trie::PersistentTrieBatch> &batch,
          const primitives::Extrinsic &),
         (override));
 
-    MOCK_METHOD(outcome::result<primitives::BlockHeader>,
-                finalize_block,
-                (const primitives::BlockInfo &block,
-                 storage::trie::RootHash const &storage_hash),
-                (override));
+    MOCK_METHOD(
+        outcome::result<primitives::BlockHeader>,
+        finalize_block,
+        (const primitives::BlockInfo &block,
+         const std::shared_ptr<storage::trie::PersistentTrieBatch> &batch),
+        (override));
 
-    MOCK_METHOD(outcome::result<std::vector<primitives::Extrinsic>>,
-                inherent_extrinsics,
-                (const primitives::BlockInfo &block,
-                 storage::trie::RootHash const &storage_hash,
-                 const primitives::InherentData &),
-                (override));
+    MOCK_METHOD(
+        outcome::result<std::vector<primitives::Extrinsic>>,
+        inherent_extrinsics,
+        (const primitives::BlockInfo &block,
+         const std::shared_ptr<storage::trie::PersistentTrieBatch> &batch,
+         const primitives::InherentData &),
+        (override));
 
     MOCK_METHOD(outcome::result<primitives::CheckInherentsResult>,
                 check_inherents,
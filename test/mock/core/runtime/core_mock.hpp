@@ -26,10 +26,12 @@ namespace kagome::runtime {
                 (const primitives::Block &),
                 (override));
 
-    MOCK_METHOD(outcome::result<storage::trie::RootHash>,
-                initialize_block,
-                (const primitives::BlockHeader &),
-                (override));
+    MOCK_METHOD(
+        outcome::result<void>,
+        initialize_block,
+        (const primitives::BlockHeader &,
+         const std::shared_ptr<storage::trie::PersistentTrieBatch> &),
+        (override));
 
     MOCK_METHOD(outcome::result<std::vector<primitives::AuthorityId>>,
                 authorities,
@@ -8,6 +8,8 @@
 
 #include "runtime/memory.hpp"
 
+#include <list>
+
 #include <gmock/gmock.h>
 
 namespace kagome::runtime {
@@ -57,6 +59,14 @@ namespace kagome::runtime {
                 (WasmPointer, WasmSize),
                 (const, override));
 
+    /// forwards to loadN, so that tests set expectations on the loaded bytes
+    /// no matter whether they are copied or viewed; keeps the loaded bytes
+    /// alive for the lifetime of the mock
+    gsl::span<const uint8_t> view(WasmPointer addr,
+                                  WasmSize n) const override {
+      return views_.emplace_back(loadN(addr, n));
+    }
+
     MOCK_METHOD(void, store8, (WasmPointer, int8_t), (override));
 
     MOCK_METHOD(void, store16, (WasmPointer, int16_t), (override));
@@ -76,6 +86,9 @@ namespace kagome::runtime {
                 (override));
 
     MOCK_METHOD(WasmSpan, storeBuffer, (gsl::span<const uint8_t>), (override));
+
+   private:
+    mutable std::list<common::Buffer> views_;
   };
 
 }  // namespace kagome::runtime
@@ -0,0 +1,35 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_TEST_MOCK_CORE_RUNTIME_MODULE_FACTORY_MOCK_HPP
+#define KAGOME_TEST_MOCK_CORE_RUNTIME_MODULE_FACTORY_MOCK_HPP
+
+#include "runtime/module_factory.hpp"
+
+#include <gmock/gmock.h>
+
+#include "runtime/module.hpp"
+
+namespace kagome::runtime {
+
+  class ModuleFactoryMock final : public ModuleFactory {
+   public:
+    MOCK_METHOD(outcome::result<std::unique_ptr<Module>>,
+                make,
+                (gsl::span<const uint8_t> code),
+                (const, override));
+  };
+
+  class ModuleMock final : public Module {
+   public:
+    MOCK_METHOD(outcome::result<std::shared_ptr<ModuleInstance>>,
+                instantiate,
+                (),
+                (const, override));
+  };
+
+}  // namespace kagome::runtime
+
+#endif  // KAGOME_TEST_MOCK_CORE_RUNTIME_MODULE_FACTORY_MOCK_HPP
@@ -22,6 +22,12 @@ namespace kagome::runtime {
                  const primitives::BlockInfo &block,
                  const primitives::BlockHeader &header),
                 (override));
+
+    MOCK_METHOD(void,
+                precompileAt,
+                (std::shared_ptr<const RuntimeCodeProvider> code_provider,
+                 const storage::trie::RootHash &state),
+                (override));
   };
 
 }  // namespace kagome::runtime
@@ -55,6 +55,12 @@ namespace kagome::runtime {
                  const storage::trie::RootHash &storage_state),
                 (const, override));
 
+    MOCK_METHOD(std::unique_ptr<RuntimeEnvironmentTemplate>,
+                start,
+                (const primitives::BlockInfo &blockchain_state,
+                 std::shared_ptr<storage::trie::PersistentTrieBatch> batch),
+                (const, override));
+
     MOCK_METHOD(outcome::result<std::unique_ptr<RuntimeEnvironmentTemplate>>,
                 start,
                 (const primitives::BlockHash &blockchain_state),
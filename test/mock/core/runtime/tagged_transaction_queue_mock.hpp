@@ -16,6 +16,12 @@ namespace kagome::runtime {
                 validate_transaction,
                 (primitives::TransactionSource, const primitives::Extrinsic &),
                 (override));
+
+    MOCK_METHOD(outcome::result<ValidityResults>,
+                validate_transactions,
+                (primitives::TransactionSource,
+                 gsl::span<const primitives::Extrinsic>),
+                (override));
   };
 }  // namespace kagome::runtime
 
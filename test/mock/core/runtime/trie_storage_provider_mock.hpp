@@ -24,6 +24,11 @@ namespace kagome::runtime {
                 (const storage::trie::RootHash &),
                 (override));
 
+    MOCK_METHOD(void,
+                setToPersistent,
+                (std::shared_ptr<PersistentBatch>),
+                (override));
+
     MOCK_METHOD(std::shared_ptr<Batch>, getCurrentBatch, (), (const, override));
 
     MOCK_METHOD(std::optional<std::shared_ptr<PersistentBatch>>,
@@ -21,6 +21,11 @@ namespace kagome::storage::trie {
                 (PolkadotTrie &),
                 (override));
 
+    MOCK_METHOD(outcome::result<RootHash>,
+                calculateRoot,
+                (const PolkadotTrie &),
+                (const, override));
+
     MOCK_METHOD(outcome::result<std::shared_ptr<PolkadotTrie>>,
                 retrieveTrie,
                 (const common::Buffer &),
@@ -60,6 +60,11 @@ namespace kagome::storage::trie {
                 (),
                 (override));
 
+    MOCK_METHOD(outcome::result<storage::trie::RootHash>,
+                hash,
+                (),
+                (override));
+
     MOCK_METHOD(std::unique_ptr<TopperTrieBatch>, batchOnTop, (), (override));
   };
 
@@ -0,0 +1,35 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef KAGOME_TEST_MOCK_CORE_STORAGE_TRIE_TRIE_DIFF_MOCK
+#define KAGOME_TEST_MOCK_CORE_STORAGE_TRIE_TRIE_DIFF_MOCK
+
+#include <gmock/gmock.h>
+
+#include "storage/trie/trie_diff.hpp"
+
+namespace kagome::storage::trie {
+
+  class TrieDiffMock : public TrieDiff {
+   public:
+    MOCK_METHOD(outcome::result<void>,
+                diff,
+                (const RootHash &from,
+                 const RootHash &to,
+                 const OnChange &on_change),
+                (const, override));
+
+    MOCK_METHOD(outcome::result<void>,
+                diff,
+                (const RootHash &from,
+                 const RootHash &to,
+                 gsl::span<const common::Buffer> keys,
+                 const OnChange &on_change),
+                (const, override));
+  };
+
+}  // namespace kagome::storage::trie
+
+#endif  // KAGOME_TEST_MOCK_CORE_STORAGE_TRIE_TRIE_DIFF_MOCK
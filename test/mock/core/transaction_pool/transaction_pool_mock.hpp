@@ -15,16 +15,22 @@ namespace kagome::transaction_pool {
   class TransactionPoolMock : public TransactionPool {
    public:
     MOCK_METHOD(
-        (std::unordered_map<Transaction::Hash, std::shared_ptr<Transaction>> &),
+        (std::unordered_map<Transaction::Hash, std::shared_ptr<Transaction>>),
         getPendingTransactions,
         (),
-        (const));
+        (const, override));
 
     MOCK_METHOD(outcome::result<Transaction::Hash>,
                 submitExtrinsic,
                 (primitives::TransactionSource, primitives::Extrinsic),
                 (override));
 
+    MOCK_METHOD(std::vector<outcome::result<Transaction::Hash>>,
+                submitExtrinsics,
+                (primitives::TransactionSource,
+                 std::vector<primitives::Extrinsic>),
+                (override));
+
     MOCK_METHOD(outcome::result<void>, submitOne, (Transaction), ());
     outcome::result<void> submitOne(Transaction &&tx) override {
       return submitOne(tx);
@@ -44,6 +50,8 @@ namespace kagome::transaction_pool {
                 (),
                 (const));
 
+    MOCK_METHOD(ReadyTransactions, getReadyQueue, (), (const, override));
+
     MOCK_METHOD(outcome::result<std::vector<Transaction>>,
                 removeStale,
                 (const primitives::BlockId &),